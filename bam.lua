@@ -128,6 +128,7 @@ function DefaultGCCLike( platform, config, compiler )
 	settings.dll.flags:Add( arch )
 	settings.link.flags:Add( arch )
 	settings.link.libs:Add( 'rt' )
+	settings.link.libs:Add( 'pthread' ) -- dl_util_load_batch() and dl_instance_load_inplace_parallel() run on std::thread:s
 
 	return settings
 end
@@ -1,17 +1,38 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <dl/dl.h>
 #include <dl/dl_txt.h>
 #include <dl/dl_typelib.h>
+#include <dl/dl_reflect.h>
+#include <dl/dl_convert.h>
+#include <dl/dl_util.h>
+#include <dl/dl_view.h>
 
 #include <vector>
+#include <string>
 
 #include "ubench.h"
 
+#include "../src/dl_swap.h"
+
 #define DL_ARRAY_LENGTH(arr) (uint32_t)(sizeof(arr)/sizeof(arr[0]))
 
+/**
+ * Abort the benchmark if a dl-call fails, timings of failing calls are worthless.
+ */
+#define DLBENCH_CHECK(expr) dlbench_check( (expr), #expr, __FILE__, __LINE__ )
+
+static inline void dlbench_check( dl_error_t err, const char* expr, const char* file, int line )
+{
+	if( err == DL_ERROR_OK )
+		return;
+	fprintf( stderr, "%s(%d): %s failed with %s\n", file, line, expr, dl_error_to_string( err ) );
+	abort();
+}
+
 #include "generated/dlbench.h"
 
 const unsigned char TYPELIB_SRC[] = {
@@ -33,8 +54,8 @@ UBENCH_F_SETUP(dlbench)
 	dl_create_params_t p;
 	DL_CREATE_PARAMS_SET_DEFAULT(p);
 
-	dl_context_create( &ubench_fixture->ctx, &p );
-	dl_context_load_type_library( ubench_fixture->ctx, TYPELIB_SRC, sizeof(TYPELIB_SRC) );
+	DLBENCH_CHECK( dl_context_create( &ubench_fixture->ctx, &p ) );
+	DLBENCH_CHECK( dl_context_load_type_library( ubench_fixture->ctx, TYPELIB_SRC, sizeof(TYPELIB_SRC) ) );
 }
 
 UBENCH_F_TEARDOWN(dlbench)
@@ -53,20 +74,16 @@ struct dlbench_txt_instance
 		size_t pack_size = 0;
 		size_t txt_size  = 0;
 
-		dl_error_t err;
 		// ... pack ...
-		err = dl_instance_store( ctx, T::TYPE_ID, inst, 0x0, 0, &pack_size );
+		DLBENCH_CHECK( dl_instance_store( ctx, T::TYPE_ID, inst, 0x0, 0, &pack_size ) );
 		unsigned char* packed_instance = (unsigned char*)malloc( pack_size );
-		err = dl_instance_store( ctx, T::TYPE_ID, inst, packed_instance, pack_size, 0x0 );
+		DLBENCH_CHECK( dl_instance_store( ctx, T::TYPE_ID, inst, packed_instance, pack_size, 0x0 ) );
 
-		err = dl_txt_unpack( ctx, T::TYPE_ID, packed_instance, pack_size, 0x0, 0, &txt_size );
+		DLBENCH_CHECK( dl_txt_unpack( ctx, T::TYPE_ID, packed_instance, pack_size, 0x0, 0, &txt_size ) );
 		txt = (char*)malloc( txt_size );
-		err = dl_txt_unpack( ctx, T::TYPE_ID, packed_instance, pack_size, txt, txt_size, 0x0 );
+		DLBENCH_CHECK( dl_txt_unpack( ctx, T::TYPE_ID, packed_instance, pack_size, txt, txt_size, 0x0 ) );
 
 		free( packed_instance );
-
-		// TODO: check err
-		(void)err;
 	}
 
 	~dlbench_txt_instance()
@@ -84,9 +101,8 @@ struct dlbench_pack_buffer
 {
 	dlbench_pack_buffer(dl_ctx_t ctx, const char* txt_inst)
 	{
-		dl_error_t err = dl_txt_pack( ctx, txt_inst, 0x0, 0, &size );
+		DLBENCH_CHECK( dl_txt_pack( ctx, txt_inst, 0x0, 0, &size ) );
 		buffer = (unsigned char*)malloc( size );
-		(void)err; // TODO: check err
 	}
 
 	~dlbench_pack_buffer()
@@ -110,7 +126,7 @@ UBENCH_EX_F(dlbench, txt_pack_small_array_fp32)
 
 	UBENCH_DO_BENCHMARK()
 	{
-		dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 );
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
 	}
 }
 
@@ -127,7 +143,57 @@ UBENCH_EX_F(dlbench, txt_pack_big_array_fp32)
 
 	UBENCH_DO_BENCHMARK()
 	{
-		dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 );
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// ... and with floats that need all their digits to round-trip ...
+UBENCH_EX_F(dlbench, txt_pack_big_array_fp32_frac)
+{
+	std::vector<float>data( 10000 );
+	fp32_array inst = { { &data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i ) inst.arr[i] = (float)i / 7.0f;
+
+	dlbench& f = *ubench_fixture;
+	dlbench_txt_instance t( f.ctx, &inst );
+	dlbench_pack_buffer  b( f.ctx, t.txt );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
+	}
+}
+
+UBENCH_EX_F(dlbench, txt_pack_big_array_fp64_frac)
+{
+	std::vector<double>data( 10000 );
+	fp64_array inst = { { &data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i ) inst.arr[i] = (double)i / 7.0;
+
+	dlbench& f = *ubench_fixture;
+	dlbench_txt_instance t( f.ctx, &inst );
+	dlbench_pack_buffer  b( f.ctx, t.txt );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// testing perf packing a text-instance with a big array of ints
+UBENCH_EX_F(dlbench, txt_pack_big_array_int32)
+{
+	std::vector<int32_t>data( 10000 );
+	i32_array inst = { { &data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i ) inst.arr[i] = (int32_t)( i * 2654435761u );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_txt_instance t( f.ctx, &inst );
+	dlbench_pack_buffer  b( f.ctx, t.txt );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
 	}
 }
 
@@ -144,7 +210,7 @@ UBENCH_EX_F(dlbench, txt_pack_big_array_fp32_zero)
 
 	UBENCH_DO_BENCHMARK()
 	{
-		dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 );
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
 	}
 }
 
@@ -167,7 +233,7 @@ UBENCH_EX_F(dlbench, txt_pack_big_array_array_fp32)
 
 	UBENCH_DO_BENCHMARK()
 	{
-		dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 );
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
 	}
 }
 
@@ -184,7 +250,7 @@ UBENCH_EX_F(dlbench, txt_pack_big_array_str)
 
 	UBENCH_DO_BENCHMARK()
 	{
-		dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 );
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
 	}
 }
 
@@ -201,10 +267,504 @@ UBENCH_EX_F(dlbench, txt_pack_big_array_str_null)
 
 	UBENCH_DO_BENCHMARK()
 	{
-		dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 );
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
 	}
 }
 
+// testing perf packing a text-instance with a big array of structs with a lot of members
+UBENCH_EX_F(dlbench, txt_pack_big_array_wide_struct)
+{
+	std::vector<wide_struct> data( 1000 );
+	wide_struct_array inst = { { &data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i )
+	{
+		uint32_t members[sizeof(wide_struct) / sizeof(uint32_t)];
+		for( uint32_t m = 0; m < DL_ARRAY_LENGTH(members); ++m )
+			members[m] = (uint32_t)i + m;
+		memcpy( &data[i], members, sizeof(wide_struct) );
+	}
+
+	dlbench& f = *ubench_fixture;
+	dlbench_txt_instance t( f.ctx, &inst );
+	dlbench_pack_buffer  b( f.ctx, t.txt );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_txt_pack( f.ctx, t.txt, b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// testing perf unpacking an instance to text, the instance is stored once and unpacked into a buffer of the right size.
+template<typename T>
+static void dlbench_txt_unpack( struct ubench_run_state_s* ubench_run_state, dl_ctx_t ctx, const T* inst )
+{
+	size_t pack_size = 0;
+	size_t txt_size  = 0;
+	DLBENCH_CHECK( dl_instance_store( ctx, T::TYPE_ID, inst, 0x0, 0, &pack_size ) );
+	std::vector<unsigned char> packed( pack_size );
+	DLBENCH_CHECK( dl_instance_store( ctx, T::TYPE_ID, inst, &packed[0], packed.size(), 0x0 ) );
+	DLBENCH_CHECK( dl_txt_unpack( ctx, T::TYPE_ID, &packed[0], packed.size(), 0x0, 0, &txt_size ) );
+	std::vector<char> txt( txt_size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_txt_unpack( ctx, T::TYPE_ID, &packed[0], packed.size(), &txt[0], txt.size(), 0x0 ) );
+		UBENCH_DO_NOTHING( &txt[0] );
+	}
+}
+
+// ... with a big array of "random" floats needing all their digits ...
+UBENCH_EX_F(dlbench, txt_unpack_big_array_fp32)
+{
+	std::vector<float> data( 100000 );
+	for( size_t i = 0; i < data.size(); ++i ) data[i] = (float)i / 7.0f;
+	fp32_array inst = { { &data[0], (uint32_t)data.size() } };
+	dlbench_txt_unpack( ubench_run_state, ubench_fixture->ctx, &inst );
+}
+
+UBENCH_EX_F(dlbench, txt_unpack_big_array_fp64)
+{
+	std::vector<double> data( 100000 );
+	for( size_t i = 0; i < data.size(); ++i ) data[i] = (double)i / 7.0;
+	fp64_array inst = { { &data[0], (uint32_t)data.size() } };
+	dlbench_txt_unpack( ubench_run_state, ubench_fixture->ctx, &inst );
+}
+
+UBENCH_EX_F(dlbench, txt_unpack_big_array_int32)
+{
+	std::vector<int32_t> data( 100000 );
+	for( size_t i = 0; i < data.size(); ++i ) data[i] = (int32_t)( i * 2654435761u );
+	i32_array inst = { { &data[0], (uint32_t)data.size() } };
+	dlbench_txt_unpack( ubench_run_state, ubench_fixture->ctx, &inst );
+}
+
+// testing perf storing an instance with a big graph of pointers where most nodes are referenced multiple times
+UBENCH_EX_F(dlbench, store_big_ptr_graph)
+{
+	std::vector<ptr_graph_node>  nodes( 100000 );
+	std::vector<ptr_graph_node*> node_ptrs( nodes.size() );
+	for( size_t i = 0; i < nodes.size(); ++i )
+	{
+		// link to an already visited node to keep recursion shallow while storing.
+		nodes[i].value = (uint32_t)i;
+		nodes[i].link  = &nodes[i / 2];
+		node_ptrs[i]   = &nodes[i];
+	}
+	ptr_graph inst = { { &node_ptrs[0], (uint32_t)node_ptrs.size() } };
+
+	dlbench& f = *ubench_fixture;
+	size_t pack_size = 0;
+	DLBENCH_CHECK( dl_instance_store( f.ctx, ptr_graph::TYPE_ID, &inst, 0x0, 0, &pack_size ) );
+	std::vector<unsigned char> packed( pack_size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_store( f.ctx, ptr_graph::TYPE_ID, &inst, &packed[0], packed.size(), 0x0 ) );
+	}
+}
+
+UBENCH_EX_F(dlbench, store_big_string_array)
+{
+	std::vector<std::string> strings( 100000 );
+	std::vector<const char*> str_ptrs( strings.size() );
+	for( size_t i = 0; i < strings.size(); ++i )
+	{
+		strings[i]  = "string_" + std::to_string( i );
+		str_ptrs[i] = strings[i].c_str();
+	}
+	str_array inst = { { &str_ptrs[0], (uint32_t)str_ptrs.size() } };
+
+	dlbench& f = *ubench_fixture;
+	size_t pack_size = 0;
+	DLBENCH_CHECK( dl_instance_store( f.ctx, str_array::TYPE_ID, &inst, 0x0, 0, &pack_size ) );
+	std::vector<unsigned char> packed( pack_size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_store( f.ctx, str_array::TYPE_ID, &inst, &packed[0], packed.size(), 0x0 ) );
+	}
+}
+
+UBENCH_EX_F(dlbench, store_big_struct_array_few_ptrs)
+{
+	std::vector<few_ptrs_struct> elems( 100000 );
+	for( size_t i = 0; i < elems.size(); ++i )
+	{
+		few_ptrs_struct& e = elems[i];
+		e.pos[0] = e.pos[1] = e.pos[2] = (float)i;
+		e.rot[0] = e.rot[1] = e.rot[2] = 0.0f;
+		e.rot[3] = 1.0f;
+		e.id     = (uint32_t)i;
+		e.name   = "elem";
+	}
+	few_ptrs_struct_array inst = { { &elems[0], (uint32_t)elems.size() } };
+
+	dlbench& f = *ubench_fixture;
+	size_t pack_size = 0;
+	DLBENCH_CHECK( dl_instance_store( f.ctx, few_ptrs_struct_array::TYPE_ID, &inst, 0x0, 0, &pack_size ) );
+	std::vector<unsigned char> packed( pack_size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_store( f.ctx, few_ptrs_struct_array::TYPE_ID, &inst, &packed[0], packed.size(), 0x0 ) );
+	}
+}
+
+template<typename T>
+static std::vector<unsigned char> dlbench_store( dl_ctx_t ctx, const T* inst )
+{
+	size_t pack_size = 0;
+	DLBENCH_CHECK( dl_instance_store( ctx, T::TYPE_ID, inst, 0x0, 0, &pack_size ) );
+	std::vector<unsigned char> packed( pack_size );
+	DLBENCH_CHECK( dl_instance_store( ctx, T::TYPE_ID, inst, &packed[0], packed.size(), 0x0 ) );
+	return packed;
+}
+
+// validation should run at close to the speed of just reading the packed data, compare validate_* with
+// memcpy_* to see how close.
+static void dlbench_validate( struct ubench_run_state_s* ubench_run_state, dl_ctx_t ctx, dl_typeid_t type, const std::vector<unsigned char>& packed, bool validate )
+{
+	std::vector<unsigned char> copy( packed.size() );
+	UBENCH_DO_BENCHMARK()
+	{
+		if( validate )
+		{
+			DLBENCH_CHECK( dl_instance_validate( ctx, type, &packed[0], packed.size() ) );
+		}
+		else
+		{
+			memcpy( &copy[0], &packed[0], packed.size() );
+			UBENCH_DO_NOTHING( &copy[0] );
+		}
+	}
+}
+
+static std::vector<unsigned char> dlbench_big_struct_array_few_ptrs( dl_ctx_t ctx )
+{
+	std::vector<few_ptrs_struct> elems( 100000 );
+	std::vector<std::string>     names( elems.size() );
+	for( size_t i = 0; i < elems.size(); ++i )
+	{
+		few_ptrs_struct& e = elems[i];
+		e.pos[0] = e.pos[1] = e.pos[2] = (float)i;
+		e.rot[0] = e.rot[1] = e.rot[2] = 0.0f;
+		e.rot[3] = 1.0f;
+		e.id     = (uint32_t)i;
+		names[i] = "elem_" + std::to_string( i );
+		e.name   = names[i].c_str();
+	}
+	few_ptrs_struct_array inst = { { &elems[0], (uint32_t)elems.size() } };
+	return dlbench_store( ctx, &inst );
+}
+
+static std::vector<unsigned char> dlbench_big_fp32_array( dl_ctx_t ctx )
+{
+	std::vector<float> arr( 1000000, 1.0f );
+	fp32_array inst = { { &arr[0], (uint32_t)arr.size() } };
+	return dlbench_store( ctx, &inst );
+}
+
+static std::vector<unsigned char> dlbench_ptr_graph( dl_ctx_t ctx, size_t node_count )
+{
+	std::vector<ptr_graph_node>  nodes( node_count );
+	std::vector<ptr_graph_node*> node_ptrs( nodes.size() );
+	for( size_t i = 0; i < nodes.size(); ++i )
+	{
+		nodes[i].value = (uint32_t)i;
+		nodes[i].link  = &nodes[i / 2];
+		node_ptrs[i]   = &nodes[i];
+	}
+	ptr_graph inst = { { &node_ptrs[0], (uint32_t)node_ptrs.size() } };
+	return dlbench_store( ctx, &inst );
+}
+
+static std::vector<unsigned char> dlbench_big_ptr_graph( dl_ctx_t ctx )
+{
+	return dlbench_ptr_graph( ctx, 100000 );
+}
+
+UBENCH_EX_F(dlbench, validate_big_struct_array_few_ptrs) { dlbench_validate( ubench_run_state, ubench_fixture->ctx, few_ptrs_struct_array::TYPE_ID, dlbench_big_struct_array_few_ptrs( ubench_fixture->ctx ), true ); }
+UBENCH_EX_F(dlbench, memcpy_big_struct_array_few_ptrs)   { dlbench_validate( ubench_run_state, ubench_fixture->ctx, few_ptrs_struct_array::TYPE_ID, dlbench_big_struct_array_few_ptrs( ubench_fixture->ctx ), false ); }
+UBENCH_EX_F(dlbench, validate_big_array_fp32)            { dlbench_validate( ubench_run_state, ubench_fixture->ctx, fp32_array::TYPE_ID, dlbench_big_fp32_array( ubench_fixture->ctx ), true ); }
+UBENCH_EX_F(dlbench, memcpy_big_array_fp32)              { dlbench_validate( ubench_run_state, ubench_fixture->ctx, fp32_array::TYPE_ID, dlbench_big_fp32_array( ubench_fixture->ctx ), false ); }
+UBENCH_EX_F(dlbench, validate_big_ptr_graph)             { dlbench_validate( ubench_run_state, ubench_fixture->ctx, ptr_graph::TYPE_ID, dlbench_big_ptr_graph( ubench_fixture->ctx ), true ); }
+UBENCH_EX_F(dlbench, memcpy_big_ptr_graph)               { dlbench_validate( ubench_run_state, ubench_fixture->ctx, ptr_graph::TYPE_ID, dlbench_big_ptr_graph( ubench_fixture->ctx ), false ); }
+
+// converting to the other endian, large pod-arrays should be swapped at close to memory speed.
+static void dlbench_convert_other_endian( struct ubench_run_state_s* ubench_run_state, dl_ctx_t ctx, dl_typeid_t type, std::vector<unsigned char> packed )
+{
+	std::vector<unsigned char> converted( packed.size() );
+	dl_endian_t other_endian = DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE;
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_convert( ctx, type, &packed[0], packed.size(), &converted[0], converted.size(), other_endian, sizeof(void*), 0x0 ) );
+		UBENCH_DO_NOTHING( &converted[0] );
+	}
+}
+
+static std::vector<unsigned char> dlbench_big_u16_array( dl_ctx_t ctx )
+{
+	std::vector<uint16_t> arr( 1000000, 0x1234 );
+	u16_array inst = { { &arr[0], (uint32_t)arr.size() } };
+	return dlbench_store( ctx, &inst );
+}
+
+static std::vector<unsigned char> dlbench_big_wide_struct_array( dl_ctx_t ctx )
+{
+	std::vector<wide_struct> arr( 100000 );
+	memset( &arr[0], 0x12, arr.size() * sizeof(wide_struct) );
+	wide_struct_array inst = { { &arr[0], (uint32_t)arr.size() } };
+	return dlbench_store( ctx, &inst );
+}
+
+UBENCH_EX_F(dlbench, convert_big_array_fp32)         { dlbench_convert_other_endian( ubench_run_state, ubench_fixture->ctx, fp32_array::TYPE_ID,        dlbench_big_fp32_array( ubench_fixture->ctx ) ); }
+UBENCH_EX_F(dlbench, convert_big_array_u16)          { dlbench_convert_other_endian( ubench_run_state, ubench_fixture->ctx, u16_array::TYPE_ID,         dlbench_big_u16_array( ubench_fixture->ctx ) ); }
+UBENCH_EX_F(dlbench, convert_big_wide_struct_array)  { dlbench_convert_other_endian( ubench_run_state, ubench_fixture->ctx, wide_struct_array::TYPE_ID, dlbench_big_wide_struct_array( ubench_fixture->ctx ) ); }
+
+// converting big graphs of pointers between pointer-sizes and endians, each pointer is looked up among all
+// instances found in the graph so lookup need to be constant time not to make this quadratic.
+static std::vector<unsigned char> dlbench_convert_to( dl_ctx_t ctx, dl_typeid_t type, std::vector<unsigned char>& packed, dl_endian_t endian, size_t ptr_size )
+{
+	size_t size = 0;
+	DLBENCH_CHECK( dl_convert_calc_size( ctx, type, &packed[0], packed.size(), ptr_size, &size ) );
+	std::vector<unsigned char> converted( size );
+	DLBENCH_CHECK( dl_convert( ctx, type, &packed[0], packed.size(), &converted[0], converted.size(), endian, ptr_size, 0x0 ) );
+	return converted;
+}
+
+static void dlbench_convert( struct ubench_run_state_s* ubench_run_state, dl_ctx_t ctx, dl_typeid_t type, std::vector<unsigned char> packed, dl_endian_t endian, size_t ptr_size )
+{
+	std::vector<unsigned char> converted = dlbench_convert_to( ctx, type, packed, endian, ptr_size );
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_convert( ctx, type, &packed[0], packed.size(), &converted[0], converted.size(), endian, ptr_size, 0x0 ) );
+		UBENCH_DO_NOTHING( &converted[0] );
+	}
+}
+
+static std::vector<unsigned char> dlbench_big_ptr_graph_32( dl_ctx_t ctx )
+{
+	std::vector<unsigned char> packed = dlbench_big_ptr_graph( ctx );
+	return dlbench_convert_to( ctx, ptr_graph::TYPE_ID, packed, DL_ENDIAN_HOST, 4 );
+}
+
+static const dl_endian_t DLBENCH_OTHER_ENDIAN = DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE;
+
+UBENCH_EX_F(dlbench, convert_big_ptr_graph_other_endian)    { dlbench_convert( ubench_run_state, ubench_fixture->ctx, ptr_graph::TYPE_ID, dlbench_big_ptr_graph( ubench_fixture->ctx ),    DLBENCH_OTHER_ENDIAN, sizeof(void*) ); }
+UBENCH_EX_F(dlbench, convert_big_ptr_graph_to_32)           { dlbench_convert( ubench_run_state, ubench_fixture->ctx, ptr_graph::TYPE_ID, dlbench_big_ptr_graph( ubench_fixture->ctx ),    DL_ENDIAN_HOST,       4 ); }
+UBENCH_EX_F(dlbench, convert_big_ptr_graph_32_to_64)        { dlbench_convert( ubench_run_state, ubench_fixture->ctx, ptr_graph::TYPE_ID, dlbench_big_ptr_graph_32( ubench_fixture->ctx ), DL_ENDIAN_HOST,       8 ); }
+UBENCH_EX_F(dlbench, convert_big_ptr_graph_32_to_64_swap)   { dlbench_convert( ubench_run_state, ubench_fixture->ctx, ptr_graph::TYPE_ID, dlbench_big_ptr_graph_32( ubench_fixture->ctx ), DLBENCH_OTHER_ENDIAN, 8 ); }
+
+// the swap-kernels used by convert on their own, vectorized vs. one element at the time.
+static void dlbench_swap_array( struct ubench_run_state_s* ubench_run_state, size_t elem_size, bool vectorized )
+{
+	std::vector<unsigned char> src( 4 * 1024 * 1024, 0x12 );
+	std::vector<unsigned char> dst( src.size() );
+	size_t count = src.size() / elem_size;
+	UBENCH_DO_BENCHMARK()
+	{
+		if( vectorized )
+			dl_swap_endian_array( &dst[0], &src[0], count, elem_size );
+		else
+			dl_swap_endian_array_scalar( &dst[0], &src[0], count, elem_size );
+		UBENCH_DO_NOTHING( &dst[0] );
+	}
+}
+
+UBENCH_EX(dlbench, swap_array_2byte_vector) { dlbench_swap_array( ubench_run_state, 2, true ); }
+UBENCH_EX(dlbench, swap_array_2byte_scalar) { dlbench_swap_array( ubench_run_state, 2, false ); }
+UBENCH_EX(dlbench, swap_array_4byte_vector) { dlbench_swap_array( ubench_run_state, 4, true ); }
+UBENCH_EX(dlbench, swap_array_4byte_scalar) { dlbench_swap_array( ubench_run_state, 4, false ); }
+UBENCH_EX(dlbench, swap_array_8byte_vector) { dlbench_swap_array( ubench_run_state, 8, true ); }
+UBENCH_EX(dlbench, swap_array_8byte_scalar) { dlbench_swap_array( ubench_run_state, 8, false ); }
+
+// testing perf of looking up types by typeid in a context with a specific amount of types loaded.
+/**
+ * Helper class to create a scoped context with a lot of generated types.
+ */
+struct dlbench_many_types
+{
+	explicit dlbench_many_types(uint32_t type_count)
+	{
+		dl_create_params_t p;
+		DL_CREATE_PARAMS_SET_DEFAULT(p);
+
+		DLBENCH_CHECK( dl_context_create( &ctx, &p ) );
+
+		std::string tl = "{ \"module\" : \"many_types\", \"types\" : {";
+		for( uint32_t i = 0; i < type_count; ++i )
+		{
+			char type[128];
+			snprintf( type, sizeof(type), "%s\"type_%u\" : { \"members\" : [ { \"name\" : \"m\", \"type\" : \"uint32\" } ] }", i == 0 ? "" : ",", i );
+			tl += type;
+		}
+		tl += "} }";
+
+		DLBENCH_CHECK( dl_context_load_txt_type_library( ctx, tl.c_str(), tl.length() ) );
+
+		types.resize( type_count );
+		DLBENCH_CHECK( dl_reflect_loaded_typeids( ctx, &types[0], type_count ) );
+	}
+
+	~dlbench_many_types()
+	{
+		DLBENCH_CHECK( dl_context_destroy( ctx ) );
+	}
+
+	dl_ctx_t ctx;
+	std::vector<dl_typeid_t> types;
+};
+
+static void dlbench_type_lookup( struct ubench_run_state_s* ubench_run_state, uint32_t type_count )
+{
+	dlbench_many_types t( type_count );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		// do the same amount of lookups independent of type_count to make the timings comparable.
+		for( uint32_t i = 0; i < 1024; ++i )
+		{
+			dl_type_info_t info;
+			DLBENCH_CHECK( dl_reflect_get_type_info( t.ctx, t.types[ ( i * 7919 ) % type_count ], &info ) );
+		}
+	}
+}
+
+UBENCH_EX_F(dlbench, type_lookup_16)   { (void)ubench_fixture; dlbench_type_lookup( ubench_run_state, 16 ); }
+UBENCH_EX_F(dlbench, type_lookup_256)  { (void)ubench_fixture; dlbench_type_lookup( ubench_run_state, 256 ); }
+UBENCH_EX_F(dlbench, type_lookup_4096) { (void)ubench_fixture; dlbench_type_lookup( ubench_run_state, 4096 ); }
+
+// loading many small files, as an asset pipeline does, on one thread and on one thread per hardware thread.
+static void dlbench_load_batch( struct ubench_run_state_s* ubench_run_state, dl_ctx_t ctx, unsigned int thread_count )
+{
+	const size_t file_count = 2000;
+	std::vector<few_ptrs_struct> elems( 64 );
+	for( size_t i = 0; i < elems.size(); ++i )
+	{
+		few_ptrs_struct& e = elems[i];
+		e.pos[0] = e.pos[1] = e.pos[2] = (float)i;
+		e.rot[0] = e.rot[1] = e.rot[2] = 0.0f;
+		e.rot[3] = 1.0f;
+		e.id     = (uint32_t)i;
+		e.name   = "elem";
+	}
+	few_ptrs_struct_array inst = { { &elems[0], (uint32_t)elems.size() } };
+
+	std::vector<std::string> names( file_count );
+	std::vector<const char*> filenames( file_count );
+	for( size_t i = 0; i < file_count; ++i )
+	{
+		names[i]     = "dlbench_load_batch_" + std::to_string( i ) + ".bin";
+		filenames[i] = names[i].c_str();
+		DLBENCH_CHECK( dl_util_store_to_file( ctx, few_ptrs_struct_array::TYPE_ID, filenames[i], DL_UTIL_FILE_TYPE_BINARY, DL_ENDIAN_HOST, sizeof(void*), &inst, 0x0, 0x0, 0x0 ) );
+	}
+	DLBENCH_CHECK( dl_context_freeze( ctx ) );
+
+	std::vector<dl_util_load_batch_result_t> results( file_count );
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_util_load_batch( ctx, few_ptrs_struct_array::TYPE_ID, &filenames[0], file_count, DL_UTIL_FILE_TYPE_BINARY, thread_count, &results[0], 0x0, 0x0, 0x0 ) );
+		for( size_t i = 0; i < file_count; ++i )
+		{
+			DLBENCH_CHECK( results[i].error );
+			free( results[i].allocated_mem );
+		}
+	}
+
+	for( size_t i = 0; i < file_count; ++i )
+		remove( filenames[i] );
+}
+
+UBENCH_EX_F(dlbench, load_batch_1_thread) { dlbench_load_batch( ubench_run_state, ubench_fixture->ctx, 1 ); }
+UBENCH_EX_F(dlbench, load_batch_n_thread) { dlbench_load_batch( ubench_run_state, ubench_fixture->ctx, 0 ); }
+
+// patching the pointers of a huge instance in place split in 1 to n jobs, the packed instance is restored with a memcpy
+// before every load so compare with memcpy_huge_ptr_graph for the cost of patching.
+static std::vector<unsigned char> dlbench_huge_ptr_graph( dl_ctx_t ctx )
+{
+	return dlbench_ptr_graph( ctx, 2000000 );
+}
+
+static void dlbench_load_inplace_parallel( struct ubench_run_state_s* ubench_run_state, dl_ctx_t ctx, unsigned int job_count )
+{
+	std::vector<unsigned char> packed = dlbench_huge_ptr_graph( ctx );
+	std::vector<unsigned char> copy( packed.size() );
+	UBENCH_DO_BENCHMARK()
+	{
+		memcpy( &copy[0], &packed[0], packed.size() );
+		void* loaded;
+		DLBENCH_CHECK( dl_instance_load_inplace_parallel( ctx, ptr_graph::TYPE_ID, &copy[0], copy.size(), job_count, 0x0, 0x0, &loaded, 0x0 ) );
+		UBENCH_DO_NOTHING( loaded );
+	}
+}
+
+UBENCH_EX_F(dlbench, load_inplace_huge_ptr_graph_1_job)  { dlbench_load_inplace_parallel( ubench_run_state, ubench_fixture->ctx, 1 ); }
+UBENCH_EX_F(dlbench, load_inplace_huge_ptr_graph_2_jobs) { dlbench_load_inplace_parallel( ubench_run_state, ubench_fixture->ctx, 2 ); }
+UBENCH_EX_F(dlbench, load_inplace_huge_ptr_graph_4_jobs) { dlbench_load_inplace_parallel( ubench_run_state, ubench_fixture->ctx, 4 ); }
+UBENCH_EX_F(dlbench, load_inplace_huge_ptr_graph_n_jobs) { dlbench_load_inplace_parallel( ubench_run_state, ubench_fixture->ctx, 0 ); }
+UBENCH_EX_F(dlbench, memcpy_huge_ptr_graph)              { dlbench_validate( ubench_run_state, ubench_fixture->ctx, ptr_graph::TYPE_ID, dlbench_huge_ptr_graph( ubench_fixture->ctx ), false ); }
+
+// reading 1% of the nodes of the huge instance without loading it, pointers are only resolved for the nodes read.
+// Nothing is written to the packed instance so no memcpy is needed, compare with load_inplace_huge_ptr_graph_1_job.
+static void dlbench_view_huge_ptr_graph( struct ubench_run_state_s* ubench_run_state, dl_ctx_t ctx, bool generated )
+{
+	std::vector<unsigned char> packed = dlbench_huge_ptr_graph( ctx );
+	UBENCH_DO_BENCHMARK()
+	{
+		uint32_t sum = 0;
+		dl_view_t view;
+		DLBENCH_CHECK( dl_view_instance( ctx, ptr_graph::TYPE_ID, &packed[0], packed.size(), &view ) );
+		if( generated )
+		{
+			ptr_graph_view graph = { view.packed_instance, (const ptr_graph*)view.data };
+			for( uint32_t i = 0; i < graph.nodes_count(); i += 100 )
+				sum += graph.nodes( i ).link().value();
+		}
+		else
+		{
+			dl_view_t nodes;
+			DLBENCH_CHECK( dl_view_member( ctx, &view, 0, &nodes ) );
+			for( uint32_t i = 0; i < nodes.count; i += 100 )
+			{
+				dl_view_t node, link, value;
+				DLBENCH_CHECK( dl_view_array_elem( ctx, &nodes, i, &node ) );
+				DLBENCH_CHECK( dl_view_member( ctx, &node, 1, &link ) );
+				DLBENCH_CHECK( dl_view_member( ctx, &link, 0, &value ) );
+				sum += *(const uint32_t*)value.data;
+			}
+		}
+		UBENCH_DO_NOTHING( &sum );
+	}
+}
+
+UBENCH_EX_F(dlbench, view_huge_ptr_graph)           { dlbench_view_huge_ptr_graph( ubench_run_state, ubench_fixture->ctx, false ); }
+UBENCH_EX_F(dlbench, view_huge_ptr_graph_generated) { dlbench_view_huge_ptr_graph( ubench_run_state, ubench_fixture->ctx, true ); }
+
+static void dlbench_typelib_load( struct ubench_run_state_s* ubench_run_state, bool inplace )
+{
+	// copy typelib to an 8-byte aligned buffer so it can be used in place.
+	std::vector<uint64_t> lib( ( sizeof(TYPELIB_SRC) + sizeof(uint64_t) - 1 ) / sizeof(uint64_t) );
+	memcpy( &lib[0], TYPELIB_SRC, sizeof(TYPELIB_SRC) );
+	const unsigned char* lib_data = (const unsigned char*)&lib[0];
+
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+
+	UBENCH_DO_BENCHMARK()
+	{
+		dl_ctx_t ctx;
+		DLBENCH_CHECK( dl_context_create( &ctx, &p ) );
+		if( inplace )
+			DLBENCH_CHECK( dl_context_load_type_library_inplace( ctx, lib_data, sizeof(TYPELIB_SRC) ) );
+		else
+			DLBENCH_CHECK( dl_context_load_type_library( ctx, lib_data, sizeof(TYPELIB_SRC) ) );
+		DLBENCH_CHECK( dl_context_destroy( ctx ) );
+	}
+}
+
+UBENCH_EX_F(dlbench, typelib_load)         { (void)ubench_fixture; dlbench_typelib_load( ubench_run_state, false ); }
+UBENCH_EX_F(dlbench, typelib_load_inplace) { (void)ubench_fixture; dlbench_typelib_load( ubench_run_state, true ); }
+
 UBENCH_MAIN();
 
 #ifdef _MSC_VER
@@ -0,0 +1,261 @@
+/* Auto generated header for dl type library */
+#ifndef __DL_AUTOGEN_HEADER_SMALL_H_INCLUDED
+#define __DL_AUTOGEN_HEADER_SMALL_H_INCLUDED
+
+#include <stdint.h>
+
+#include <stddef.h> // for size_t and offsetof
+
+#ifndef __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+#define __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+#  if !defined(__cplusplus)
+#    define DL_SIZED_ENUM_SUPPORTED 0
+#  else
+#    if defined(_MSC_VER)
+#      if _MSC_VER < 1900
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      else
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      endif
+#    else
+       // this would need more work but it is good enough for now
+#      define DL_SIZED_ENUM_SUPPORTED 1
+#    endif
+#  endif
+
+   /// ... DL_C_STRUCT ...
+   /// The macro DL_C_STRUCT is used on external types to add struct in c
+   /// where it is needed. In c++ this is skipped as it is not needed and
+   /// could be something else such as a class or typedef.
+#  if defined(__cplusplus)
+#    define DL_C_STRUCT
+#  else
+#    define DL_C_STRUCT struct
+#  endif
+
+   /// ... DL_C_ENUM ...
+   /// Same concept as DL_C_STRUCT
+#  if defined(__cplusplus)
+#    define DL_C_ENUM
+#  else
+#    define DL_C_ENUM enum
+#  endif
+
+   /// ... DL_ALIGN() ...
+#  if defined(_MSC_VER)
+#    define DL_ALIGN(x) __declspec(align(x))
+#  elif defined(__GNUC__)
+#    define DL_ALIGN(x) __attribute__((aligned(x)))
+#  else
+#    error "Unsupported compiler"
+#  endif
+
+   /// ... DL_ALIGNOF() ...
+#  if defined(__clang__)
+#    if __has_feature(cxx_alignof)
+#      define DL_ALIGNOF(type) alignof(type)
+#    elif __has_feature(c_alignof)
+#      define DL_ALIGNOF(type) _Alignof(type)
+#    endif
+#  elif defined(__GNUC__)
+#    define DL_ALIGNOF(type) __alignof__(type)
+#  endif
+#  if defined(_MSC_VER )
+#    define DL_ALIGNOF(type) __alignof(type)
+#  endif
+
+#  ifndef DL_ALIGNOF
+#    define DL_ALIGNOF(type) ((sizeof(type) > 1)? offsetof(struct { char c; type x; }, x) : 1)
+#  endif
+
+   // ... DL_STATIC_ASSERT() ...
+   // ... clang ...
+#  if defined( __clang__ )
+#    if defined( __cplusplus ) && __has_feature(cxx_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    elif __has_feature(c_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#    endif
+   // ... msvc ...
+#  elif defined( _MSC_VER ) && ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#    define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+   // ... gcc ...
+#  elif defined( __cplusplus )
+#    if __cplusplus >= 201103L || ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    endif
+#  elif defined( __STDC__ )
+#    if defined( __STDC_VERSION__ )
+#      if __STDC_VERSION__ >= 201112L
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      else
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      endif
+#    endif
+#  endif
+#  if !defined(DL_STATIC_ASSERT)
+#    define DL_STATIC_ASSERT(x,y) // default to non-implemented.
+#  endif
+
+   // ... DL_DATA_ASSERT() ...
+#  if !defined(DL_DATA_ASSERT)
+#    define DL_DATA_ASSERT(x) // default to non-implemented.
+#  endif
+
+   // ... DL_DECLARE_ARRAY ...
+#  if defined(__cplusplus)
+	  template <typename T>
+	  struct dl_array
+	  {
+		   inline const T& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline T& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const T* begin() const
+		   {
+		       return data;
+		   }
+		   inline const T* end() const
+		   {
+		       return data + count;
+		   }
+		   inline T* begin()
+		   {
+		       return data;
+		   }
+		   inline T* end()
+		   {
+		       return data + count;
+		   }
+		   T* data;
+		   uint32_t count;
+	   };
+	   template <>
+	   struct dl_array<const char*> {
+		   inline const char*& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char*& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char* const* begin() const
+		   {
+		       return data;
+		   }
+		   inline const char* const* end() const
+		   {
+		       return data + count;
+		   }
+		   inline const char** begin()
+		   {
+		       return data;
+		   }
+		   inline const char** end()
+		   {
+		       return data + count;
+		   }
+		   const char** data;
+		   uint32_t count;
+	   };
+#	 define DL_DECLARE_ARRAY(type) dl_array<type>
+#  else
+#	 define DL_DECLARE_ARRAY(type)  \
+       struct              \
+       {                   \
+           type* data;     \
+           uint32_t count; \
+       }
+#  endif
+
+   // ... DL_REL_PTR() ...
+   /// Read a pointer-, string- or array-member of an instance stored with relative pointers, see
+   /// dl_instance_make_relative(). The member store the distance in bytes from itself to the data, 0 for null.
+#  define DL_REL_PTR(type, member) ((type)( (intptr_t)(member) == 0 ? 0 : (const char*)&(member) + (intptr_t)(member) ))
+
+   // ... DL_VIEW_PTR() ...
+   /// Read a pointer-, string- or array-member of a packed instance that is not loaded, see dl_view_instance(). The
+   /// member store the offset in bytes from the start of the packed instance to the data, 0 for null.
+#  define DL_VIEW_PTR(type, packed_instance, member) ((type)( (uintptr_t)(member) == 0 ? 0 : (const unsigned char*)(packed_instance) + (uintptr_t)(member) ))
+#endif // __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+//----------------------------------------------
+//                   TYPEID:s                   
+//----------------------------------------------
+
+// ENUMS
+#define simple_enum_TYPE_ID (0xDE48EBFE)
+
+// TYPES
+#define single_int_TYPE_ID (0x4DB5F3EC)
+
+
+//----------------------------------------------
+//                   ENUMS:s                    
+//----------------------------------------------
+
+#if DL_SIZED_ENUM_SUPPORTED
+
+typedef enum simple_enum
+{
+    SIMPLE_VAL1 = 0,
+    SIMPLE_VAL2 = 1
+} simple_enum;
+
+#else // DL_SIZED_ENUM_SUPPORTED
+
+typedef enum simple_enum
+{
+    SIMPLE_VAL1 = 0,
+    SIMPLE_VAL2 = 1
+} simple_enum;
+
+#endif // DL_SIZED_ENUM_SUPPORTED
+
+//----------------------------------------------
+//                   TYPES:s                    
+//----------------------------------------------
+
+struct single_int
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x4DB5F3EC;
+#endif // defined( __cplusplus )
+
+    uint32_t member; 
+};
+
+#if defined( __cplusplus )
+//----------------------------------------------
+//                   VIEWS                      
+//----------------------------------------------
+
+// Read-only views of a packed instance that is not loaded, pointers are resolved when read. Create the view
+// of the root instance from a dl_view_t returned by dl_view_instance(), { view.packed_instance, (const T*)view.data }.
+
+struct single_int_view;
+
+struct single_int_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct single_int* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t member() const { return dl_data->member; }
+};
+
+
+#endif // defined( __cplusplus )
+
+#endif // __DL_AUTOGEN_HEADER_SMALL_H_INCLUDED
+
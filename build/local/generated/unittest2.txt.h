@@ -0,0 +1,183 @@
+0x7b, 0x0a, 0x09, 0x22, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75,
+0x6e, 0x69, 0x74, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x32, 0x22, 0x2c, 0x0a, 0x0a, 0x09, 0x22,
+0x63, 0x5f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x22, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x74, 0x65, 0x73, 0x74, 0x73, 0x2f, 0x64, 0x6c, 0x5f,
+0x74, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e, 0x68, 0x22,
+0x20, 0x5d, 0x2c, 0x0a, 0x0a, 0x09, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x0a, 0x09, 0x09, 0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x5f, 0x65, 0x6e, 0x75, 0x6d,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e,
+0x22, 0x20, 0x3a, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x76, 0x61,
+0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x65,
+0x78, 0x74, 0x65, 0x72, 0x6e, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x31, 0x22, 0x20, 0x3a, 0x20,
+0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x5f, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x32, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x33, 0x22, 0x20,
+0x3a, 0x20, 0x32, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e,
+0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x34, 0x22, 0x20, 0x3a, 0x20, 0x33, 0x0a, 0x09, 0x09, 0x09,
+0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65,
+0x73, 0x74, 0x31, 0x5f, 0x49, 0x6e, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x36, 0x34, 0x5f, 0x31,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x36, 0x34, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x36, 0x34, 0x5f, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x31, 0x36, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x7d,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73,
+0x74, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x41, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74, 0x31, 0x5f, 0x49, 0x6e, 0x41, 0x72, 0x72,
+0x61, 0x79, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09,
+0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74, 0x32, 0x5f, 0x57, 0x69, 0x74, 0x68, 0x4d, 0x61,
+0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x53, 0x75, 0x62, 0x4d, 0x6f, 0x64, 0x65,
+0x6c, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69,
+0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f,
+0x72, 0x6d, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66,
+0x70, 0x33, 0x32, 0x5b, 0x31, 0x36, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a,
+0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74,
+0x32, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74, 0x32, 0x5f,
+0x57, 0x69, 0x74, 0x68, 0x4d, 0x61, 0x74, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d,
+0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x74, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20,
+0x62, 0x75, 0x67, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x74, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x75, 0x62,
+0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+0x67, 0x65, 0x74, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x6c,
+0x6f, 0x61, 0x64, 0x2e, 0x0a, 0x09, 0x09, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74, 0x33,
+0x5f, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x57, 0x69, 0x74, 0x68, 0x50, 0x74, 0x72, 0x22, 0x20,
+0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72,
+0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69,
+0x6e, 0x74, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74, 0x33, 0x22, 0x20, 0x3a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x75, 0x62, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74, 0x33,
+0x5f, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x57, 0x69, 0x74, 0x68, 0x50, 0x74, 0x72, 0x22, 0x20,
+0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x70, 0x65, 0x72, 0x5f, 0x62,
+0x75, 0x67, 0x5f, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x70, 0x65, 0x72, 0x5f, 0x62,
+0x75, 0x67, 0x22, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x70, 0x65, 0x72, 0x5f, 0x62, 0x75, 0x67, 0x5f, 0x31, 0x5b, 0x5d, 0x22,
+0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x62, 0x75, 0x67, 0x5f,
+0x77, 0x69, 0x74, 0x68, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x5f, 0x32, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09,
+0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x62, 0x75, 0x67, 0x5f, 0x77,
+0x69, 0x74, 0x68, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a,
+0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x73, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x75, 0x62, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x75, 0x67, 0x5f,
+0x77, 0x69, 0x74, 0x68, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x5f, 0x32, 0x22, 0x20, 0x7d,
+0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x76,
+0x65, 0x63, 0x33, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+0x09, 0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x22, 0x20, 0x3a, 0x20, 0x74, 0x72, 0x75, 0x65,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x78, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x79, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x7a, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66,
+0x70, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x22, 0x6e, 0x6f, 0x5f, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x5f, 0x6d, 0x65,
+0x6d, 0x65, 0x62, 0x65, 0x72, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a,
+0x09, 0x09, 0x09, 0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x22, 0x20, 0x3a, 0x20, 0x74, 0x72,
+0x75, 0x65, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61,
+0x6c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x64,
+0x20, 0x61, 0x2c, 0x62, 0x2c, 0x63, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20,
+0x61, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x22, 0x76,
+0x65, 0x72, 0x69, 0x66, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x74,
+0x6f, 0x20, 0x73, 0x6b, 0x69, 0x70, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x74, 0x68,
+0x65, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x78, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70,
+0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x22, 0x20, 0x3a, 0x20,
+0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x79, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x76,
+0x65, 0x72, 0x69, 0x66, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x7a, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x66, 0x70, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x22, 0x20,
+0x3a, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09,
+0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x6e, 0x6f, 0x5f, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79,
+0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x5f, 0x74, 0x65, 0x73, 0x74,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e,
+0x22, 0x20, 0x3a, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20,
+0x68, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6c,
+0x6c, 0x65, 0x64, 0x20, 0x5f, 0x5f, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x61,
+0x74, 0x20, 0x61, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x69, 0x7a, 0x65,
+0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x77, 0x61, 0x79, 0x20,
+0x74, 0x6f, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x0a, 0x09, 0x09, 0x09, 0x2f,
+0x2f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74,
+0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x73, 0x6b, 0x69, 0x70, 0x70, 0x65, 0x64, 0x2e, 0x0a,
+0x09, 0x09, 0x09, 0x22, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x66, 0x61,
+0x6c, 0x73, 0x65, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09,
+0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x5f, 0x74, 0x65, 0x73,
+0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x74, 0x65, 0x73, 0x74,
+0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x20, 0x7d,
+0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x63, 0x6f,
+0x6d, 0x70, 0x6c, 0x65, 0x78, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x5f, 0x61, 0x72, 0x72, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x22, 0x62, 0x69, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x74, 0x65,
+0x73, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x63, 0x6f, 0x6d,
+0x70, 0x6c, 0x65, 0x78, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5b, 0x5d, 0x22, 0x20, 0x7d,
+0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x74,
+0x72, 0x75, 0x63, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x22, 0x20,
+0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x65,
+0x61, 0x64, 0x65, 0x72, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63,
+0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x43, 0x20, 0x63, 0x6f, 0x64, 0x65,
+0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65,
+0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x78,
+0x74, 0x65, 0x72, 0x6e, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09,
+0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a
\ No newline at end of file
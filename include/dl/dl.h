@@ -56,6 +56,7 @@ static const int DL_INLINE_ARRAY_LENGTH_MAX = 0xFFFF;
 
 	DL_ERROR_UTIL_FILE_NOT_FOUND                           - An argument-file is not found.
 	DL_ERROR_UTIL_FILE_TYPE_MISMATCH                       - File type specified to read do not match file content.
+	DL_ERROR_UTIL_FILE_WRITE_FAILED                        - Writing to a file or stream failed, for example on a full disk.
 
 	DL_ERROR_INTERNAL_ERROR                                - Internal error, contact dev!
 */
@@ -90,6 +91,7 @@ typedef enum DL_NODISCARD
 
 	DL_ERROR_UTIL_FILE_NOT_FOUND,
 	DL_ERROR_UTIL_FILE_TYPE_MISMATCH,
+	DL_ERROR_UTIL_FILE_WRITE_FAILED,
 
 	DL_ERROR_INTERNAL_ERROR
 } dl_error_t;
@@ -217,6 +219,11 @@ typedef void  (*dl_error_msg_handler)( const char* msg, void* msg_ctx );
 		                 to the user, set to 0x0 to ignore error-strings.
 		error_msg_ctx  - data passed to error_msg_func as user-data.
 
+		disable_string_merge - set to non-zero to make dl_instance_store write each string as is instead of
+		                       merging identical strings. Storing instances where most strings are unique is
+		                       faster without merging, at the cost of bigger packed instances if there are
+		                       duplicates.
+
 	Note:
 		As a user you might replace the internal memory allocation function by using alloc_func, realloc_func
 		and free_func.
@@ -232,6 +239,8 @@ typedef struct dl_create_params
 
 	dl_error_msg_handler error_msg_func;
 	void*                error_msg_ctx;
+
+	int disable_string_merge;
 } dl_create_params_t;
 
 /*
@@ -253,7 +262,8 @@ typedef struct dl_create_params
 		params.free_func    = 0x0; \
 		params.alloc_ctx    = 0x0; \
 		params.error_msg_func = 0x0; \
-		params.error_msg_ctx  = 0x0;
+		params.error_msg_ctx  = 0x0; \
+		params.disable_string_merge = 0;
 
 /*
 	Group: Context
@@ -276,6 +286,25 @@ dl_error_t DL_DLL_EXPORT dl_context_create( dl_ctx_t* dl_ctx, dl_create_params_t
 */
 dl_error_t DL_DLL_EXPORT dl_context_destroy( dl_ctx_t dl_ctx );
 
+/*
+	Function: dl_context_freeze
+		Finalize all internal lookup-structures in a context and mark it as read-only.
+
+		After a context has been frozen no more type-libraries can be loaded into it, trying to do so will
+		return DL_ERROR_UNSUPPORTED_OPERATION. In return the context will never be modified again and it is safe
+		to use it from any number of threads at the same time in all functions that do not load type-libraries,
+		i.e. instance load/store, convert, txt pack/unpack, util and reflect.
+
+	Parameters:
+		dl_ctx - Context to freeze.
+
+	Note:
+		Functions called on a frozen context might still allocate and free temporary memory via the allocator
+		passed to dl_context_create, this allocator need to be thread-safe if dl_ctx is used from multiple threads.
+		The default allocator, malloc/free, is thread-safe.
+*/
+dl_error_t DL_DLL_EXPORT dl_context_freeze( dl_ctx_t dl_ctx );
+
 /*
 	Function: dl_context_load_type_library
 		Load a type-library from bin-data into the context for use.
@@ -288,6 +317,26 @@ dl_error_t DL_DLL_EXPORT dl_context_destroy( dl_ctx_t dl_ctx );
 */
 dl_error_t DL_DLL_EXPORT dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size );
 
+/*
+	Function: dl_context_load_type_library_inplace
+		Load a type-library from bin-data into the context, using lib_data as storage for the type-information
+		instead of copying it, for example to use a memory-mapped type-library.
+
+	Parameters:
+		dl_ctx        - Context to load type-library into.
+		lib_data      - Pointer to binary-data with type-library, need to be 8-byte aligned to not get copied.
+		lib_data_size - Size of lib_data.
+
+	Note:
+		lib_data is only used in place if it is the first type library loaded into dl_ctx and the host is
+		little endian, otherwise this works as dl_context_load_type_library. Descriptors in lib_data that are
+		not aligned, and metadata and default values, will still be copied.
+		lib_data is never written to but need to be kept alive and unmodified until dl_ctx is destroyed or
+		another type-library is loaded into dl_ctx, at that point all type-information will be copied into
+		dl_ctx.
+*/
+dl_error_t DL_DLL_EXPORT dl_context_load_type_library_inplace( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size );
+
 
 /*
 	Group: Load
@@ -330,11 +379,98 @@ dl_error_t DL_DLL_EXPORT dl_instance_load( dl_ctx_t             dl_ctx,
 
 	Note:
 		Some small memory-waste will be incurred by this function since some header-data will be left in memory.
+
+		If the packed instance was stored with relative pointers, see dl_instance_make_relative, packed_instance
+		is never written to and the loaded instance is only accessed via the generated DL_REL_PTR-accessors.
+
+		All pointers are patched when loaded, if only a small part of a large instance is read see dl_view_instance
+		in dl_view.h that resolves pointers when they are read instead.
 */
 dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,          dl_typeid_t type,
 												   unsigned char* packed_instance, size_t      packed_instance_size,
 												   void**         loaded_instance, size_t*     consumed );
 
+/*
+	Function: dl_job_func
+		Job run by a dl_job_dispatch_func.
+
+	Parameters:
+		job_index - Index of the job to run, 0 to job_count - 1.
+		job_ctx   - Context passed to dl_job_dispatch_func.
+*/
+typedef void (*dl_job_func)( unsigned int job_index, void* job_ctx );
+
+/*
+	Function: dl_job_dispatch_func
+		Callback used to run jobs on other threads, for example on the job-system of the application.
+		Should call job( i, job_ctx ) once for every i from 0 to job_count - 1, in any order and on any thread, and
+		return when all jobs have finished.
+
+	Parameters:
+		job          - Job to run.
+		job_ctx      - Context to pass to job.
+		job_count    - Number of jobs to run.
+		dispatch_ctx - Context passed together with the dispatch function.
+*/
+typedef void (*dl_job_dispatch_func)( dl_job_func job, void* job_ctx, unsigned int job_count, void* dispatch_ctx );
+
+/*
+	Function: dl_instance_load_inplace_parallel
+		Same as dl_instance_load_inplace but with the pointers of the instance patched by job_count jobs in parallel,
+		each patching the pointers listed in one part of the patch-table stored after the instance.
+
+	Parameters:
+		dl_ctx               - DL-context to use when loading instance.
+		dl_typeid            - Type of instance in the packed data.
+		packed_instance      - Packed instance-data to load.
+		packed_instance_size - Size of buffer pointed to by packed_instance.
+		job_count            - Number of jobs to split patching into, 0 for one job per hardware thread.
+		dispatch_func        - Function used to run the jobs, 0x0 to run them on a thread each, the calling thread included.
+		dispatch_ctx         - Context passed to dispatch_func.
+		loaded_instance      - Loaded instance will be returned here.
+		consumed             - Number of bytes consumed to load an instance is returned here, 0x0 to ignore.
+
+	Note:
+		Each job patches a part of the patch-table of at least 16 KB, about as many pointers, so instances with a smaller
+		patch-table are patched on the calling thread as with dl_instance_load_inplace. So are instances stored by an
+		older version of dl that do not have a patch-table.
+
+		dl_ctx is not accessed by the jobs and does not need to be frozen.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_load_inplace_parallel( dl_ctx_t             dl_ctx,          dl_typeid_t type,
+															unsigned char*       packed_instance, size_t      packed_instance_size,
+															unsigned int         job_count,       dl_job_dispatch_func dispatch_func,
+															void*                dispatch_ctx,
+															void**               loaded_instance, size_t*     consumed );
+
+/*
+	Function: dl_instance_validate
+		Validate that packed data is a well formed instance of type without loading it, i.e. that loading it
+		with dl_instance_load or dl_instance_load_inplace will yield an instance where all pointers, strings and
+		arrays reachable from the root point into the instance and all union type-tags are valid.
+
+		Validation is done in one pass over the packed data driven by the type descriptors, the data is never
+		patched or written to. Arrays of pod-types are validated without touching the array-data.
+
+	Parameters:
+		dl_ctx               - DL-context to use when validating instance.
+		dl_typeid            - Type of instance in the packed data.
+		packed_instance      - Packed instance-data to validate.
+		packed_instance_size - Size of buffer pointed to by packed_instance.
+
+	Return:
+		DL_ERROR_OK if the packed instance is valid, DL_ERROR_MALFORMED_DATA if not. Header-errors are reported
+		the same way as for dl_instance_load.
+
+	Note:
+		Packed instance to validate is required to be in current platform endian and pointer-size.
+		Small instances are validated without allocating any memory, bigger ones need some scratch-memory to track
+		the patch-chain and visited pointers. That memory is allocated via the allocator of dl_ctx.
+		Values of enums and other pods are not validated.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_validate( dl_ctx_t             dl_ctx,          dl_typeid_t type,
+											   const unsigned char* packed_instance, size_t      packed_instance_size );
+
 /*
 	Group: Store
 */
@@ -377,6 +513,64 @@ dl_error_t DL_DLL_EXPORT dl_instance_calc_size( dl_ctx_t dl_ctx, dl_typeid_t typ
 dl_error_t DL_DLL_EXPORT dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type,            const void* instance,
 											unsigned char* out_buffer, size_t      out_buffer_size, size_t*     produced_bytes );
 
+/*
+	Function: dl_instance_store_alloc
+		Same as dl_instance_store but with the instance stored to a buffer that is grown as needed, so the
+		instance is only traversed once instead of once to calculate the size and once to store it.
+
+	Parameters:
+		dl_ctx       - Context to use.
+		type         - Type id for type to store.
+		instance     - Ptr to instance to store.
+		alloc_func   - Function used to allocate the stored instance, 0x0 to use malloc.
+		realloc_func - Function used to grow the stored instance, 0x0 to use realloc or alloc_func/free_func.
+		free_func    - Function used to free the stored instance, 0x0 to use free.
+		alloc_ctx    - Context passed to alloc_func, realloc_func and free_func.
+		out_buffer   - Set to the stored instance on success, to be freed with free_func.
+		out_size     - Set to the size of the stored instance, can be 0x0.
+
+	Return:
+		DL_ERROR_OK on success, out_buffer is not set on error.
+
+	Note:
+		The instance after pack will be in current platform endian.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_store_alloc( dl_ctx_t        dl_ctx,     dl_typeid_t     type,         const void* instance,
+												  dl_alloc_func   alloc_func, dl_realloc_func realloc_func,
+												  dl_free_func    free_func,  void*           alloc_ctx,
+												  unsigned char** out_buffer, size_t*         out_size );
+
+/*
+	Function: dl_instance_make_relative
+		Rewrite a packed instance in place so that all pointers, strings and arrays are stored as the distance in
+		bytes from the pointer itself to the data it points to, 0 for null.
+
+		An instance with relative pointers need no patching when loaded, dl_instance_load_inplace will never write
+		to it. This makes it possible to use an instance directly from a read-only, shared memory-mapping of a
+		file. Members are accessed via the <type>_rel_<member>-functions in the generated c-header, or with the
+		DL_REL_PTR()-macro, instead of reading the pointers in the struct directly.
+
+	Parameters:
+		dl_ctx               - Context to use.
+		type                 - Type id of instance in packed_instance.
+		packed_instance      - Packed instance, as produced by dl_instance_store or dl_txt_pack, to rewrite.
+		packed_instance_size - Size of packed_instance.
+
+	Return:
+		DL_ERROR_OK on success. The instance is validated the same way as by dl_instance_validate before anything
+		is written. DL_ERROR_UNSUPPORTED_OPERATION is returned if a pointer points to itself as that would be
+		stored as 0. DL_ERROR_VERSION_MISMATCH is returned for instances stored with a pointer-chain by an older
+		version of DL, as libraries of that version would load it without noticing the relative pointers. Such
+		instances are stored in the current version by loading and storing them again with dl_instance_load and
+		dl_instance_store.
+
+	Note:
+		The packed instance is required to be in current platform endian and pointer-size. Instances with relative
+		pointers can not be converted with dl_convert or unpacked with dl_txt_unpack.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_make_relative( dl_ctx_t       dl_ctx,          dl_typeid_t type,
+													unsigned char* packed_instance, size_t      packed_instance_size );
+
 
 /*
 	Group: Util
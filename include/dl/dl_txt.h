@@ -36,6 +36,74 @@ extern "C" {
 */
 dl_error_t DL_DLL_EXPORT dl_txt_pack( dl_ctx_t dl_ctx, const char* txt_instance, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes );
 
+/*
+	Function: dl_txt_pack_ex
+		Same as dl_txt_pack but with the length of txt_instance passed explicitly. txt_instance do not need
+		to be zero-terminated and no byte after txt_instance_len is ever read, so text can be packed directly
+		from a memory-mapped file or a slice of a larger buffer.
+
+	Parameters:
+		dl_ctx           - Context to use.
+		txt_instance     - String to pack to binary blob.
+		txt_instance_len - Length of txt_instance in bytes.
+		out_buffer       - Buffer to pack data to.
+		out_buffer_size  - Size of out_buffer.
+		produced_bytes   - Number of bytes that would have been written to out_buffer if it was large enough.
+
+	Return:
+		Same as dl_txt_pack.
+
+	Note:
+		Text that does not end with the '}' closing the root map, ignoring trailing whitespace, is copied
+		to a temporary zero-terminated buffer allocated via dl_ctx before being packed.
+*/
+dl_error_t DL_DLL_EXPORT dl_txt_pack_ex( dl_ctx_t dl_ctx, const char* txt_instance, size_t txt_instance_len, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes );
+
+/*
+	Function: dl_txt_read_func
+		Callback used by dl_txt_pack_stream to read text.
+
+	Parameters:
+		buffer      - Buffer to read text into.
+		buffer_size - Max number of bytes to read into buffer.
+		read_ctx    - Context passed to dl_txt_pack_stream.
+
+	Return:
+		Number of bytes read into buffer, 0 when there is no more text to read.
+*/
+typedef size_t (*dl_txt_read_func)( char* buffer, size_t buffer_size, void* read_ctx );
+
+/*
+	Function: dl_txt_pack_stream
+		Same as dl_txt_pack but with the text read in chunks via read_func while packing and the packed instance
+		written to a buffer that is grown as needed. Only the text of the current token is kept in memory, apart
+		from the "__subdata"-member that is kept from where it is found until packing is done, so peak memory is
+		about the size of the packed instance plus one chunk of text if "__subdata" is last in the root instance,
+		as it is in text written by dl_txt_unpack.
+
+	Parameters:
+		dl_ctx       - Context to use.
+		read_func    - Function called to read the text to pack, see dl_txt_read_func.
+		read_ctx     - Context passed to read_func.
+		alloc_func   - Function used to allocate the packed instance, 0x0 to use malloc.
+		realloc_func - Function used to grow the packed instance, 0x0 to use realloc or alloc_func/free_func.
+		free_func    - Function used to free the packed instance, 0x0 to use free.
+		alloc_ctx    - Context passed to alloc_func, realloc_func and free_func.
+		out_buffer   - Set to the packed instance on success, to be freed with free_func.
+		out_size     - Set to the size of the packed instance.
+
+	Return:
+		DL_ERROR_OK on success, out_buffer is not set on error.
+
+	Note:
+		The instance after pack will be in current platform endian.
+*/
+dl_error_t DL_DLL_EXPORT dl_txt_pack_stream( dl_ctx_t         dl_ctx,
+                                             dl_txt_read_func read_func,   void*           read_ctx,
+                                             dl_alloc_func    alloc_func,  dl_realloc_func realloc_func,
+                                             dl_free_func     free_func,   void*           alloc_ctx,
+                                             unsigned char**  out_buffer,  size_t*         out_size );
+
 /*
 	Function: dl_txt_pack_calc_size
 		Calculate the amount of memory needed to pack intermediate data to binary blob.
@@ -87,6 +155,58 @@ dl_error_t DL_DLL_EXPORT dl_txt_unpack_loaded( dl_ctx_t dl_ctx,              dl_
                                                const void* loaded_instance,  char* out_txt_instance,
 	                                           size_t out_txt_instance_size, size_t* produced_bytes );
 
+/*
+	Function: dl_txt_write_func
+		Callback used by dl_txt_unpack_stream and dl_txt_unpack_loaded_stream to write text.
+
+	Parameters:
+		data      - Text to write, not zero-terminated.
+		data_size - Number of bytes in data.
+		write_ctx - Context passed to dl_txt_unpack_stream or dl_txt_unpack_loaded_stream.
+*/
+typedef void (*dl_txt_write_func)( const char* data, size_t data_size, void* write_ctx );
+
+/*
+	Function: dl_txt_unpack_stream
+		Same as dl_txt_unpack but with the text passed to write_func in fixed-size chunks while unpacking, so the
+		instance is only unpacked once and no buffer the size of the text is needed.
+		The bytes written are the same as written by dl_txt_unpack, including the terminating zero.
+
+	Parameters:
+		dl_ctx                - Context to use.
+		type                  - Type stored in packed_instace.
+		packed_instance       - Buffer with packed data.
+		packed_instance_size  - Size of packed_instance.
+		write_func            - Function called with the unpacked text, see dl_txt_write_func.
+		write_ctx             - Context passed to write_func.
+		produced_bytes        - Number of bytes written via write_func, can be 0x0.
+
+	Note:
+		A stored packed instance to unpack is required to be in current platform endian, if not DL_ERROR_ENDIAN_ERROR will be returned.
+		On error part of the text might already have been passed to write_func.
+*/
+dl_error_t DL_DLL_EXPORT dl_txt_unpack_stream( dl_ctx_t          dl_ctx,          dl_typeid_t type,
+                                               unsigned char*    packed_instance, size_t      packed_instance_size,
+                                               dl_txt_write_func write_func,      void*       write_ctx,
+                                               size_t*           produced_bytes );
+
+/*
+	Function: dl_txt_unpack_loaded_stream
+		Same as dl_txt_unpack_loaded but with the text passed to write_func in fixed-size chunks, see dl_txt_unpack_stream.
+
+	Parameters:
+		dl_ctx          - Context to use.
+		type            - Type stored in loaded_instance.
+		loaded_instance - Buffer with loaded data.
+		write_func      - Function called with the unpacked text, see dl_txt_write_func.
+		write_ctx       - Context passed to write_func.
+		produced_bytes  - Number of bytes written via write_func, can be 0x0.
+*/
+dl_error_t DL_DLL_EXPORT dl_txt_unpack_loaded_stream( dl_ctx_t          dl_ctx,     dl_typeid_t type,
+                                                      const void*       loaded_instance,
+                                                      dl_txt_write_func write_func, void*       write_ctx,
+                                                      size_t*           produced_bytes );
+
 /*
 	Function: dl_txt_unpack_calc_size
 		Calculate the amount of memory needed to unpack packed binary data (with header and offsets) to text-format.
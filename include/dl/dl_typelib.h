@@ -94,6 +94,9 @@ dl_error_t DL_DLL_EXPORT dl_context_write_txt_type_library( dl_ctx_t dl_ctx, cha
 
 	Note:
 		This function do not have the same rules of memory allocation and might allocate memory behind the scenes.
+
+		For C++ the header also contain a read-only view, <type>_view, for each type that is not extern, used to
+		read a packed instance without loading it, see dl_view.h.
 */
 dl_error_t DL_DLL_EXPORT dl_context_write_type_library_c_header( dl_ctx_t dl_ctx, const char* module_name, char* out_header, size_t out_header_size, size_t* produced_bytes );
 
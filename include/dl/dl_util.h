@@ -38,7 +38,8 @@ typedef enum
 
 /*
 	Function: dl_util_load_from_file
-		Utility function that loads a dl-instance from file.
+		Utility function that loads a dl-instance from file. The file is read with one read into one
+		allocation that the instance is then loaded inplace in, if it is in the current platform format.
 
 	Note:
 		This function allocates memory internally by use of malloc/free and should therefore
@@ -65,9 +66,56 @@ dl_error_t DL_DLL_EXPORT dl_util_load_from_file( dl_ctx_t        dl_ctx,
 												 void**          allocated_mem, dl_alloc_func       alloc_func,
 												 dl_free_func    free_func,     void*               alloc_ctx );
 
+/*
+	Struct: dl_util_load_batch_result_t
+		Result of loading one file with dl_util_load_batch.
+
+	Members:
+		error         - Result of loading the file, the same as dl_util_load_from_file would have returned.
+		instance      - Loaded instance.
+		type          - TypeID of instance found in file.
+		allocated_mem - Memory allocated for the instance, to be freed with free_func, if error is DL_ERROR_OK.
+*/
+typedef struct dl_util_load_batch_result
+{
+	dl_error_t  error;
+	void*       instance;
+	dl_typeid_t type;
+	void*       allocated_mem;
+} dl_util_load_batch_result_t;
+
+/*
+	Function: dl_util_load_batch
+		Load many files, as with dl_util_load_from_file, on a number of threads. Each thread picks the next file in
+		filenames that is not yet loaded, so reading one file overlaps with converting and patching others.
+
+	Parameters:
+		dl_ctx       - Context to use for operations, need to be frozen with dl_context_freeze if thread_count is not 1.
+		type         - Type expected to be found in all files, set to 0 if not known.
+		filenames    - Paths to files to load.
+		file_count   - Number of paths in filenames.
+		filetype     - Type of files to read, see dl_util_file_type_t.
+		thread_count - Number of threads to load files on, 0 to use one thread per hardware thread. A thread_count
+		               of 1 loads all files on the calling thread.
+		out_results  - Array of file_count results, filled in the same order as filenames.
+		allocator    - Allocator used for all files. 0x0 / nullpointer is also valid and will default to using malloc
+		               (default behavior of dl). The allocator need to be thread-safe if thread_count is not 1.
+
+	Returns:
+		DL_ERROR_OK if all files was loaded, otherwise the error of the first file in filenames that failed to load.
+		DL_ERROR_UNSUPPORTED_OPERATION is returned without loading anything if dl_ctx is not frozen and thread_count
+		is not 1.
+*/
+dl_error_t DL_DLL_EXPORT dl_util_load_batch( dl_ctx_t                     dl_ctx,       dl_typeid_t         type,
+											 const char* const*           filenames,    size_t              file_count,
+											 dl_util_file_type_t          filetype,     unsigned int        thread_count,
+											 dl_util_load_batch_result_t* out_results,  dl_alloc_func       alloc_func,
+											 dl_free_func                 free_func,    void*               alloc_ctx );
+
 /*
 	Function: dl_util_load_from_stream
-		Utility function that loads an dl-instance from an open stream.
+		Utility function that loads an dl-instance from an open stream. Text is packed while it is read,
+		see dl_txt_pack_stream, so it is never all in memory at once.
 
 	Note:
 		This function allocates memory internally by use of malloc/free and should therefore
@@ -82,7 +130,7 @@ dl_error_t DL_DLL_EXPORT dl_util_load_from_file( dl_ctx_t        dl_ctx,
 		filetype       	- Type of file to read, see dl_util_file_type_t.
 		out_instance   	- Pointer to fill with read instance.
 		out_type       	- TypeID of instance found in file, can be set to 0x0.
-		consumed_bytes 	- Number of bytes read from stream.
+		consumed_bytes 	- Number of bytes read from stream, can be set to 0x0.
 		allocator 		- Allocator for doing temp file allocations. 0x0 / nullpointer is also
 					      valid and will default to using malloc (default behavior of dl).
 
@@ -116,7 +164,7 @@ dl_error_t DL_DLL_EXPORT dl_util_load_from_stream( dl_ctx_t      dl_ctx,
 					    valid and will default to using malloc (default behavior of dl).
 
 	Returns:
-		DL_ERROR_OK on success.
+		DL_ERROR_OK on success, DL_ERROR_UTIL_FILE_WRITE_FAILED if the file could not be written.
 */
 dl_error_t DL_DLL_EXPORT dl_util_store_to_file( dl_ctx_t     dl_ctx,    dl_typeid_t         type,
 											    const char*  filename,  dl_util_file_type_t filetype,
@@ -126,7 +174,8 @@ dl_error_t DL_DLL_EXPORT dl_util_store_to_file( dl_ctx_t     dl_ctx,    dl_typei
 
 /*
 	Function: dl_util_store_to_stream
-		Utility function that writes an instance to an open stream.
+		Utility function that writes an instance to an open stream. Text is written to stream while it is unpacked,
+		see dl_txt_unpack_stream, so it is never all in memory at once.
 
 	Note:
 		This function allocates memory internally by use of malloc/free and should therefore
@@ -144,7 +193,7 @@ dl_error_t DL_DLL_EXPORT dl_util_store_to_file( dl_ctx_t     dl_ctx,    dl_typei
 					    valid and will default to using malloc (default behavior of dl).
 
 	Returns:
-		DL_ERROR_OK on success.
+		DL_ERROR_OK on success, DL_ERROR_UTIL_FILE_WRITE_FAILED if writing to stream failed.
 */
 dl_error_t DL_DLL_EXPORT dl_util_store_to_stream( dl_ctx_t        dl_ctx,    dl_typeid_t         type,
 												  FILE*           stream,    dl_util_file_type_t filetype,
@@ -0,0 +1,111 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#ifndef DL_DL_VIEW_H_INCLUDED
+#define DL_DL_VIEW_H_INCLUDED
+
+/*
+	File: dl_view.h
+		Read-only views of packed instances. A view reads a packed instance where it is stored without loading
+		it, pointers are resolved when a member or array-element is read instead of all being patched up front
+		by dl_instance_load_inplace. Viewing an instance is O(1) so this is useful when only a small part of a
+		large instance is read.
+
+		Headers generated by dl_context_write_type_library_c_header also contain a typed C++ view for each type,
+		named <type>_view, that resolves pointers the same way.
+*/
+
+#include <dl/dl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+	Struct: dl_view_t
+		View of a value in a packed instance.
+
+	Members:
+		packed_instance - Packed instance the value is stored in, pointers in the instance are offsets from here.
+		packed_size     - Size of the data in packed_instance that offsets are allowed to point into.
+		data            - The value, the first element for arrays. Pointers and strings are resolved, i.e. data
+		                  points to the struct pointed to or the first char of the string. 0x0 for null-pointers,
+		                  null-strings and empty arrays.
+		type_id         - Type of the value if storage is DL_TYPE_STORAGE_STRUCT, DL_TYPE_STORAGE_PTR or an enum.
+		atom            - DL_TYPE_ATOM_POD for single values, DL_TYPE_ATOM_ARRAY or DL_TYPE_ATOM_INLINE_ARRAY for arrays.
+		storage         - Storage of the value, of the elements for arrays.
+		count           - Number of elements for arrays, 1 otherwise.
+*/
+typedef struct dl_view
+{
+	const unsigned char* packed_instance;
+	size_t               packed_size;
+	const void*          data;
+	dl_typeid_t          type_id;
+	dl_type_atom_t       atom;
+	dl_type_storage_t    storage;
+	unsigned int         count;
+} dl_view_t;
+
+/*
+	Function: dl_view_instance
+		Create a view of the root instance of a packed instance without loading it.
+
+	Parameters:
+		dl_ctx               - Context to use.
+		type                 - Type expected to be stored in packed_instance.
+		packed_instance      - Buffer with packed data, has to stay valid and unchanged as long as the view is used.
+		packed_instance_size - Size of packed_instance.
+		out_view             - View of the root instance.
+
+	Return:
+		DL_ERROR_OK on success. DL_ERROR_UNSUPPORTED_OPERATION is returned for instances stored with
+		dl_instance_make_relative, use the generated _rel_-accessors for those, and for instances stored with the
+		old pointer-chain as the chain is stored in the pointers themselves.
+
+	Note:
+		Packed instance to view is required to be in current platform endian, if not DL_ERROR_ENDIAN_MISMATCH will be returned.
+		Only the header is checked, call dl_instance_validate first if packed_instance is not trusted. Offsets are
+		checked to be within the instance when resolved but strings are expected to be zero-terminated.
+*/
+dl_error_t DL_DLL_EXPORT dl_view_instance( dl_ctx_t             dl_ctx,          dl_typeid_t type,
+                                           const unsigned char* packed_instance, size_t      packed_instance_size,
+                                           dl_view_t*           out_view );
+
+/*
+	Function: dl_view_member
+		Create a view of a member of a struct viewed by view.
+
+	Parameters:
+		dl_ctx       - Context to use.
+		view         - View of a struct.
+		member_index - Index of the member, same order as returned by dl_reflect_get_type_members.
+		out_view     - View of the member.
+
+	Return:
+		DL_ERROR_OK on success. DL_ERROR_INVALID_PARAMETER is returned if view is not a view of a struct, if the
+		struct is a null-pointer, if member_index is out of range or if the member is not the member set in a union.
+		DL_ERROR_UNSUPPORTED_OPERATION is returned for bitfield-members, read them from view->data.
+*/
+dl_error_t DL_DLL_EXPORT dl_view_member( dl_ctx_t dl_ctx, const dl_view_t* view, unsigned int member_index, dl_view_t* out_view );
+
+/*
+	Function: dl_view_array_elem
+		Create a view of an element of an array viewed by view.
+
+	Parameters:
+		dl_ctx   - Context to use.
+		view     - View of an array.
+		index    - Index of the element.
+		out_view - View of the element.
+
+	Return:
+		DL_ERROR_OK on success. DL_ERROR_INVALID_PARAMETER is returned if view is not a view of an array or index
+		is out of range.
+*/
+dl_error_t DL_DLL_EXPORT dl_view_array_elem( dl_ctx_t dl_ctx, const dl_view_t* view, unsigned int index, dl_view_t* out_view );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DL_DL_VIEW_H_INCLUDED
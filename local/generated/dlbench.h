@@ -0,0 +1,564 @@
+/* Auto generated header for dl type library */
+#ifndef __DL_AUTOGEN_HEADER_DLBENCH_H_INCLUDED
+#define __DL_AUTOGEN_HEADER_DLBENCH_H_INCLUDED
+
+#include <stdint.h>
+
+#include <stddef.h> // for size_t and offsetof
+
+#ifndef __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+#define __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+#  if !defined(__cplusplus)
+#    define DL_SIZED_ENUM_SUPPORTED 0
+#  else
+#    if defined(_MSC_VER)
+#      if _MSC_VER < 1900
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      else
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      endif
+#    else
+       // this would need more work but it is good enough for now
+#      define DL_SIZED_ENUM_SUPPORTED 1
+#    endif
+#  endif
+
+   /// ... DL_C_STRUCT ...
+   /// The macro DL_C_STRUCT is used on external types to add struct in c
+   /// where it is needed. In c++ this is skipped as it is not needed and
+   /// could be something else such as a class or typedef.
+#  if defined(__cplusplus)
+#    define DL_C_STRUCT
+#  else
+#    define DL_C_STRUCT struct
+#  endif
+
+   /// ... DL_C_ENUM ...
+   /// Same concept as DL_C_STRUCT
+#  if defined(__cplusplus)
+#    define DL_C_ENUM
+#  else
+#    define DL_C_ENUM enum
+#  endif
+
+   /// ... DL_ALIGN() ...
+#  if defined(_MSC_VER)
+#    define DL_ALIGN(x) __declspec(align(x))
+#  elif defined(__GNUC__)
+#    define DL_ALIGN(x) __attribute__((aligned(x)))
+#  else
+#    error "Unsupported compiler"
+#  endif
+
+   /// ... DL_ALIGNOF() ...
+#  if defined(__clang__)
+#    if __has_feature(cxx_alignof)
+#      define DL_ALIGNOF(type) alignof(type)
+#    elif __has_feature(c_alignof)
+#      define DL_ALIGNOF(type) _Alignof(type)
+#    endif
+#  elif defined(__GNUC__)
+#    define DL_ALIGNOF(type) __alignof__(type)
+#  endif
+#  if defined(_MSC_VER )
+#    define DL_ALIGNOF(type) __alignof(type)
+#  endif
+
+#  ifndef DL_ALIGNOF
+#    define DL_ALIGNOF(type) ((sizeof(type) > 1)? offsetof(struct { char c; type x; }, x) : 1)
+#  endif
+
+   // ... DL_STATIC_ASSERT() ...
+   // ... clang ...
+#  if defined( __clang__ )
+#    if defined( __cplusplus ) && __has_feature(cxx_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    elif __has_feature(c_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#    endif
+   // ... msvc ...
+#  elif defined( _MSC_VER ) && ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#    define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+   // ... gcc ...
+#  elif defined( __cplusplus )
+#    if __cplusplus >= 201103L || ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    endif
+#  elif defined( __STDC__ )
+#    if defined( __STDC_VERSION__ )
+#      if __STDC_VERSION__ >= 201112L
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      else
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      endif
+#    endif
+#  endif
+#  if !defined(DL_STATIC_ASSERT)
+#    define DL_STATIC_ASSERT(x,y) // default to non-implemented.
+#  endif
+
+   // ... DL_DATA_ASSERT() ...
+#  if !defined(DL_DATA_ASSERT)
+#    define DL_DATA_ASSERT(x) // default to non-implemented.
+#  endif
+
+   // ... DL_DECLARE_ARRAY ...
+#  if defined(__cplusplus)
+	  template <typename T>
+	  struct dl_array
+	  {
+		   inline const T& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline T& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const T* begin() const
+		   {
+		       return data;
+		   }
+		   inline const T* end() const
+		   {
+		       return data + count;
+		   }
+		   inline T* begin()
+		   {
+		       return data;
+		   }
+		   inline T* end()
+		   {
+		       return data + count;
+		   }
+		   T* data;
+		   uint32_t count;
+	   };
+	   template <>
+	   struct dl_array<const char*> {
+		   inline const char*& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char*& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char* const* begin() const
+		   {
+		       return data;
+		   }
+		   inline const char* const* end() const
+		   {
+		       return data + count;
+		   }
+		   inline const char** begin()
+		   {
+		       return data;
+		   }
+		   inline const char** end()
+		   {
+		       return data + count;
+		   }
+		   const char** data;
+		   uint32_t count;
+	   };
+#	 define DL_DECLARE_ARRAY(type) dl_array<type>
+#  else
+#	 define DL_DECLARE_ARRAY(type)  \
+       struct              \
+       {                   \
+           type* data;     \
+           uint32_t count; \
+       }
+#  endif
+
+   // ... DL_REL_PTR() ...
+   /// Read a pointer-, string- or array-member of an instance stored with relative pointers, see
+   /// dl_instance_make_relative(). The member store the distance in bytes from itself to the data, 0 for null.
+#  define DL_REL_PTR(type, member) ((type)( (intptr_t)(member) == 0 ? 0 : (const char*)&(member) + (intptr_t)(member) ))
+
+   // ... DL_VIEW_PTR() ...
+   /// Read a pointer-, string- or array-member of a packed instance that is not loaded, see dl_view_instance(). The
+   /// member store the offset in bytes from the start of the packed instance to the data, 0 for null.
+#  define DL_VIEW_PTR(type, packed_instance, member) ((type)( (uintptr_t)(member) == 0 ? 0 : (const unsigned char*)(packed_instance) + (uintptr_t)(member) ))
+#endif // __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+//----------------------------------------------
+//                   TYPEID:s                   
+//----------------------------------------------
+
+// TYPES
+#define fp32_array_TYPE_ID (0xC7082619)
+#define fp64_array_TYPE_ID (0x25C21E3E)
+#define i32_array_TYPE_ID (0xB7D9E74C)
+#define u16_array_TYPE_ID (0x89147C9A)
+#define fp32_array_array_TYPE_ID (0x83115657)
+#define str_array_TYPE_ID (0x7FFC8EB7)
+#define wide_struct_TYPE_ID (0xEDFE044D)
+#define wide_struct_array_TYPE_ID (0xF14A0B8B)
+#define ptr_graph_node_TYPE_ID (0xE4FB06CC)
+#define ptr_graph_TYPE_ID (0x22F38847)
+#define few_ptrs_struct_TYPE_ID (0xEB56122E)
+#define few_ptrs_struct_array_TYPE_ID (0xEDA73E2C)
+
+
+//----------------------------------------------
+//                   TYPES:s                    
+//----------------------------------------------
+
+struct fp32_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xC7082619;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(float) arr;
+};
+
+static inline const float* fp32_array_rel_arr( const struct fp32_array* s ) { return DL_REL_PTR( const float*, s->arr.data ); }
+
+struct fp64_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x25C21E3E;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(double) arr;
+};
+
+static inline const double* fp64_array_rel_arr( const struct fp64_array* s ) { return DL_REL_PTR( const double*, s->arr.data ); }
+
+struct i32_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xB7D9E74C;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int32_t) arr;
+};
+
+static inline const int32_t* i32_array_rel_arr( const struct i32_array* s ) { return DL_REL_PTR( const int32_t*, s->arr.data ); }
+
+struct u16_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x89147C9A;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint16_t) arr;
+};
+
+static inline const uint16_t* u16_array_rel_arr( const struct u16_array* s ) { return DL_REL_PTR( const uint16_t*, s->arr.data ); }
+
+struct fp32_array_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x83115657;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct fp32_array) arr;
+};
+
+static inline const struct fp32_array* fp32_array_array_rel_arr( const struct fp32_array_array* s ) { return DL_REL_PTR( const struct fp32_array*, s->arr.data ); }
+
+struct str_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7FFC8EB7;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) arr;
+};
+
+static inline const char* str_array_rel_arr( const struct str_array* s, uint32_t i ) { const char* const* data = DL_REL_PTR( const char* const*, s->arr.data ); return DL_REL_PTR( const char*, data[i] ); }
+
+struct wide_struct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xEDFE044D;
+#endif // defined( __cplusplus )
+
+    uint32_t member_00; 
+    uint32_t member_01; 
+    uint32_t member_02; 
+    uint32_t member_03; 
+    uint32_t member_04; 
+    uint32_t member_05; 
+    uint32_t member_06; 
+    uint32_t member_07; 
+    uint32_t member_08; 
+    uint32_t member_09; 
+    uint32_t member_10; 
+    uint32_t member_11; 
+    uint32_t member_12; 
+    uint32_t member_13; 
+    uint32_t member_14; 
+    uint32_t member_15; 
+    uint32_t member_16; 
+    uint32_t member_17; 
+    uint32_t member_18; 
+    uint32_t member_19; 
+    uint32_t member_20; 
+    uint32_t member_21; 
+    uint32_t member_22; 
+    uint32_t member_23; 
+    uint32_t member_24; 
+    uint32_t member_25; 
+    uint32_t member_26; 
+    uint32_t member_27; 
+    uint32_t member_28; 
+    uint32_t member_29; 
+    uint32_t member_30; 
+    uint32_t member_31; 
+};
+
+struct wide_struct_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF14A0B8B;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct wide_struct) arr;
+};
+
+static inline const struct wide_struct* wide_struct_array_rel_arr( const struct wide_struct_array* s ) { return DL_REL_PTR( const struct wide_struct*, s->arr.data ); }
+
+struct ptr_graph_node
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xE4FB06CC;
+#endif // defined( __cplusplus )
+
+    uint32_t value; 
+    const struct ptr_graph_node* link;
+};
+
+static inline const struct ptr_graph_node* ptr_graph_node_rel_link( const struct ptr_graph_node* s ) { return DL_REL_PTR( const struct ptr_graph_node*, s->link ); }
+
+struct ptr_graph
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x22F38847;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct ptr_graph_node*) nodes;
+};
+
+static inline const struct ptr_graph_node* ptr_graph_rel_nodes( const struct ptr_graph* s, uint32_t i ) { struct ptr_graph_node* const* data = DL_REL_PTR( struct ptr_graph_node* const*, s->nodes.data ); return DL_REL_PTR( const struct ptr_graph_node*, data[i] ); }
+
+struct few_ptrs_struct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xEB56122E;
+#endif // defined( __cplusplus )
+
+    float pos[3];
+    float rot[4];
+    uint32_t id; 
+    const char* name; 
+};
+
+static inline const char* few_ptrs_struct_rel_name( const struct few_ptrs_struct* s ) { return DL_REL_PTR( const char*, s->name ); }
+
+struct few_ptrs_struct_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xEDA73E2C;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct few_ptrs_struct) arr;
+};
+
+static inline const struct few_ptrs_struct* few_ptrs_struct_array_rel_arr( const struct few_ptrs_struct_array* s ) { return DL_REL_PTR( const struct few_ptrs_struct*, s->arr.data ); }
+
+#if defined( __cplusplus )
+//----------------------------------------------
+//                   VIEWS                      
+//----------------------------------------------
+
+// Read-only views of a packed instance that is not loaded, pointers are resolved when read. Create the view
+// of the root instance from a dl_view_t returned by dl_view_instance(), { view.packed_instance, (const T*)view.data }.
+
+struct fp32_array_view;
+struct fp64_array_view;
+struct i32_array_view;
+struct u16_array_view;
+struct fp32_array_array_view;
+struct str_array_view;
+struct wide_struct_view;
+struct wide_struct_array_view;
+struct ptr_graph_node_view;
+struct ptr_graph_view;
+struct few_ptrs_struct_view;
+struct few_ptrs_struct_array_view;
+
+struct fp32_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct fp32_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    float arr( uint32_t i ) const { return DL_VIEW_PTR( float const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct fp64_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct fp64_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    double arr( uint32_t i ) const { return DL_VIEW_PTR( double const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct i32_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct i32_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    int32_t arr( uint32_t i ) const { return DL_VIEW_PTR( int32_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct u16_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct u16_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    uint16_t arr( uint32_t i ) const { return DL_VIEW_PTR( uint16_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct fp32_array_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct fp32_array_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    fp32_array_view arr( uint32_t i ) const;
+};
+
+struct str_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct str_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    const char* arr( uint32_t i ) const { return DL_VIEW_PTR( const char*, dl_packed_instance, DL_VIEW_PTR( const char* const*, dl_packed_instance, dl_data->arr.data )[i] ); }
+};
+
+struct wide_struct_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct wide_struct* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t member_00() const { return dl_data->member_00; }
+    uint32_t member_01() const { return dl_data->member_01; }
+    uint32_t member_02() const { return dl_data->member_02; }
+    uint32_t member_03() const { return dl_data->member_03; }
+    uint32_t member_04() const { return dl_data->member_04; }
+    uint32_t member_05() const { return dl_data->member_05; }
+    uint32_t member_06() const { return dl_data->member_06; }
+    uint32_t member_07() const { return dl_data->member_07; }
+    uint32_t member_08() const { return dl_data->member_08; }
+    uint32_t member_09() const { return dl_data->member_09; }
+    uint32_t member_10() const { return dl_data->member_10; }
+    uint32_t member_11() const { return dl_data->member_11; }
+    uint32_t member_12() const { return dl_data->member_12; }
+    uint32_t member_13() const { return dl_data->member_13; }
+    uint32_t member_14() const { return dl_data->member_14; }
+    uint32_t member_15() const { return dl_data->member_15; }
+    uint32_t member_16() const { return dl_data->member_16; }
+    uint32_t member_17() const { return dl_data->member_17; }
+    uint32_t member_18() const { return dl_data->member_18; }
+    uint32_t member_19() const { return dl_data->member_19; }
+    uint32_t member_20() const { return dl_data->member_20; }
+    uint32_t member_21() const { return dl_data->member_21; }
+    uint32_t member_22() const { return dl_data->member_22; }
+    uint32_t member_23() const { return dl_data->member_23; }
+    uint32_t member_24() const { return dl_data->member_24; }
+    uint32_t member_25() const { return dl_data->member_25; }
+    uint32_t member_26() const { return dl_data->member_26; }
+    uint32_t member_27() const { return dl_data->member_27; }
+    uint32_t member_28() const { return dl_data->member_28; }
+    uint32_t member_29() const { return dl_data->member_29; }
+    uint32_t member_30() const { return dl_data->member_30; }
+    uint32_t member_31() const { return dl_data->member_31; }
+};
+
+struct wide_struct_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct wide_struct_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    wide_struct_view arr( uint32_t i ) const;
+};
+
+struct ptr_graph_node_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct ptr_graph_node* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t value() const { return dl_data->value; }
+    ptr_graph_node_view link() const;
+};
+
+struct ptr_graph_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct ptr_graph* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t nodes_count() const { return dl_data->nodes.count; }
+    ptr_graph_node_view nodes( uint32_t i ) const;
+};
+
+struct few_ptrs_struct_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct few_ptrs_struct* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t pos_count() const { return 3; }
+    float pos( uint32_t i ) const { return dl_data->pos[i]; }
+    uint32_t rot_count() const { return 4; }
+    float rot( uint32_t i ) const { return dl_data->rot[i]; }
+    uint32_t id() const { return dl_data->id; }
+    const char* name() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->name ); }
+};
+
+struct few_ptrs_struct_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct few_ptrs_struct_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    few_ptrs_struct_view arr( uint32_t i ) const;
+};
+
+inline fp32_array_view fp32_array_array_view::arr( uint32_t i ) const { return fp32_array_view{ dl_packed_instance, &DL_VIEW_PTR( struct fp32_array const*, dl_packed_instance, dl_data->arr.data )[i] }; }
+inline wide_struct_view wide_struct_array_view::arr( uint32_t i ) const { return wide_struct_view{ dl_packed_instance, &DL_VIEW_PTR( struct wide_struct const*, dl_packed_instance, dl_data->arr.data )[i] }; }
+inline ptr_graph_node_view ptr_graph_node_view::link() const { return ptr_graph_node_view{ dl_packed_instance, DL_VIEW_PTR( const struct ptr_graph_node*, dl_packed_instance, dl_data->link ) }; }
+inline ptr_graph_node_view ptr_graph_view::nodes( uint32_t i ) const { return ptr_graph_node_view{ dl_packed_instance, DL_VIEW_PTR( const struct ptr_graph_node*, dl_packed_instance, DL_VIEW_PTR( struct ptr_graph_node* const*, dl_packed_instance, dl_data->nodes.data )[i] ) }; }
+inline few_ptrs_struct_view few_ptrs_struct_array_view::arr( uint32_t i ) const { return few_ptrs_struct_view{ dl_packed_instance, &DL_VIEW_PTR( struct few_ptrs_struct const*, dl_packed_instance, dl_data->arr.data )[i] }; }
+
+#endif // defined( __cplusplus )
+
+#endif // __DL_AUTOGEN_HEADER_DLBENCH_H_INCLUDED
+
@@ -0,0 +1,175 @@
+0x7b, 0x0a, 0x09, 0x22, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62,
+0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b, 0x22, 0x2c, 0x0a, 0x09, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x73, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x66, 0x70, 0x33, 0x32,
+0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22,
+0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33,
+0x32, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x22, 0x66, 0x70, 0x36, 0x34, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x36, 0x34, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x69, 0x33,
+0x32, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72,
+0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69,
+0x6e, 0x74, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x75, 0x31, 0x36, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79,
+0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61,
+0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5b, 0x5d,
+0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22,
+0x66, 0x70, 0x33, 0x32, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x66, 0x70, 0x33, 0x32, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5b, 0x5d, 0x22, 0x20, 0x7d,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x74, 0x72, 0x5f, 0x61, 0x72, 0x72,
+0x61, 0x79, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22,
+0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+0x5b, 0x5d, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x22, 0x77, 0x69, 0x64, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x30, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x31, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x32, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x33, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x34, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x35, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x36, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x37, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x38, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x30, 0x39, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x30, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x31, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x32, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x33, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x34, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x35, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x36, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x37, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x38, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x31, 0x39, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x30, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x31, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x32, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x33, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x34, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x35, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x36, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x37, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x38, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x32, 0x39, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x33, 0x30, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x33, 0x31, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x77,
+0x69, 0x64, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x77, 0x69, 0x64, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5b, 0x5d, 0x22, 0x20,
+0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x70, 0x74, 0x72, 0x5f, 0x67, 0x72,
+0x61, 0x70, 0x68, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x6c, 0x69, 0x6e, 0x6b, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x74, 0x72, 0x5f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x6e,
+0x6f, 0x64, 0x65, 0x2a, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22,
+0x70, 0x74, 0x72, 0x5f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x70, 0x74, 0x72, 0x5f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x6e, 0x6f, 0x64,
+0x65, 0x2a, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22,
+0x66, 0x65, 0x77, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22,
+0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x70, 0x6f, 0x73, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x72, 0x6f, 0x74, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x66, 0x70, 0x33, 0x32, 0x5b, 0x34, 0x5d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x64, 0x22, 0x2c,
+0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x33, 0x32, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22,
+0x20, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x66, 0x65,
+0x77, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x61, 0x72,
+0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x66, 0x65, 0x77, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x5f, 0x73, 0x74, 0x72, 0x75,
+0x63, 0x74, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x7d
\ No newline at end of file
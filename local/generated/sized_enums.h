@@ -0,0 +1,469 @@
+/* Auto generated header for dl type library */
+#ifndef __DL_AUTOGEN_HEADER_SIZED_ENUMS_H_INCLUDED
+#define __DL_AUTOGEN_HEADER_SIZED_ENUMS_H_INCLUDED
+
+#include <stdint.h>
+
+#include <stddef.h> // for size_t and offsetof
+
+#ifndef __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+#define __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+#  if !defined(__cplusplus)
+#    define DL_SIZED_ENUM_SUPPORTED 0
+#  else
+#    if defined(_MSC_VER)
+#      if _MSC_VER < 1900
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      else
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      endif
+#    else
+       // this would need more work but it is good enough for now
+#      define DL_SIZED_ENUM_SUPPORTED 1
+#    endif
+#  endif
+
+   /// ... DL_C_STRUCT ...
+   /// The macro DL_C_STRUCT is used on external types to add struct in c
+   /// where it is needed. In c++ this is skipped as it is not needed and
+   /// could be something else such as a class or typedef.
+#  if defined(__cplusplus)
+#    define DL_C_STRUCT
+#  else
+#    define DL_C_STRUCT struct
+#  endif
+
+   /// ... DL_C_ENUM ...
+   /// Same concept as DL_C_STRUCT
+#  if defined(__cplusplus)
+#    define DL_C_ENUM
+#  else
+#    define DL_C_ENUM enum
+#  endif
+
+   /// ... DL_ALIGN() ...
+#  if defined(_MSC_VER)
+#    define DL_ALIGN(x) __declspec(align(x))
+#  elif defined(__GNUC__)
+#    define DL_ALIGN(x) __attribute__((aligned(x)))
+#  else
+#    error "Unsupported compiler"
+#  endif
+
+   /// ... DL_ALIGNOF() ...
+#  if defined(__clang__)
+#    if __has_feature(cxx_alignof)
+#      define DL_ALIGNOF(type) alignof(type)
+#    elif __has_feature(c_alignof)
+#      define DL_ALIGNOF(type) _Alignof(type)
+#    endif
+#  elif defined(__GNUC__)
+#    define DL_ALIGNOF(type) __alignof__(type)
+#  endif
+#  if defined(_MSC_VER )
+#    define DL_ALIGNOF(type) __alignof(type)
+#  endif
+
+#  ifndef DL_ALIGNOF
+#    define DL_ALIGNOF(type) ((sizeof(type) > 1)? offsetof(struct { char c; type x; }, x) : 1)
+#  endif
+
+   // ... DL_STATIC_ASSERT() ...
+   // ... clang ...
+#  if defined( __clang__ )
+#    if defined( __cplusplus ) && __has_feature(cxx_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    elif __has_feature(c_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#    endif
+   // ... msvc ...
+#  elif defined( _MSC_VER ) && ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#    define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+   // ... gcc ...
+#  elif defined( __cplusplus )
+#    if __cplusplus >= 201103L || ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    endif
+#  elif defined( __STDC__ )
+#    if defined( __STDC_VERSION__ )
+#      if __STDC_VERSION__ >= 201112L
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      else
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      endif
+#    endif
+#  endif
+#  if !defined(DL_STATIC_ASSERT)
+#    define DL_STATIC_ASSERT(x,y) // default to non-implemented.
+#  endif
+
+   // ... DL_DATA_ASSERT() ...
+#  if !defined(DL_DATA_ASSERT)
+#    define DL_DATA_ASSERT(x) // default to non-implemented.
+#  endif
+
+   // ... DL_DECLARE_ARRAY ...
+#  if defined(__cplusplus)
+	  template <typename T>
+	  struct dl_array
+	  {
+		   inline const T& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline T& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const T* begin() const
+		   {
+		       return data;
+		   }
+		   inline const T* end() const
+		   {
+		       return data + count;
+		   }
+		   inline T* begin()
+		   {
+		       return data;
+		   }
+		   inline T* end()
+		   {
+		       return data + count;
+		   }
+		   T* data;
+		   uint32_t count;
+	   };
+	   template <>
+	   struct dl_array<const char*> {
+		   inline const char*& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char*& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char* const* begin() const
+		   {
+		       return data;
+		   }
+		   inline const char* const* end() const
+		   {
+		       return data + count;
+		   }
+		   inline const char** begin()
+		   {
+		       return data;
+		   }
+		   inline const char** end()
+		   {
+		       return data + count;
+		   }
+		   const char** data;
+		   uint32_t count;
+	   };
+#	 define DL_DECLARE_ARRAY(type) dl_array<type>
+#  else
+#	 define DL_DECLARE_ARRAY(type)  \
+       struct              \
+       {                   \
+           type* data;     \
+           uint32_t count; \
+       }
+#  endif
+
+   // ... DL_REL_PTR() ...
+   /// Read a pointer-, string- or array-member of an instance stored with relative pointers, see
+   /// dl_instance_make_relative(). The member store the distance in bytes from itself to the data, 0 for null.
+#  define DL_REL_PTR(type, member) ((type)( (intptr_t)(member) == 0 ? 0 : (const char*)&(member) + (intptr_t)(member) ))
+
+   // ... DL_VIEW_PTR() ...
+   /// Read a pointer-, string- or array-member of a packed instance that is not loaded, see dl_view_instance(). The
+   /// member store the offset in bytes from the start of the packed instance to the data, 0 for null.
+#  define DL_VIEW_PTR(type, packed_instance, member) ((type)( (uintptr_t)(member) == 0 ? 0 : (const unsigned char*)(packed_instance) + (uintptr_t)(member) ))
+#endif // __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+//----------------------------------------------
+//                   TYPEID:s                   
+//----------------------------------------------
+
+// ENUMS
+#define enum_int8_TYPE_ID (0x9F112337)
+#define enum_int16_TYPE_ID (0x81382A06)
+#define enum_int32_TYPE_ID (0x81382A44)
+#define enum_int64_TYPE_ID (0x81382AA9)
+#define enum_uint8_TYPE_ID (0x820E814C)
+#define enum_uint16_TYPE_ID (0xC3E14ABB)
+#define enum_uint32_TYPE_ID (0xC3E14AF9)
+#define enum_uint64_TYPE_ID (0xC3E14B5E)
+
+// TYPES
+#define sized_enums_TYPE_ID (0x2C6748C6)
+#define sized_enums_inl_array_TYPE_ID (0xB10A6306)
+#define sized_enums_array_TYPE_ID (0x74DD06C4)
+
+
+//----------------------------------------------
+//                   ENUMS:s                    
+//----------------------------------------------
+
+#if DL_SIZED_ENUM_SUPPORTED
+
+typedef enum enum_int8 : int8_t
+{
+    int8_1 = 2,
+    int8_neg = -1,
+    int8_min = INT8_MIN,
+    int8_max = INT8_MAX
+} enum_int8;
+
+typedef enum enum_int16 : int16_t
+{
+    int16_1 = 3,
+    int16_neg = -1,
+    int16_min = INT16_MIN,
+    int16_max = INT16_MAX
+} enum_int16;
+
+typedef enum enum_int32 : int32_t
+{
+    int32_1 = 4,
+    int32_neg = -1,
+    int32_min = INT32_MIN,
+    int32_max = INT32_MAX
+} enum_int32;
+
+typedef enum enum_int64 : int64_t
+{
+    int64_1 = 5,
+    int64_neg = -1,
+    int64_min = INT64_MIN,
+    int64_max = INT64_MAX
+} enum_int64;
+
+typedef enum enum_uint8 : uint8_t
+{
+    uint8_1 = 6,
+    uint8_min = 0,
+    uint8_max = UINT8_MAX
+} enum_uint8;
+
+typedef enum enum_uint16 : uint16_t
+{
+    uint16_1 = 7,
+    uint16_min = 0,
+    uint16_max = UINT16_MAX
+} enum_uint16;
+
+typedef enum enum_uint32
+{
+    uint32_1 = 8,
+    uint32_min = 0,
+    uint32_max = UINT32_MAX
+} enum_uint32;
+
+typedef enum enum_uint64 : uint64_t
+{
+    uint64_1 = 9,
+    uint64_min = 0,
+    uint64_max = UINT64_MAX
+} enum_uint64;
+
+#else // DL_SIZED_ENUM_SUPPORTED
+
+typedef int8_t enum_int8;
+static const enum_int8 int8_1 = 2;
+static const enum_int8 int8_neg = -1;
+static const enum_int8 int8_min = INT8_MIN;
+static const enum_int8 int8_max = INT8_MAX;
+
+typedef int16_t enum_int16;
+static const enum_int16 int16_1 = 3;
+static const enum_int16 int16_neg = -1;
+static const enum_int16 int16_min = INT16_MIN;
+static const enum_int16 int16_max = INT16_MAX;
+
+typedef int32_t enum_int32;
+static const enum_int32 int32_1 = 4;
+static const enum_int32 int32_neg = -1;
+static const enum_int32 int32_min = INT32_MIN;
+static const enum_int32 int32_max = INT32_MAX;
+
+typedef int64_t enum_int64;
+static const enum_int64 int64_1 = 5;
+static const enum_int64 int64_neg = -1;
+static const enum_int64 int64_min = INT64_MIN;
+static const enum_int64 int64_max = INT64_MAX;
+
+typedef uint8_t enum_uint8;
+static const enum_uint8 uint8_1 = 6;
+static const enum_uint8 uint8_min = 0;
+static const enum_uint8 uint8_max = UINT8_MAX;
+
+typedef uint16_t enum_uint16;
+static const enum_uint16 uint16_1 = 7;
+static const enum_uint16 uint16_min = 0;
+static const enum_uint16 uint16_max = UINT16_MAX;
+
+typedef enum enum_uint32
+{
+    uint32_1 = 8,
+    uint32_min = 0,
+    uint32_max = UINT32_MAX
+} enum_uint32;
+
+typedef uint64_t enum_uint64;
+static const enum_uint64 uint64_1 = 9;
+static const enum_uint64 uint64_min = 0;
+static const enum_uint64 uint64_max = UINT64_MAX;
+
+#endif // DL_SIZED_ENUM_SUPPORTED
+
+//----------------------------------------------
+//                   TYPES:s                    
+//----------------------------------------------
+
+struct sized_enums
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x2C6748C6;
+#endif // defined( __cplusplus )
+
+    enum_int8 e_int8;
+    enum_int16 e_int16;
+    enum_int32 e_int32;
+    DL_ALIGN(8) enum_int64 e_int64;
+    enum_uint8 e_uint8;
+    enum_uint16 e_uint16;
+    DL_C_ENUM enum_uint32 e_uint32;
+    DL_ALIGN(8) enum_uint64 e_uint64;
+};
+
+struct sized_enums_inl_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xB10A6306;
+#endif // defined( __cplusplus )
+
+    enum_int8 e_int8[4];
+    enum_int16 e_int16[4];
+    enum_int32 e_int32[4];
+    DL_ALIGN(8) enum_int64 e_int64[4];
+    enum_uint8 e_uint8[3];
+    enum_uint16 e_uint16[3];
+    enum_uint32 e_uint32[3];
+    DL_ALIGN(8) enum_uint64 e_uint64[3];
+};
+
+struct sized_enums_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x74DD06C4;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(enum_int8) e_int8;
+    DL_DECLARE_ARRAY(enum_int16) e_int16;
+    DL_DECLARE_ARRAY(enum_int32) e_int32;
+    DL_DECLARE_ARRAY(enum_int64) e_int64;
+    DL_DECLARE_ARRAY(enum_uint8) e_uint8;
+    DL_DECLARE_ARRAY(enum_uint16) e_uint16;
+    DL_DECLARE_ARRAY(enum_uint32) e_uint32;
+    DL_DECLARE_ARRAY(enum_uint64) e_uint64;
+};
+
+static inline const enum_int8* sized_enums_array_rel_e_int8( const struct sized_enums_array* s ) { return DL_REL_PTR( const enum_int8*, s->e_int8.data ); }
+static inline const enum_int16* sized_enums_array_rel_e_int16( const struct sized_enums_array* s ) { return DL_REL_PTR( const enum_int16*, s->e_int16.data ); }
+static inline const enum_int32* sized_enums_array_rel_e_int32( const struct sized_enums_array* s ) { return DL_REL_PTR( const enum_int32*, s->e_int32.data ); }
+static inline const enum_int64* sized_enums_array_rel_e_int64( const struct sized_enums_array* s ) { return DL_REL_PTR( const enum_int64*, s->e_int64.data ); }
+static inline const enum_uint8* sized_enums_array_rel_e_uint8( const struct sized_enums_array* s ) { return DL_REL_PTR( const enum_uint8*, s->e_uint8.data ); }
+static inline const enum_uint16* sized_enums_array_rel_e_uint16( const struct sized_enums_array* s ) { return DL_REL_PTR( const enum_uint16*, s->e_uint16.data ); }
+static inline const enum_uint32* sized_enums_array_rel_e_uint32( const struct sized_enums_array* s ) { return DL_REL_PTR( const enum_uint32*, s->e_uint32.data ); }
+static inline const enum_uint64* sized_enums_array_rel_e_uint64( const struct sized_enums_array* s ) { return DL_REL_PTR( const enum_uint64*, s->e_uint64.data ); }
+
+#if defined( __cplusplus )
+//----------------------------------------------
+//                   VIEWS                      
+//----------------------------------------------
+
+// Read-only views of a packed instance that is not loaded, pointers are resolved when read. Create the view
+// of the root instance from a dl_view_t returned by dl_view_instance(), { view.packed_instance, (const T*)view.data }.
+
+struct sized_enums_view;
+struct sized_enums_inl_array_view;
+struct sized_enums_array_view;
+
+struct sized_enums_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct sized_enums* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    enum_int8 e_int8() const { return dl_data->e_int8; }
+    enum_int16 e_int16() const { return dl_data->e_int16; }
+    enum_int32 e_int32() const { return dl_data->e_int32; }
+    enum_int64 e_int64() const { return dl_data->e_int64; }
+    enum_uint8 e_uint8() const { return dl_data->e_uint8; }
+    enum_uint16 e_uint16() const { return dl_data->e_uint16; }
+    enum_uint32 e_uint32() const { return dl_data->e_uint32; }
+    enum_uint64 e_uint64() const { return dl_data->e_uint64; }
+};
+
+struct sized_enums_inl_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct sized_enums_inl_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t e_int8_count() const { return 4; }
+    enum_int8 e_int8( uint32_t i ) const { return dl_data->e_int8[i]; }
+    uint32_t e_int16_count() const { return 4; }
+    enum_int16 e_int16( uint32_t i ) const { return dl_data->e_int16[i]; }
+    uint32_t e_int32_count() const { return 4; }
+    enum_int32 e_int32( uint32_t i ) const { return dl_data->e_int32[i]; }
+    uint32_t e_int64_count() const { return 4; }
+    enum_int64 e_int64( uint32_t i ) const { return dl_data->e_int64[i]; }
+    uint32_t e_uint8_count() const { return 3; }
+    enum_uint8 e_uint8( uint32_t i ) const { return dl_data->e_uint8[i]; }
+    uint32_t e_uint16_count() const { return 3; }
+    enum_uint16 e_uint16( uint32_t i ) const { return dl_data->e_uint16[i]; }
+    uint32_t e_uint32_count() const { return 3; }
+    enum_uint32 e_uint32( uint32_t i ) const { return dl_data->e_uint32[i]; }
+    uint32_t e_uint64_count() const { return 3; }
+    enum_uint64 e_uint64( uint32_t i ) const { return dl_data->e_uint64[i]; }
+};
+
+struct sized_enums_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct sized_enums_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t e_int8_count() const { return dl_data->e_int8.count; }
+    enum_int8 e_int8( uint32_t i ) const { return DL_VIEW_PTR( enum_int8 const*, dl_packed_instance, dl_data->e_int8.data )[i]; }
+    uint32_t e_int16_count() const { return dl_data->e_int16.count; }
+    enum_int16 e_int16( uint32_t i ) const { return DL_VIEW_PTR( enum_int16 const*, dl_packed_instance, dl_data->e_int16.data )[i]; }
+    uint32_t e_int32_count() const { return dl_data->e_int32.count; }
+    enum_int32 e_int32( uint32_t i ) const { return DL_VIEW_PTR( enum_int32 const*, dl_packed_instance, dl_data->e_int32.data )[i]; }
+    uint32_t e_int64_count() const { return dl_data->e_int64.count; }
+    enum_int64 e_int64( uint32_t i ) const { return DL_VIEW_PTR( enum_int64 const*, dl_packed_instance, dl_data->e_int64.data )[i]; }
+    uint32_t e_uint8_count() const { return dl_data->e_uint8.count; }
+    enum_uint8 e_uint8( uint32_t i ) const { return DL_VIEW_PTR( enum_uint8 const*, dl_packed_instance, dl_data->e_uint8.data )[i]; }
+    uint32_t e_uint16_count() const { return dl_data->e_uint16.count; }
+    enum_uint16 e_uint16( uint32_t i ) const { return DL_VIEW_PTR( enum_uint16 const*, dl_packed_instance, dl_data->e_uint16.data )[i]; }
+    uint32_t e_uint32_count() const { return dl_data->e_uint32.count; }
+    enum_uint32 e_uint32( uint32_t i ) const { return DL_VIEW_PTR( enum_uint32 const*, dl_packed_instance, dl_data->e_uint32.data )[i]; }
+    uint32_t e_uint64_count() const { return dl_data->e_uint64.count; }
+    enum_uint64 e_uint64( uint32_t i ) const { return DL_VIEW_PTR( enum_uint64 const*, dl_packed_instance, dl_data->e_uint64.data )[i]; }
+};
+
+
+#endif // defined( __cplusplus )
+
+#endif // __DL_AUTOGEN_HEADER_SIZED_ENUMS_H_INCLUDED
+
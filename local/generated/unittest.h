@@ -0,0 +1,3092 @@
+/* Auto generated header for dl type library */
+#ifndef __DL_AUTOGEN_HEADER_UNITTEST_H_INCLUDED
+#define __DL_AUTOGEN_HEADER_UNITTEST_H_INCLUDED
+
+#include <stdint.h>
+
+#include <stddef.h> // for size_t and offsetof
+
+#ifndef __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+#define __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+#  if !defined(__cplusplus)
+#    define DL_SIZED_ENUM_SUPPORTED 0
+#  else
+#    if defined(_MSC_VER)
+#      if _MSC_VER < 1900
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      else
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      endif
+#    else
+       // this would need more work but it is good enough for now
+#      define DL_SIZED_ENUM_SUPPORTED 1
+#    endif
+#  endif
+
+   /// ... DL_C_STRUCT ...
+   /// The macro DL_C_STRUCT is used on external types to add struct in c
+   /// where it is needed. In c++ this is skipped as it is not needed and
+   /// could be something else such as a class or typedef.
+#  if defined(__cplusplus)
+#    define DL_C_STRUCT
+#  else
+#    define DL_C_STRUCT struct
+#  endif
+
+   /// ... DL_C_ENUM ...
+   /// Same concept as DL_C_STRUCT
+#  if defined(__cplusplus)
+#    define DL_C_ENUM
+#  else
+#    define DL_C_ENUM enum
+#  endif
+
+   /// ... DL_ALIGN() ...
+#  if defined(_MSC_VER)
+#    define DL_ALIGN(x) __declspec(align(x))
+#  elif defined(__GNUC__)
+#    define DL_ALIGN(x) __attribute__((aligned(x)))
+#  else
+#    error "Unsupported compiler"
+#  endif
+
+   /// ... DL_ALIGNOF() ...
+#  if defined(__clang__)
+#    if __has_feature(cxx_alignof)
+#      define DL_ALIGNOF(type) alignof(type)
+#    elif __has_feature(c_alignof)
+#      define DL_ALIGNOF(type) _Alignof(type)
+#    endif
+#  elif defined(__GNUC__)
+#    define DL_ALIGNOF(type) __alignof__(type)
+#  endif
+#  if defined(_MSC_VER )
+#    define DL_ALIGNOF(type) __alignof(type)
+#  endif
+
+#  ifndef DL_ALIGNOF
+#    define DL_ALIGNOF(type) ((sizeof(type) > 1)? offsetof(struct { char c; type x; }, x) : 1)
+#  endif
+
+   // ... DL_STATIC_ASSERT() ...
+   // ... clang ...
+#  if defined( __clang__ )
+#    if defined( __cplusplus ) && __has_feature(cxx_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    elif __has_feature(c_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#    endif
+   // ... msvc ...
+#  elif defined( _MSC_VER ) && ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#    define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+   // ... gcc ...
+#  elif defined( __cplusplus )
+#    if __cplusplus >= 201103L || ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    endif
+#  elif defined( __STDC__ )
+#    if defined( __STDC_VERSION__ )
+#      if __STDC_VERSION__ >= 201112L
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      else
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      endif
+#    endif
+#  endif
+#  if !defined(DL_STATIC_ASSERT)
+#    define DL_STATIC_ASSERT(x,y) // default to non-implemented.
+#  endif
+
+   // ... DL_DATA_ASSERT() ...
+#  if !defined(DL_DATA_ASSERT)
+#    define DL_DATA_ASSERT(x) // default to non-implemented.
+#  endif
+
+   // ... DL_DECLARE_ARRAY ...
+#  if defined(__cplusplus)
+	  template <typename T>
+	  struct dl_array
+	  {
+		   inline const T& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline T& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const T* begin() const
+		   {
+		       return data;
+		   }
+		   inline const T* end() const
+		   {
+		       return data + count;
+		   }
+		   inline T* begin()
+		   {
+		       return data;
+		   }
+		   inline T* end()
+		   {
+		       return data + count;
+		   }
+		   T* data;
+		   uint32_t count;
+	   };
+	   template <>
+	   struct dl_array<const char*> {
+		   inline const char*& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char*& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char* const* begin() const
+		   {
+		       return data;
+		   }
+		   inline const char* const* end() const
+		   {
+		       return data + count;
+		   }
+		   inline const char** begin()
+		   {
+		       return data;
+		   }
+		   inline const char** end()
+		   {
+		       return data + count;
+		   }
+		   const char** data;
+		   uint32_t count;
+	   };
+#	 define DL_DECLARE_ARRAY(type) dl_array<type>
+#  else
+#	 define DL_DECLARE_ARRAY(type)  \
+       struct              \
+       {                   \
+           type* data;     \
+           uint32_t count; \
+       }
+#  endif
+
+   // ... DL_REL_PTR() ...
+   /// Read a pointer-, string- or array-member of an instance stored with relative pointers, see
+   /// dl_instance_make_relative(). The member store the distance in bytes from itself to the data, 0 for null.
+#  define DL_REL_PTR(type, member) ((type)( (intptr_t)(member) == 0 ? 0 : (const char*)&(member) + (intptr_t)(member) ))
+
+   // ... DL_VIEW_PTR() ...
+   /// Read a pointer-, string- or array-member of a packed instance that is not loaded, see dl_view_instance(). The
+   /// member store the offset in bytes from the start of the packed instance to the data, 0 for null.
+#  define DL_VIEW_PTR(type, packed_instance, member) ((type)( (uintptr_t)(member) == 0 ? 0 : (const unsigned char*)(packed_instance) + (uintptr_t)(member) ))
+#endif // __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+//----------------------------------------------
+//                   INCLUDES                   
+//----------------------------------------------
+
+#include <stdio.h>
+
+
+//----------------------------------------------
+//                   TYPEID:s                   
+//----------------------------------------------
+
+// ENUMS
+#define TestEnum1_TYPE_ID (0x090926C6)
+#define TestEnum2_TYPE_ID (0x090926C7)
+#define multi_alias_enum_TYPE_ID (0xE8F67F88)
+#define EnumWithMeta_TYPE_ID (0x3CFFC538)
+
+// TYPES
+#define unused_TYPE_ID (0x20D327B4)
+#define Pods_TYPE_ID (0x7C8ABE56)
+#define i8Array_TYPE_ID (0x1DDC04A0)
+#define i16Array_TYPE_ID (0xA168660F)
+#define i32Array_TYPE_ID (0x32083D0D)
+#define i64Array_TYPE_ID (0x1DA14492)
+#define u8Array_TYPE_ID (0xB996DDAC)
+#define u16Array_TYPE_ID (0xB47E609B)
+#define u32Array_TYPE_ID (0x451E3799)
+#define u64Array_TYPE_ID (0x30B73F1E)
+#define fp32Array_TYPE_ID (0x87D3563A)
+#define fp64Array_TYPE_ID (0x736C5DBF)
+#define strArray_TYPE_ID (0x8D6E2318)
+#define ptrArray_TYPE_ID (0xC8A8A475)
+#define enumArray_TYPE_ID (0x9CF74254)
+#define default_empty_type_TYPE_ID (0xD7315B34)
+#define type_with_meta_TYPE_ID (0xD92D32C3)
+#define test_union_simple_TYPE_ID (0x79CDAD31)
+#define MorePods_TYPE_ID (0xFD3E1AC9)
+#define Pods2_TYPE_ID (0x0DE529E8)
+#define Pod2InStruct_TYPE_ID (0x08ACCFF1)
+#define PodPtr_TYPE_ID (0xCA8C7B99)
+#define Pod2InStructInStruct_TYPE_ID (0xF540FDCD)
+#define WithInlineArray_TYPE_ID (0x1123239A)
+#define WithInlineStructArray_TYPE_ID (0xFFC53F7F)
+#define WithInlineStructStructArray_TYPE_ID (0x2027F324)
+#define SubString_TYPE_ID (0xF2663CC1)
+#define InlineArrayWithSubString_TYPE_ID (0xC858A21B)
+#define PodArray1_TYPE_ID (0x7B3938D3)
+#define PodArray2_TYPE_ID (0x7B3938D4)
+#define StructArray1_TYPE_ID (0x8DE7A1F5)
+#define StructArrayRecursive1_TYPE_ID (0xAFD72DAD)
+#define StructArrayRecursive2_TYPE_ID (0xAFD72DAE)
+#define Strings_TYPE_ID (0x0FC202CA)
+#define StringInlineArray_TYPE_ID (0x3F4DBE15)
+#define StringArray_TYPE_ID (0xCC4EFE36)
+#define TestBits_TYPE_ID (0x74A160D2)
+#define MoreBits_TYPE_ID (0xFD365605)
+#define BitBitfield64_TYPE_ID (0xECE9CECC)
+#define SimplePtr_TYPE_ID (0x711E2A40)
+#define PtrChain_TYPE_ID (0x408C7639)
+#define DoublePtrChain_TYPE_ID (0x0EC87334)
+#define inline_ptr_array_TYPE_ID (0xCBD895B2)
+#define ptr_array_TYPE_ID (0x22873BB4)
+#define ptr_inline_array_TYPE_ID (0x8D27ED12)
+#define ptr_inline_array2_TYPE_ID (0x32283024)
+#define inline_array_pod_ptr_TYPE_ID (0xF0DF7E14)
+#define ptr_struct_inline_array_ptr_TYPE_ID (0x1EEB190B)
+#define A128BitAlignedType_TYPE_ID (0x77B2BAF1)
+#define TestingEnum_TYPE_ID (0x42659D73)
+#define InlineArrayEnum_TYPE_ID (0x0F58DEB3)
+#define ArrayEnum_TYPE_ID (0xED6EB494)
+#define PodsDefaults_TYPE_ID (0x752BE96E)
+#define BitfieldDefaultsMulti_TYPE_ID (0x006EC446)
+#define DefaultStr_TYPE_ID (0xA36FB79E)
+#define DefaultEnum_TYPE_ID (0x116185FA)
+#define DefaultStruct_TYPE_ID (0x114797AA)
+#define DefaultPtr_TYPE_ID (0xA36FAADB)
+#define DefaultInlArrayPod_TYPE_ID (0x441FC1CA)
+#define DefaultInlArrayStr_TYPE_ID (0x441FCF40)
+#define DefaultInlArrayEnum_TYPE_ID (0xC81491DC)
+#define DefaultInlArrayArray_TYPE_ID (0xCA632FA6)
+#define DefaultArrayPod_TYPE_ID (0x49F1A9E7)
+#define DefaultArrayStr_TYPE_ID (0x49F1B75D)
+#define DefaultArrayEnum_TYPE_ID (0x88237D99)
+#define DefaultArrayArray_TYPE_ID (0x8C4F9303)
+#define DefaultWithOtherDataBefore_TYPE_ID (0xA3FE2050)
+#define issue_40_1_TYPE_ID (0x7447F53C)
+#define issue_40_2_TYPE_ID (0x7447F53D)
+#define with_alias_enum_TYPE_ID (0xF589E359)
+#define BugTest4_TYPE_ID (0x897698F2)
+#define BugTest5_TYPE_ID (0x897698F3)
+#define PtrHolder_TYPE_ID (0x5E4C46D4)
+#define PtrArray_TYPE_ID (0x406E0855)
+#define circular_array_ptr_holder_TYPE_ID (0x1CD266A5)
+#define circular_array_TYPE_ID (0x91DB4AB3)
+#define str_before_array_bug_arr_type_TYPE_ID (0x28519FEB)
+#define str_before_array_bug_TYPE_ID (0x9533E3E6)
+#define bug_array_alignment_struct_TYPE_ID (0xF604479E)
+#define bug_alignment_struct_TYPE_ID (0xD34F93E0)
+#define bug_array_alignment_TYPE_ID (0x5C74D3FA)
+#define test_array_pad_1_TYPE_ID (0x717C6DE2)
+#define test_array_pad_TYPE_ID (0xAC2E57B2)
+#define array_subdata_elem_TYPE_ID (0x0A4F6F84)
+#define array_subdata_TYPE_ID (0x9F614C22)
+#define test_inline_array_size_from_enum_TYPE_ID (0xF1AAF73D)
+#define test_inline_array_of_unions_TYPE_ID (0x68A11BCB)
+#define single_int_TYPE_ID (0x4DB5F3EC)
+#define struct_with_a_bitfield_TYPE_ID (0xD58CEA22)
+#define struct_with_some_defaults_TYPE_ID (0xBBA359AA)
+#define struct_with_one_member_and_default_TYPE_ID (0x555F266E)
+#define single_default_uint32_TYPE_ID (0xDCCFDE6A)
+#define test_inline_array_default_struct1_TYPE_ID (0x647D10D5)
+#define test_inline_array_default_struct2_TYPE_ID (0x647D10D6)
+#define vector2_type_TYPE_ID (0x1271A166)
+#define member_with_array_of_vector_TYPE_ID (0x59535DF7)
+#define struct_with_member_with_array_of_vector_TYPE_ID (0x03687D76)
+#define union_with_weird_members_TYPE_ID (0xD7D12468)
+#define test_union_inline_array_TYPE_ID (0xF975B584)
+#define test_union_array_TYPE_ID (0x50038066)
+#define test_union_ptr_TYPE_ID (0x7FF4E33D)
+#define test_has_union_array_TYPE_ID (0x6E33AAC1)
+#define union_with_weird_members_event_TYPE_ID (0x13A3F1C9)
+#define struct_with_array_of_weird_unions_TYPE_ID (0xB3CBCA67)
+#define test_with_union_array_TYPE_ID (0x3E92AF01)
+#define test_lots_of_members_TYPE_ID (0x898C1BFF)
+
+
+//----------------------------------------------
+//                   ENUMS:s                    
+//----------------------------------------------
+
+#if DL_SIZED_ENUM_SUPPORTED
+
+typedef enum TestEnum1
+{
+    TESTENUM1_VALUE1 = 0,
+    TESTENUM1_VALUE2 = 1,
+    TESTENUM1_VALUE3 = 2,
+    TESTENUM1_VALUE4 = 3
+} TestEnum1;
+
+typedef enum TestEnum2
+{
+    TESTENUM2_VALUE1 = 7,
+    TESTENUM2_VALUE2 = 1337,
+    // whippzores!
+    TESTENUM2_VALUE3 = 1338,
+    // whoppa!
+    TESTENUM2_VALUE4 = 1337
+} TestEnum2;
+
+typedef enum multi_alias_enum
+{
+    MULTI_ALIAS1 = 7,
+    MULTI_ALIAS2 = 8
+} multi_alias_enum;
+
+typedef enum EnumWithMeta
+{
+    // whoppa!
+    TESTENUMWITHMETA = 1337
+} EnumWithMeta;
+
+#else // DL_SIZED_ENUM_SUPPORTED
+
+typedef enum TestEnum1
+{
+    TESTENUM1_VALUE1 = 0,
+    TESTENUM1_VALUE2 = 1,
+    TESTENUM1_VALUE3 = 2,
+    TESTENUM1_VALUE4 = 3
+} TestEnum1;
+
+typedef enum TestEnum2
+{
+    TESTENUM2_VALUE1 = 7,
+    TESTENUM2_VALUE2 = 1337,
+    // whippzores!
+    TESTENUM2_VALUE3 = 1338,
+    // whoppa!
+    TESTENUM2_VALUE4 = 1337
+} TestEnum2;
+
+typedef enum multi_alias_enum
+{
+    MULTI_ALIAS1 = 7,
+    MULTI_ALIAS2 = 8
+} multi_alias_enum;
+
+typedef enum EnumWithMeta
+{
+    // whoppa!
+    TESTENUMWITHMETA = 1337
+} EnumWithMeta;
+
+#endif // DL_SIZED_ENUM_SUPPORTED
+
+//----------------------------------------------
+//                   TYPES:s                    
+//----------------------------------------------
+
+struct unused
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x20D327B4;
+#endif // defined( __cplusplus )
+
+    //only used in unittests to check for errors
+    int32_t member; 
+};
+
+struct Pods
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7C8ABE56;
+#endif // defined( __cplusplus )
+
+    int8_t i8; 
+    int16_t i16; 
+    int32_t i32; 
+    DL_ALIGN(8) int64_t i64; 
+    uint8_t u8; 
+    uint16_t u16; 
+    uint32_t u32; 
+    DL_ALIGN(8) uint64_t u64; 
+    float f32; 
+    DL_ALIGN(8) double f64; 
+};
+
+struct i8Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1DDC04A0;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int8_t) arr;
+};
+
+static inline const int8_t* i8Array_rel_arr( const struct i8Array* s ) { return DL_REL_PTR( const int8_t*, s->arr.data ); }
+
+struct i16Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA168660F;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int16_t) arr;
+};
+
+static inline const int16_t* i16Array_rel_arr( const struct i16Array* s ) { return DL_REL_PTR( const int16_t*, s->arr.data ); }
+
+struct i32Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x32083D0D;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int32_t) arr;
+};
+
+static inline const int32_t* i32Array_rel_arr( const struct i32Array* s ) { return DL_REL_PTR( const int32_t*, s->arr.data ); }
+
+struct i64Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1DA14492;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int64_t) arr;
+};
+
+static inline const int64_t* i64Array_rel_arr( const struct i64Array* s ) { return DL_REL_PTR( const int64_t*, s->arr.data ); }
+
+struct u8Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xB996DDAC;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint8_t) arr;
+};
+
+static inline const uint8_t* u8Array_rel_arr( const struct u8Array* s ) { return DL_REL_PTR( const uint8_t*, s->arr.data ); }
+
+struct u16Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xB47E609B;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint16_t) arr;
+};
+
+static inline const uint16_t* u16Array_rel_arr( const struct u16Array* s ) { return DL_REL_PTR( const uint16_t*, s->arr.data ); }
+
+struct u32Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x451E3799;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint32_t) arr;
+};
+
+static inline const uint32_t* u32Array_rel_arr( const struct u32Array* s ) { return DL_REL_PTR( const uint32_t*, s->arr.data ); }
+
+struct u64Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x30B73F1E;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint64_t) arr;
+};
+
+static inline const uint64_t* u64Array_rel_arr( const struct u64Array* s ) { return DL_REL_PTR( const uint64_t*, s->arr.data ); }
+
+struct fp32Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x87D3563A;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(float) arr;
+};
+
+static inline const float* fp32Array_rel_arr( const struct fp32Array* s ) { return DL_REL_PTR( const float*, s->arr.data ); }
+
+struct fp64Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x736C5DBF;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(double) arr;
+};
+
+static inline const double* fp64Array_rel_arr( const struct fp64Array* s ) { return DL_REL_PTR( const double*, s->arr.data ); }
+
+struct strArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8D6E2318;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) arr;
+};
+
+static inline const char* strArray_rel_arr( const struct strArray* s, uint32_t i ) { const char* const* data = DL_REL_PTR( const char* const*, s->arr.data ); return DL_REL_PTR( const char*, data[i] ); }
+
+struct ptrArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xC8A8A475;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct Pods*) arr;
+};
+
+static inline const struct Pods* ptrArray_rel_arr( const struct ptrArray* s, uint32_t i ) { struct Pods* const* data = DL_REL_PTR( struct Pods* const*, s->arr.data ); return DL_REL_PTR( const struct Pods*, data[i] ); }
+
+struct enumArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x9CF74254;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(TestEnum1) arr;
+};
+
+static inline const TestEnum1* enumArray_rel_arr( const struct enumArray* s ) { return DL_REL_PTR( const TestEnum1*, s->arr.data ); }
+
+struct default_empty_type
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD7315B34;
+#endif // defined( __cplusplus )
+
+    uint32_t empty; 
+};
+
+struct type_with_meta
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD92D32C3;
+#endif // defined( __cplusplus )
+
+    int8_t i8; 
+};
+
+enum test_union_simple_type
+{
+    test_union_simple_type_item1 = test_union_simple_TYPE_ID + 1,
+    test_union_simple_type_item2 = test_union_simple_TYPE_ID + 2,
+    test_union_simple_type_item3 = test_union_simple_TYPE_ID + 3
+};
+
+struct test_union_simple
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x79CDAD31;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    int32_t item1; 
+    float item2; 
+    DL_C_STRUCT Pods item3;
+    } value;
+    enum test_union_simple_type type;
+};
+
+struct MorePods
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xFD3E1AC9;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT Pods Pods1;
+    DL_C_STRUCT Pods Pods2;
+};
+
+struct Pods2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0DE529E8;
+#endif // defined( __cplusplus )
+
+    uint32_t Int1; 
+    uint32_t Int2; 
+};
+
+struct Pod2InStruct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x08ACCFF1;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT Pods2 Pod1;
+    DL_C_STRUCT Pods2 Pod2;
+};
+
+struct PodPtr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xCA8C7B99;
+#endif // defined( __cplusplus )
+
+    const struct Pods2* PodPtr1;
+};
+
+static inline const struct Pods2* PodPtr_rel_PodPtr1( const struct PodPtr* s ) { return DL_REL_PTR( const struct Pods2*, s->PodPtr1 ); }
+
+struct Pod2InStructInStruct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF540FDCD;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT Pod2InStruct p2struct;
+};
+
+struct WithInlineArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1123239A;
+#endif // defined( __cplusplus )
+
+    uint32_t Array[3];
+};
+
+struct WithInlineStructArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xFFC53F7F;
+#endif // defined( __cplusplus )
+
+    struct Pods2 Array[3];
+};
+
+struct WithInlineStructStructArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x2027F324;
+#endif // defined( __cplusplus )
+
+    struct WithInlineStructArray Array[2];
+};
+
+struct SubString
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF2663CC1;
+#endif // defined( __cplusplus )
+
+    const char* Str; 
+};
+
+static inline const char* SubString_rel_Str( const struct SubString* s ) { return DL_REL_PTR( const char*, s->Str ); }
+
+struct InlineArrayWithSubString
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xC858A21B;
+#endif // defined( __cplusplus )
+
+    struct SubString Array[2];
+};
+
+struct PodArray1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7B3938D3;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint32_t) u32_arr;
+};
+
+static inline const uint32_t* PodArray1_rel_u32_arr( const struct PodArray1* s ) { return DL_REL_PTR( const uint32_t*, s->u32_arr.data ); }
+
+struct PodArray2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7B3938D4;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct PodArray1) sub_arr;
+};
+
+static inline const struct PodArray1* PodArray2_rel_sub_arr( const struct PodArray2* s ) { return DL_REL_PTR( const struct PodArray1*, s->sub_arr.data ); }
+
+struct StructArray1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8DE7A1F5;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct Pods2) Array;
+};
+
+static inline const struct Pods2* StructArray1_rel_Array( const struct StructArray1* s ) { return DL_REL_PTR( const struct Pods2*, s->Array.data ); }
+
+struct StructArrayRecursive1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xAFD72DAD;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct StructArrayRecursive2) Array;
+};
+
+static inline const struct StructArrayRecursive2* StructArrayRecursive1_rel_Array( const struct StructArrayRecursive1* s ) { return DL_REL_PTR( const struct StructArrayRecursive2*, s->Array.data ); }
+
+struct StructArrayRecursive2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xAFD72DAE;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct StructArrayRecursive1) Array;
+};
+
+static inline const struct StructArrayRecursive1* StructArrayRecursive2_rel_Array( const struct StructArrayRecursive2* s ) { return DL_REL_PTR( const struct StructArrayRecursive1*, s->Array.data ); }
+
+struct Strings
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0FC202CA;
+#endif // defined( __cplusplus )
+
+    const char* Str1; 
+    const char* Str2; 
+};
+
+static inline const char* Strings_rel_Str1( const struct Strings* s ) { return DL_REL_PTR( const char*, s->Str1 ); }
+static inline const char* Strings_rel_Str2( const struct Strings* s ) { return DL_REL_PTR( const char*, s->Str2 ); }
+
+struct StringInlineArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x3F4DBE15;
+#endif // defined( __cplusplus )
+
+    const char* Strings[3];
+};
+
+static inline const char* StringInlineArray_rel_Strings( const struct StringInlineArray* s, uint32_t i ) { return DL_REL_PTR( const char*, s->Strings[i] ); }
+
+struct StringArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xCC4EFE36;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) Strings;
+};
+
+static inline const char* StringArray_rel_Strings( const struct StringArray* s, uint32_t i ) { const char* const* data = DL_REL_PTR( const char* const*, s->Strings.data ); return DL_REL_PTR( const char*, data[i] ); }
+
+struct TestBits
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x74A160D2;
+#endif // defined( __cplusplus )
+
+    uint8_t Bit1 : 1;
+    uint8_t Bit2 : 2;
+    uint8_t Bit3 : 3;
+    uint8_t make_it_uneven; 
+    uint8_t Bit4 : 1;
+    uint8_t Bit5 : 2;
+    uint8_t Bit6 : 3;
+};
+
+struct MoreBits
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xFD365605;
+#endif // defined( __cplusplus )
+
+    uint32_t Bit1 : 15;
+    uint32_t Bit2 : 7;
+};
+
+struct BitBitfield64
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xECE9CECC;
+#endif // defined( __cplusplus )
+
+    DL_ALIGN(8) uint64_t Package : 7;
+    uint64_t FileType : 9;
+    uint64_t PathHash : 16;
+    uint64_t FileHash : 32;
+};
+
+struct SimplePtr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x711E2A40;
+#endif // defined( __cplusplus )
+
+    const struct Pods* Ptr1;
+    const struct Pods* Ptr2;
+};
+
+static inline const struct Pods* SimplePtr_rel_Ptr1( const struct SimplePtr* s ) { return DL_REL_PTR( const struct Pods*, s->Ptr1 ); }
+static inline const struct Pods* SimplePtr_rel_Ptr2( const struct SimplePtr* s ) { return DL_REL_PTR( const struct Pods*, s->Ptr2 ); }
+
+struct PtrChain
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x408C7639;
+#endif // defined( __cplusplus )
+
+    uint32_t Int; 
+    const struct PtrChain* Next;
+};
+
+static inline const struct PtrChain* PtrChain_rel_Next( const struct PtrChain* s ) { return DL_REL_PTR( const struct PtrChain*, s->Next ); }
+
+struct DoublePtrChain
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0EC87334;
+#endif // defined( __cplusplus )
+
+    uint32_t Int; 
+    const struct DoublePtrChain* Next;
+    const struct DoublePtrChain* Prev;
+};
+
+static inline const struct DoublePtrChain* DoublePtrChain_rel_Next( const struct DoublePtrChain* s ) { return DL_REL_PTR( const struct DoublePtrChain*, s->Next ); }
+static inline const struct DoublePtrChain* DoublePtrChain_rel_Prev( const struct DoublePtrChain* s ) { return DL_REL_PTR( const struct DoublePtrChain*, s->Prev ); }
+
+struct inline_ptr_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xCBD895B2;
+#endif // defined( __cplusplus )
+
+    struct Pods2* arr[3];
+};
+
+static inline const struct Pods2* inline_ptr_array_rel_arr( const struct inline_ptr_array* s, uint32_t i ) { return DL_REL_PTR( const struct Pods2*, s->arr[i] ); }
+
+struct ptr_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x22873BB4;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct Pods2*) arr;
+};
+
+static inline const struct Pods2* ptr_array_rel_arr( const struct ptr_array* s, uint32_t i ) { struct Pods2* const* data = DL_REL_PTR( struct Pods2* const*, s->arr.data ); return DL_REL_PTR( const struct Pods2*, data[i] ); }
+
+struct ptr_inline_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8D27ED12;
+#endif // defined( __cplusplus )
+
+    const struct WithInlineArray* ptr;
+};
+
+static inline const struct WithInlineArray* ptr_inline_array_rel_ptr( const struct ptr_inline_array* s ) { return DL_REL_PTR( const struct WithInlineArray*, s->ptr ); }
+
+struct ptr_inline_array2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x32283024;
+#endif // defined( __cplusplus )
+
+    const struct WithInlineStructArray* ptr;
+};
+
+static inline const struct WithInlineStructArray* ptr_inline_array2_rel_ptr( const struct ptr_inline_array2* s ) { return DL_REL_PTR( const struct WithInlineStructArray*, s->ptr ); }
+
+struct inline_array_pod_ptr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF0DF7E14;
+#endif // defined( __cplusplus )
+
+    struct PodPtr inlarr[2];
+};
+
+struct ptr_struct_inline_array_ptr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1EEB190B;
+#endif // defined( __cplusplus )
+
+    const struct inline_array_pod_ptr* ptr;
+};
+
+static inline const struct inline_array_pod_ptr* ptr_struct_inline_array_ptr_rel_ptr( const struct ptr_struct_inline_array_ptr* s ) { return DL_REL_PTR( const struct inline_array_pod_ptr*, s->ptr ); }
+
+struct DL_ALIGN( 128 ) A128BitAlignedType
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x77B2BAF1;
+#endif // defined( __cplusplus )
+
+    uint32_t Int; 
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+};
+
+struct TestingEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x42659D73;
+#endif // defined( __cplusplus )
+
+    DL_C_ENUM TestEnum1 TheEnum;
+};
+
+struct InlineArrayEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0F58DEB3;
+#endif // defined( __cplusplus )
+
+    TestEnum2 EnumArr[4];
+};
+
+struct ArrayEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xED6EB494;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(TestEnum2) EnumArr;
+};
+
+static inline const TestEnum2* ArrayEnum_rel_EnumArr( const struct ArrayEnum* s ) { return DL_REL_PTR( const TestEnum2*, s->EnumArr.data ); }
+
+struct PodsDefaults
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x752BE96E;
+#endif // defined( __cplusplus )
+
+    int8_t i8; 
+    int16_t i16; 
+    int32_t i32; 
+    DL_ALIGN(8) int64_t i64; 
+    uint8_t u8; 
+    uint16_t u16; 
+    uint32_t u32; 
+    DL_ALIGN(8) uint64_t u64; 
+    float f32; 
+    DL_ALIGN(8) double f64; 
+};
+
+struct BitfieldDefaultsMulti
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x006EC446;
+#endif // defined( __cplusplus )
+
+    uint16_t f1 : 1;
+    uint16_t f2 : 1;
+    uint16_t f3 : 2;
+    uint16_t f4 : 2;
+    uint16_t f5 : 2;
+    uint16_t f6 : 2;
+};
+
+struct DefaultStr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA36FB79E;
+#endif // defined( __cplusplus )
+
+    const char* Str; 
+};
+
+static inline const char* DefaultStr_rel_Str( const struct DefaultStr* s ) { return DL_REL_PTR( const char*, s->Str ); }
+
+struct DefaultEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x116185FA;
+#endif // defined( __cplusplus )
+
+    DL_C_ENUM TestEnum1 Enum;
+};
+
+struct DefaultStruct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x114797AA;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT Pods2 Struct;
+};
+
+struct DefaultPtr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA36FAADB;
+#endif // defined( __cplusplus )
+
+    const struct Pods* Ptr;
+};
+
+static inline const struct Pods* DefaultPtr_rel_Ptr( const struct DefaultPtr* s ) { return DL_REL_PTR( const struct Pods*, s->Ptr ); }
+
+struct DefaultInlArrayPod
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x441FC1CA;
+#endif // defined( __cplusplus )
+
+    uint32_t Arr[4];
+};
+
+struct DefaultInlArrayStr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x441FCF40;
+#endif // defined( __cplusplus )
+
+    const char* Arr[4];
+};
+
+static inline const char* DefaultInlArrayStr_rel_Arr( const struct DefaultInlArrayStr* s, uint32_t i ) { return DL_REL_PTR( const char*, s->Arr[i] ); }
+
+struct DefaultInlArrayEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xC81491DC;
+#endif // defined( __cplusplus )
+
+    TestEnum1 Arr[4];
+};
+
+struct DefaultInlArrayArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xCA632FA6;
+#endif // defined( __cplusplus )
+
+    struct PodArray1 Arr[2];
+};
+
+struct DefaultArrayPod
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x49F1A9E7;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint32_t) Arr;
+};
+
+static inline const uint32_t* DefaultArrayPod_rel_Arr( const struct DefaultArrayPod* s ) { return DL_REL_PTR( const uint32_t*, s->Arr.data ); }
+
+struct DefaultArrayStr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x49F1B75D;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) Arr;
+};
+
+static inline const char* DefaultArrayStr_rel_Arr( const struct DefaultArrayStr* s, uint32_t i ) { const char* const* data = DL_REL_PTR( const char* const*, s->Arr.data ); return DL_REL_PTR( const char*, data[i] ); }
+
+struct DefaultArrayEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x88237D99;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(TestEnum1) Arr;
+};
+
+static inline const TestEnum1* DefaultArrayEnum_rel_Arr( const struct DefaultArrayEnum* s ) { return DL_REL_PTR( const TestEnum1*, s->Arr.data ); }
+
+struct DefaultArrayArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8C4F9303;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct PodArray1) Arr;
+};
+
+static inline const struct PodArray1* DefaultArrayArray_rel_Arr( const struct DefaultArrayArray* s ) { return DL_REL_PTR( const struct PodArray1*, s->Arr.data ); }
+
+struct DefaultWithOtherDataBefore
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA3FE2050;
+#endif // defined( __cplusplus )
+
+    const char* t1; 
+    const char* Str; 
+};
+
+static inline const char* DefaultWithOtherDataBefore_rel_t1( const struct DefaultWithOtherDataBefore* s ) { return DL_REL_PTR( const char*, s->t1 ); }
+static inline const char* DefaultWithOtherDataBefore_rel_Str( const struct DefaultWithOtherDataBefore* s ) { return DL_REL_PTR( const char*, s->Str ); }
+
+struct issue_40_1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7447F53C;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) submember1;
+    uint32_t submember2; 
+};
+
+static inline const char* issue_40_1_rel_submember1( const struct issue_40_1* s, uint32_t i ) { const char* const* data = DL_REL_PTR( const char* const*, s->submember1.data ); return DL_REL_PTR( const char*, data[i] ); }
+
+struct issue_40_2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7447F53D;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT issue_40_1 member1;
+};
+
+struct with_alias_enum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF589E359;
+#endif // defined( __cplusplus )
+
+    DL_C_ENUM multi_alias_enum e1;
+    DL_C_ENUM multi_alias_enum e2;
+    DL_C_ENUM multi_alias_enum e3;
+    DL_C_ENUM multi_alias_enum e4;
+};
+
+struct BugTest4
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x897698F2;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct StringArray) struct_with_str_arr;
+};
+
+static inline const struct StringArray* BugTest4_rel_struct_with_str_arr( const struct BugTest4* s ) { return DL_REL_PTR( const struct StringArray*, s->struct_with_str_arr.data ); }
+
+struct BugTest5
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x897698F3;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct PtrChain) array;
+};
+
+static inline const struct PtrChain* BugTest5_rel_array( const struct BugTest5* s ) { return DL_REL_PTR( const struct PtrChain*, s->array.data ); }
+
+struct PtrHolder
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x5E4C46D4;
+#endif // defined( __cplusplus )
+
+    const struct Pods2* ptr;
+};
+
+static inline const struct Pods2* PtrHolder_rel_ptr( const struct PtrHolder* s ) { return DL_REL_PTR( const struct Pods2*, s->ptr ); }
+
+struct PtrArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x406E0855;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct PtrHolder) arr;
+};
+
+static inline const struct PtrHolder* PtrArray_rel_arr( const struct PtrArray* s ) { return DL_REL_PTR( const struct PtrHolder*, s->arr.data ); }
+
+struct circular_array_ptr_holder
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1CD266A5;
+#endif // defined( __cplusplus )
+
+    const struct circular_array* ptr;
+};
+
+static inline const struct circular_array* circular_array_ptr_holder_rel_ptr( const struct circular_array_ptr_holder* s ) { return DL_REL_PTR( const struct circular_array*, s->ptr ); }
+
+struct circular_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x91DB4AB3;
+#endif // defined( __cplusplus )
+
+    uint16_t val; 
+    DL_DECLARE_ARRAY(struct circular_array_ptr_holder) arr;
+};
+
+static inline const struct circular_array_ptr_holder* circular_array_rel_arr( const struct circular_array* s ) { return DL_REL_PTR( const struct circular_array_ptr_holder*, s->arr.data ); }
+
+struct str_before_array_bug_arr_type
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x28519FEB;
+#endif // defined( __cplusplus )
+
+    const char* str; 
+};
+
+static inline const char* str_before_array_bug_arr_type_rel_str( const struct str_before_array_bug_arr_type* s ) { return DL_REL_PTR( const char*, s->str ); }
+
+struct str_before_array_bug
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x9533E3E6;
+#endif // defined( __cplusplus )
+
+    const char* str; 
+    DL_DECLARE_ARRAY(struct str_before_array_bug_arr_type) arr;
+};
+
+static inline const char* str_before_array_bug_rel_str( const struct str_before_array_bug* s ) { return DL_REL_PTR( const char*, s->str ); }
+static inline const struct str_before_array_bug_arr_type* str_before_array_bug_rel_arr( const struct str_before_array_bug* s ) { return DL_REL_PTR( const struct str_before_array_bug_arr_type*, s->arr.data ); }
+
+struct bug_array_alignment_struct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF604479E;
+#endif // defined( __cplusplus )
+
+    uint32_t type; 
+    DL_ALIGN(8) uint64_t ptr; 
+    uint32_t used_sources; 
+};
+
+struct bug_alignment_struct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD34F93E0;
+#endif // defined( __cplusplus )
+
+    uint32_t i32; 
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    DL_C_STRUCT A128BitAlignedType aligned;
+    const struct Pods2* ptr;
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+    uint64_t : 64; // Explicit padding to avoid msvc warning 4324
+};
+
+static inline const struct Pods2* bug_alignment_struct_rel_ptr( const struct bug_alignment_struct* s ) { return DL_REL_PTR( const struct Pods2*, s->ptr ); }
+
+struct bug_array_alignment
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x5C74D3FA;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct bug_array_alignment_struct) components;
+};
+
+static inline const struct bug_array_alignment_struct* bug_array_alignment_rel_components( const struct bug_array_alignment* s ) { return DL_REL_PTR( const struct bug_array_alignment_struct*, s->components.data ); }
+
+struct test_array_pad_1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x717C6DE2;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint8_t) ptr;
+    uint32_t type; 
+};
+
+static inline const uint8_t* test_array_pad_1_rel_ptr( const struct test_array_pad_1* s ) { return DL_REL_PTR( const uint8_t*, s->ptr.data ); }
+
+struct test_array_pad
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xAC2E57B2;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct test_array_pad_1) components;
+};
+
+static inline const struct test_array_pad_1* test_array_pad_rel_components( const struct test_array_pad* s ) { return DL_REL_PTR( const struct test_array_pad_1*, s->components.data ); }
+
+struct array_subdata_elem
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0A4F6F84;
+#endif // defined( __cplusplus )
+
+    const char* str; 
+    DL_DECLARE_ARRAY(struct A128BitAlignedType) aligned;
+    DL_DECLARE_ARRAY(const char*) strs;
+    const struct Pods2* ptr;
+};
+
+static inline const char* array_subdata_elem_rel_str( const struct array_subdata_elem* s ) { return DL_REL_PTR( const char*, s->str ); }
+static inline const struct A128BitAlignedType* array_subdata_elem_rel_aligned( const struct array_subdata_elem* s ) { return DL_REL_PTR( const struct A128BitAlignedType*, s->aligned.data ); }
+static inline const char* array_subdata_elem_rel_strs( const struct array_subdata_elem* s, uint32_t i ) { const char* const* data = DL_REL_PTR( const char* const*, s->strs.data ); return DL_REL_PTR( const char*, data[i] ); }
+static inline const struct Pods2* array_subdata_elem_rel_ptr( const struct array_subdata_elem* s ) { return DL_REL_PTR( const struct Pods2*, s->ptr ); }
+
+struct array_subdata
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x9F614C22;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct array_subdata_elem) arr;
+};
+
+static inline const struct array_subdata_elem* array_subdata_rel_arr( const struct array_subdata* s ) { return DL_REL_PTR( const struct array_subdata_elem*, s->arr.data ); }
+
+struct test_inline_array_size_from_enum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF1AAF73D;
+#endif // defined( __cplusplus )
+
+    int32_t arr1[7];
+    int32_t arr2[3];
+};
+
+struct test_inline_array_of_unions
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x68A11BCB;
+#endif // defined( __cplusplus )
+
+    struct test_union_simple arr[3];
+};
+
+struct single_int
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x4DB5F3EC;
+#endif // defined( __cplusplus )
+
+    int32_t val; 
+};
+
+//! not_reloadable
+struct struct_with_a_bitfield
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD58CEA22;
+#endif // defined( __cplusplus )
+
+    DL_ALIGN(8) uint64_t my_variable_1; 
+    uint32_t my_variable_2; 
+    uint8_t my_variable_3 : 1;
+};
+
+struct struct_with_some_defaults
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xBBA359AA;
+#endif // defined( __cplusplus )
+
+    uint32_t some_variable_1; 
+    float some_variable_2; 
+    float some_variable_3; 
+    float some_variable_4; 
+    float some_variable_5; 
+};
+
+struct struct_with_one_member_and_default
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x555F266E;
+#endif // defined( __cplusplus )
+
+    uint32_t dummy; 
+};
+
+struct single_default_uint32
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xDCCFDE6A;
+#endif // defined( __cplusplus )
+
+    uint32_t u; 
+};
+
+struct test_inline_array_default_struct1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x647D10D5;
+#endif // defined( __cplusplus )
+
+    struct single_default_uint32 arr[3];
+};
+
+struct test_inline_array_default_struct2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x647D10D6;
+#endif // defined( __cplusplus )
+
+    struct single_default_uint32 arr[3];
+};
+
+struct vector2_type
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1271A166;
+#endif // defined( __cplusplus )
+
+    float x; 
+    float y; 
+};
+
+struct member_with_array_of_vector
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x59535DF7;
+#endif // defined( __cplusplus )
+
+    struct vector2_type varr[2];
+};
+
+struct struct_with_member_with_array_of_vector
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x03687D76;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT member_with_array_of_vector a;
+};
+
+enum union_with_weird_members_type
+{
+    union_with_weird_members_type_spawn_particles = union_with_weird_members_TYPE_ID + 1,
+    union_with_weird_members_type_decay = union_with_weird_members_TYPE_ID + 2,
+    union_with_weird_members_type_hide_all_meshes = union_with_weird_members_TYPE_ID + 3
+};
+
+struct union_with_weird_members
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD7D12468;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    DL_C_STRUCT struct_with_a_bitfield spawn_particles;
+    DL_C_STRUCT struct_with_some_defaults decay;
+    DL_C_STRUCT struct_with_one_member_and_default hide_all_meshes;
+    } value;
+    enum union_with_weird_members_type type;
+};
+
+enum test_union_inline_array_type
+{
+    test_union_inline_array_type_i32 = test_union_inline_array_TYPE_ID + 1,
+    test_union_inline_array_type_inlarr = test_union_inline_array_TYPE_ID + 2
+};
+
+struct test_union_inline_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF975B584;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    int32_t i32; 
+    int32_t inlarr[6];
+    } value;
+    enum test_union_inline_array_type type;
+};
+
+enum test_union_array_type
+{
+    test_union_array_type_i32 = test_union_array_TYPE_ID + 1,
+    test_union_array_type_arr = test_union_array_TYPE_ID + 2
+};
+
+struct test_union_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x50038066;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    int32_t i32; 
+    DL_DECLARE_ARRAY(int32_t) arr;
+    } value;
+    enum test_union_array_type type;
+};
+
+static inline const int32_t* test_union_array_rel_arr( const struct test_union_array* s ) { return DL_REL_PTR( const int32_t*, s->value.arr.data ); }
+
+enum test_union_ptr_type
+{
+    test_union_ptr_type_p1 = test_union_ptr_TYPE_ID + 1,
+    test_union_ptr_type_p2 = test_union_ptr_TYPE_ID + 2,
+    test_union_ptr_type_p3 = test_union_ptr_TYPE_ID + 3
+};
+
+struct test_union_ptr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7FF4E33D;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    const struct Pods* p1;
+    const struct SubString* p2;
+    const struct WithInlineArray* p3;
+    } value;
+    enum test_union_ptr_type type;
+};
+
+static inline const struct Pods* test_union_ptr_rel_p1( const struct test_union_ptr* s ) { return DL_REL_PTR( const struct Pods*, s->value.p1 ); }
+static inline const struct SubString* test_union_ptr_rel_p2( const struct test_union_ptr* s ) { return DL_REL_PTR( const struct SubString*, s->value.p2 ); }
+static inline const struct WithInlineArray* test_union_ptr_rel_p3( const struct test_union_ptr* s ) { return DL_REL_PTR( const struct WithInlineArray*, s->value.p3 ); }
+
+enum test_has_union_array_type
+{
+    test_has_union_array_type_floats = test_has_union_array_TYPE_ID + 1,
+    test_has_union_array_type_ints = test_has_union_array_TYPE_ID + 2
+};
+
+struct test_has_union_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x6E33AAC1;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    DL_DECLARE_ARRAY(float) floats;
+    DL_DECLARE_ARRAY(int32_t) ints;
+    } value;
+    enum test_has_union_array_type type;
+};
+
+static inline const float* test_has_union_array_rel_floats( const struct test_has_union_array* s ) { return DL_REL_PTR( const float*, s->value.floats.data ); }
+static inline const int32_t* test_has_union_array_rel_ints( const struct test_has_union_array* s ) { return DL_REL_PTR( const int32_t*, s->value.ints.data ); }
+
+struct union_with_weird_members_event
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x13A3F1C9;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT union_with_weird_members effect;
+    float delay; 
+};
+
+struct struct_with_array_of_weird_unions
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xB3CBCA67;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct union_with_weird_members_event) event_array;
+};
+
+static inline const struct union_with_weird_members_event* struct_with_array_of_weird_unions_rel_event_array( const struct struct_with_array_of_weird_unions* s ) { return DL_REL_PTR( const struct union_with_weird_members_event*, s->event_array.data ); }
+
+struct test_with_union_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x3E92AF01;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct test_has_union_array) properties;
+};
+
+static inline const struct test_has_union_array* test_with_union_array_rel_properties( const struct test_with_union_array* s ) { return DL_REL_PTR( const struct test_has_union_array*, s->properties.data ); }
+
+struct test_lots_of_members
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x898C1BFF;
+#endif // defined( __cplusplus )
+
+    uint8_t mem00; 
+    uint8_t mem01; 
+    uint8_t mem02; 
+    uint8_t mem03; 
+    uint8_t mem04; 
+    uint8_t mem05; 
+    uint8_t mem06; 
+    uint8_t mem07; 
+    uint8_t mem08; 
+    uint8_t mem09; 
+    uint8_t mem10; 
+    uint8_t mem11; 
+    uint8_t mem12; 
+    uint8_t mem13; 
+    uint8_t mem14; 
+    uint8_t mem15; 
+    uint8_t mem16; 
+    uint8_t mem17; 
+    uint8_t mem18; 
+    uint8_t mem19; 
+    uint8_t mem20; 
+    uint8_t mem21; 
+    uint8_t mem22; 
+    uint8_t mem23; 
+    uint8_t mem24; 
+    uint8_t mem25; 
+    uint8_t mem26; 
+    uint8_t mem27; 
+    uint8_t mem28; 
+    uint8_t mem29; 
+    uint8_t mem30; 
+    uint8_t mem31; 
+    uint8_t mem32; 
+    uint8_t mem33; 
+    uint8_t mem34; 
+    uint8_t mem35; 
+    uint8_t mem36; 
+    uint8_t mem37; 
+    uint8_t mem38; 
+    uint8_t mem39; 
+    uint8_t mem40; 
+    uint8_t mem41; 
+    uint8_t mem42; 
+    uint8_t mem43; 
+    uint8_t mem44; 
+    uint8_t mem45; 
+    uint8_t mem46; 
+    uint8_t mem47; 
+    uint8_t mem48; 
+    uint8_t mem49; 
+    uint8_t mem50; 
+    uint8_t mem51; 
+    uint8_t mem52; 
+    uint8_t mem53; 
+    uint8_t mem54; 
+    uint8_t mem55; 
+    uint8_t mem56; 
+    uint8_t mem57; 
+    uint8_t mem58; 
+    uint8_t mem59; 
+    uint8_t mem60; 
+    uint8_t mem61; 
+    uint8_t mem62; 
+    uint8_t mem63; 
+    uint8_t mem64; 
+    uint8_t mem65; 
+    uint8_t mem66; 
+    uint8_t mem67; 
+    uint8_t mem68; 
+    uint8_t mem69; 
+    uint8_t mem70; 
+    uint8_t mem71; 
+    uint8_t mem72; 
+    uint8_t mem73; 
+    uint8_t mem74; 
+    uint8_t mem75; 
+    uint8_t mem76; 
+    uint8_t mem77; 
+    uint8_t mem78; 
+    uint8_t mem79; 
+};
+
+#if defined( __cplusplus )
+//----------------------------------------------
+//                   VIEWS                      
+//----------------------------------------------
+
+// Read-only views of a packed instance that is not loaded, pointers are resolved when read. Create the view
+// of the root instance from a dl_view_t returned by dl_view_instance(), { view.packed_instance, (const T*)view.data }.
+
+struct unused_view;
+struct Pods_view;
+struct i8Array_view;
+struct i16Array_view;
+struct i32Array_view;
+struct i64Array_view;
+struct u8Array_view;
+struct u16Array_view;
+struct u32Array_view;
+struct u64Array_view;
+struct fp32Array_view;
+struct fp64Array_view;
+struct strArray_view;
+struct ptrArray_view;
+struct enumArray_view;
+struct default_empty_type_view;
+struct type_with_meta_view;
+struct test_union_simple_view;
+struct MorePods_view;
+struct Pods2_view;
+struct Pod2InStruct_view;
+struct PodPtr_view;
+struct Pod2InStructInStruct_view;
+struct WithInlineArray_view;
+struct WithInlineStructArray_view;
+struct WithInlineStructStructArray_view;
+struct SubString_view;
+struct InlineArrayWithSubString_view;
+struct PodArray1_view;
+struct PodArray2_view;
+struct StructArray1_view;
+struct StructArrayRecursive1_view;
+struct StructArrayRecursive2_view;
+struct Strings_view;
+struct StringInlineArray_view;
+struct StringArray_view;
+struct TestBits_view;
+struct MoreBits_view;
+struct BitBitfield64_view;
+struct SimplePtr_view;
+struct PtrChain_view;
+struct DoublePtrChain_view;
+struct inline_ptr_array_view;
+struct ptr_array_view;
+struct ptr_inline_array_view;
+struct ptr_inline_array2_view;
+struct inline_array_pod_ptr_view;
+struct ptr_struct_inline_array_ptr_view;
+struct A128BitAlignedType_view;
+struct TestingEnum_view;
+struct InlineArrayEnum_view;
+struct ArrayEnum_view;
+struct PodsDefaults_view;
+struct BitfieldDefaultsMulti_view;
+struct DefaultStr_view;
+struct DefaultEnum_view;
+struct DefaultStruct_view;
+struct DefaultPtr_view;
+struct DefaultInlArrayPod_view;
+struct DefaultInlArrayStr_view;
+struct DefaultInlArrayEnum_view;
+struct DefaultInlArrayArray_view;
+struct DefaultArrayPod_view;
+struct DefaultArrayStr_view;
+struct DefaultArrayEnum_view;
+struct DefaultArrayArray_view;
+struct DefaultWithOtherDataBefore_view;
+struct issue_40_1_view;
+struct issue_40_2_view;
+struct with_alias_enum_view;
+struct BugTest4_view;
+struct BugTest5_view;
+struct PtrHolder_view;
+struct PtrArray_view;
+struct circular_array_ptr_holder_view;
+struct circular_array_view;
+struct str_before_array_bug_arr_type_view;
+struct str_before_array_bug_view;
+struct bug_array_alignment_struct_view;
+struct bug_alignment_struct_view;
+struct bug_array_alignment_view;
+struct test_array_pad_1_view;
+struct test_array_pad_view;
+struct array_subdata_elem_view;
+struct array_subdata_view;
+struct test_inline_array_size_from_enum_view;
+struct test_inline_array_of_unions_view;
+struct single_int_view;
+struct struct_with_a_bitfield_view;
+struct struct_with_some_defaults_view;
+struct struct_with_one_member_and_default_view;
+struct single_default_uint32_view;
+struct test_inline_array_default_struct1_view;
+struct test_inline_array_default_struct2_view;
+struct vector2_type_view;
+struct member_with_array_of_vector_view;
+struct struct_with_member_with_array_of_vector_view;
+struct union_with_weird_members_view;
+struct test_union_inline_array_view;
+struct test_union_array_view;
+struct test_union_ptr_view;
+struct test_has_union_array_view;
+struct union_with_weird_members_event_view;
+struct struct_with_array_of_weird_unions_view;
+struct test_with_union_array_view;
+struct test_lots_of_members_view;
+
+struct unused_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct unused* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    int32_t member() const { return dl_data->member; }
+};
+
+struct Pods_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct Pods* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    int8_t i8() const { return dl_data->i8; }
+    int16_t i16() const { return dl_data->i16; }
+    int32_t i32() const { return dl_data->i32; }
+    int64_t i64() const { return dl_data->i64; }
+    uint8_t u8() const { return dl_data->u8; }
+    uint16_t u16() const { return dl_data->u16; }
+    uint32_t u32() const { return dl_data->u32; }
+    uint64_t u64() const { return dl_data->u64; }
+    float f32() const { return dl_data->f32; }
+    double f64() const { return dl_data->f64; }
+};
+
+struct i8Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct i8Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    int8_t arr( uint32_t i ) const { return DL_VIEW_PTR( int8_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct i16Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct i16Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    int16_t arr( uint32_t i ) const { return DL_VIEW_PTR( int16_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct i32Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct i32Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    int32_t arr( uint32_t i ) const { return DL_VIEW_PTR( int32_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct i64Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct i64Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    int64_t arr( uint32_t i ) const { return DL_VIEW_PTR( int64_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct u8Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct u8Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    uint8_t arr( uint32_t i ) const { return DL_VIEW_PTR( uint8_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct u16Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct u16Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    uint16_t arr( uint32_t i ) const { return DL_VIEW_PTR( uint16_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct u32Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct u32Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    uint32_t arr( uint32_t i ) const { return DL_VIEW_PTR( uint32_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct u64Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct u64Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    uint64_t arr( uint32_t i ) const { return DL_VIEW_PTR( uint64_t const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct fp32Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct fp32Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    float arr( uint32_t i ) const { return DL_VIEW_PTR( float const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct fp64Array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct fp64Array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    double arr( uint32_t i ) const { return DL_VIEW_PTR( double const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct strArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct strArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    const char* arr( uint32_t i ) const { return DL_VIEW_PTR( const char*, dl_packed_instance, DL_VIEW_PTR( const char* const*, dl_packed_instance, dl_data->arr.data )[i] ); }
+};
+
+struct ptrArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct ptrArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    Pods_view arr( uint32_t i ) const;
+};
+
+struct enumArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct enumArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    TestEnum1 arr( uint32_t i ) const { return DL_VIEW_PTR( TestEnum1 const*, dl_packed_instance, dl_data->arr.data )[i]; }
+};
+
+struct default_empty_type_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct default_empty_type* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t empty() const { return dl_data->empty; }
+};
+
+struct type_with_meta_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct type_with_meta* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    int8_t i8() const { return dl_data->i8; }
+};
+
+struct test_union_simple_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_union_simple* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    enum test_union_simple_type type() const { return dl_data->type; }
+    int32_t item1() const { return dl_data->value.item1; }
+    float item2() const { return dl_data->value.item2; }
+    Pods_view item3() const;
+};
+
+struct MorePods_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct MorePods* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    Pods_view Pods1() const;
+    Pods_view Pods2() const;
+};
+
+struct Pods2_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct Pods2* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Int1() const { return dl_data->Int1; }
+    uint32_t Int2() const { return dl_data->Int2; }
+};
+
+struct Pod2InStruct_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct Pod2InStruct* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    Pods2_view Pod1() const;
+    Pods2_view Pod2() const;
+};
+
+struct PodPtr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct PodPtr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    Pods2_view PodPtr1() const;
+};
+
+struct Pod2InStructInStruct_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct Pod2InStructInStruct* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    Pod2InStruct_view p2struct() const;
+};
+
+struct WithInlineArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct WithInlineArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Array_count() const { return 3; }
+    uint32_t Array( uint32_t i ) const { return dl_data->Array[i]; }
+};
+
+struct WithInlineStructArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct WithInlineStructArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Array_count() const { return 3; }
+    Pods2_view Array( uint32_t i ) const;
+};
+
+struct WithInlineStructStructArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct WithInlineStructStructArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Array_count() const { return 2; }
+    WithInlineStructArray_view Array( uint32_t i ) const;
+};
+
+struct SubString_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct SubString* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    const char* Str() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->Str ); }
+};
+
+struct InlineArrayWithSubString_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct InlineArrayWithSubString* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Array_count() const { return 2; }
+    SubString_view Array( uint32_t i ) const;
+};
+
+struct PodArray1_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct PodArray1* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t u32_arr_count() const { return dl_data->u32_arr.count; }
+    uint32_t u32_arr( uint32_t i ) const { return DL_VIEW_PTR( uint32_t const*, dl_packed_instance, dl_data->u32_arr.data )[i]; }
+};
+
+struct PodArray2_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct PodArray2* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t sub_arr_count() const { return dl_data->sub_arr.count; }
+    PodArray1_view sub_arr( uint32_t i ) const;
+};
+
+struct StructArray1_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct StructArray1* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Array_count() const { return dl_data->Array.count; }
+    Pods2_view Array( uint32_t i ) const;
+};
+
+struct StructArrayRecursive1_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct StructArrayRecursive1* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Array_count() const { return dl_data->Array.count; }
+    StructArrayRecursive2_view Array( uint32_t i ) const;
+};
+
+struct StructArrayRecursive2_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct StructArrayRecursive2* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Array_count() const { return dl_data->Array.count; }
+    StructArrayRecursive1_view Array( uint32_t i ) const;
+};
+
+struct Strings_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct Strings* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    const char* Str1() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->Str1 ); }
+    const char* Str2() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->Str2 ); }
+};
+
+struct StringInlineArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct StringInlineArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Strings_count() const { return 3; }
+    const char* Strings( uint32_t i ) const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->Strings[i] ); }
+};
+
+struct StringArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct StringArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Strings_count() const { return dl_data->Strings.count; }
+    const char* Strings( uint32_t i ) const { return DL_VIEW_PTR( const char*, dl_packed_instance, DL_VIEW_PTR( const char* const*, dl_packed_instance, dl_data->Strings.data )[i] ); }
+};
+
+struct TestBits_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct TestBits* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint8_t Bit1() const { return dl_data->Bit1; }
+    uint8_t Bit2() const { return dl_data->Bit2; }
+    uint8_t Bit3() const { return dl_data->Bit3; }
+    uint8_t make_it_uneven() const { return dl_data->make_it_uneven; }
+    uint8_t Bit4() const { return dl_data->Bit4; }
+    uint8_t Bit5() const { return dl_data->Bit5; }
+    uint8_t Bit6() const { return dl_data->Bit6; }
+};
+
+struct MoreBits_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct MoreBits* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Bit1() const { return dl_data->Bit1; }
+    uint32_t Bit2() const { return dl_data->Bit2; }
+};
+
+struct BitBitfield64_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct BitBitfield64* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint64_t Package() const { return dl_data->Package; }
+    uint64_t FileType() const { return dl_data->FileType; }
+    uint64_t PathHash() const { return dl_data->PathHash; }
+    uint64_t FileHash() const { return dl_data->FileHash; }
+};
+
+struct SimplePtr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct SimplePtr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    Pods_view Ptr1() const;
+    Pods_view Ptr2() const;
+};
+
+struct PtrChain_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct PtrChain* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Int() const { return dl_data->Int; }
+    PtrChain_view Next() const;
+};
+
+struct DoublePtrChain_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DoublePtrChain* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Int() const { return dl_data->Int; }
+    DoublePtrChain_view Next() const;
+    DoublePtrChain_view Prev() const;
+};
+
+struct inline_ptr_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct inline_ptr_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return 3; }
+    Pods2_view arr( uint32_t i ) const;
+};
+
+struct ptr_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct ptr_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    Pods2_view arr( uint32_t i ) const;
+};
+
+struct ptr_inline_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct ptr_inline_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    WithInlineArray_view ptr() const;
+};
+
+struct ptr_inline_array2_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct ptr_inline_array2* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    WithInlineStructArray_view ptr() const;
+};
+
+struct inline_array_pod_ptr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct inline_array_pod_ptr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t inlarr_count() const { return 2; }
+    PodPtr_view inlarr( uint32_t i ) const;
+};
+
+struct ptr_struct_inline_array_ptr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct ptr_struct_inline_array_ptr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    inline_array_pod_ptr_view ptr() const;
+};
+
+struct A128BitAlignedType_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct A128BitAlignedType* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Int() const { return dl_data->Int; }
+};
+
+struct TestingEnum_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct TestingEnum* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    TestEnum1 TheEnum() const { return dl_data->TheEnum; }
+};
+
+struct InlineArrayEnum_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct InlineArrayEnum* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t EnumArr_count() const { return 4; }
+    TestEnum2 EnumArr( uint32_t i ) const { return dl_data->EnumArr[i]; }
+};
+
+struct ArrayEnum_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct ArrayEnum* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t EnumArr_count() const { return dl_data->EnumArr.count; }
+    TestEnum2 EnumArr( uint32_t i ) const { return DL_VIEW_PTR( TestEnum2 const*, dl_packed_instance, dl_data->EnumArr.data )[i]; }
+};
+
+struct PodsDefaults_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct PodsDefaults* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    int8_t i8() const { return dl_data->i8; }
+    int16_t i16() const { return dl_data->i16; }
+    int32_t i32() const { return dl_data->i32; }
+    int64_t i64() const { return dl_data->i64; }
+    uint8_t u8() const { return dl_data->u8; }
+    uint16_t u16() const { return dl_data->u16; }
+    uint32_t u32() const { return dl_data->u32; }
+    uint64_t u64() const { return dl_data->u64; }
+    float f32() const { return dl_data->f32; }
+    double f64() const { return dl_data->f64; }
+};
+
+struct BitfieldDefaultsMulti_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct BitfieldDefaultsMulti* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint16_t f1() const { return dl_data->f1; }
+    uint16_t f2() const { return dl_data->f2; }
+    uint16_t f3() const { return dl_data->f3; }
+    uint16_t f4() const { return dl_data->f4; }
+    uint16_t f5() const { return dl_data->f5; }
+    uint16_t f6() const { return dl_data->f6; }
+};
+
+struct DefaultStr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultStr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    const char* Str() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->Str ); }
+};
+
+struct DefaultEnum_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultEnum* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    TestEnum1 Enum() const { return dl_data->Enum; }
+};
+
+struct DefaultStruct_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultStruct* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    Pods2_view Struct() const;
+};
+
+struct DefaultPtr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultPtr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    Pods_view Ptr() const;
+};
+
+struct DefaultInlArrayPod_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultInlArrayPod* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Arr_count() const { return 4; }
+    uint32_t Arr( uint32_t i ) const { return dl_data->Arr[i]; }
+};
+
+struct DefaultInlArrayStr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultInlArrayStr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Arr_count() const { return 4; }
+    const char* Arr( uint32_t i ) const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->Arr[i] ); }
+};
+
+struct DefaultInlArrayEnum_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultInlArrayEnum* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Arr_count() const { return 4; }
+    TestEnum1 Arr( uint32_t i ) const { return dl_data->Arr[i]; }
+};
+
+struct DefaultInlArrayArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultInlArrayArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Arr_count() const { return 2; }
+    PodArray1_view Arr( uint32_t i ) const;
+};
+
+struct DefaultArrayPod_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultArrayPod* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Arr_count() const { return dl_data->Arr.count; }
+    uint32_t Arr( uint32_t i ) const { return DL_VIEW_PTR( uint32_t const*, dl_packed_instance, dl_data->Arr.data )[i]; }
+};
+
+struct DefaultArrayStr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultArrayStr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Arr_count() const { return dl_data->Arr.count; }
+    const char* Arr( uint32_t i ) const { return DL_VIEW_PTR( const char*, dl_packed_instance, DL_VIEW_PTR( const char* const*, dl_packed_instance, dl_data->Arr.data )[i] ); }
+};
+
+struct DefaultArrayEnum_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultArrayEnum* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Arr_count() const { return dl_data->Arr.count; }
+    TestEnum1 Arr( uint32_t i ) const { return DL_VIEW_PTR( TestEnum1 const*, dl_packed_instance, dl_data->Arr.data )[i]; }
+};
+
+struct DefaultArrayArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultArrayArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t Arr_count() const { return dl_data->Arr.count; }
+    PodArray1_view Arr( uint32_t i ) const;
+};
+
+struct DefaultWithOtherDataBefore_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct DefaultWithOtherDataBefore* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    const char* t1() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->t1 ); }
+    const char* Str() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->Str ); }
+};
+
+struct issue_40_1_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct issue_40_1* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t submember1_count() const { return dl_data->submember1.count; }
+    const char* submember1( uint32_t i ) const { return DL_VIEW_PTR( const char*, dl_packed_instance, DL_VIEW_PTR( const char* const*, dl_packed_instance, dl_data->submember1.data )[i] ); }
+    uint32_t submember2() const { return dl_data->submember2; }
+};
+
+struct issue_40_2_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct issue_40_2* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    issue_40_1_view member1() const;
+};
+
+struct with_alias_enum_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct with_alias_enum* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    multi_alias_enum e1() const { return dl_data->e1; }
+    multi_alias_enum e2() const { return dl_data->e2; }
+    multi_alias_enum e3() const { return dl_data->e3; }
+    multi_alias_enum e4() const { return dl_data->e4; }
+};
+
+struct BugTest4_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct BugTest4* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t struct_with_str_arr_count() const { return dl_data->struct_with_str_arr.count; }
+    StringArray_view struct_with_str_arr( uint32_t i ) const;
+};
+
+struct BugTest5_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct BugTest5* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t array_count() const { return dl_data->array.count; }
+    PtrChain_view array( uint32_t i ) const;
+};
+
+struct PtrHolder_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct PtrHolder* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    Pods2_view ptr() const;
+};
+
+struct PtrArray_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct PtrArray* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    PtrHolder_view arr( uint32_t i ) const;
+};
+
+struct circular_array_ptr_holder_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct circular_array_ptr_holder* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    circular_array_view ptr() const;
+};
+
+struct circular_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct circular_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint16_t val() const { return dl_data->val; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    circular_array_ptr_holder_view arr( uint32_t i ) const;
+};
+
+struct str_before_array_bug_arr_type_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct str_before_array_bug_arr_type* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    const char* str() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->str ); }
+};
+
+struct str_before_array_bug_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct str_before_array_bug* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    const char* str() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->str ); }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    str_before_array_bug_arr_type_view arr( uint32_t i ) const;
+};
+
+struct bug_array_alignment_struct_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct bug_array_alignment_struct* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t type() const { return dl_data->type; }
+    uint64_t ptr() const { return dl_data->ptr; }
+    uint32_t used_sources() const { return dl_data->used_sources; }
+};
+
+struct bug_alignment_struct_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct bug_alignment_struct* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t i32() const { return dl_data->i32; }
+    A128BitAlignedType_view aligned() const;
+    Pods2_view ptr() const;
+};
+
+struct bug_array_alignment_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct bug_array_alignment* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t components_count() const { return dl_data->components.count; }
+    bug_array_alignment_struct_view components( uint32_t i ) const;
+};
+
+struct test_array_pad_1_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_array_pad_1* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t ptr_count() const { return dl_data->ptr.count; }
+    uint8_t ptr( uint32_t i ) const { return DL_VIEW_PTR( uint8_t const*, dl_packed_instance, dl_data->ptr.data )[i]; }
+    uint32_t type() const { return dl_data->type; }
+};
+
+struct test_array_pad_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_array_pad* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t components_count() const { return dl_data->components.count; }
+    test_array_pad_1_view components( uint32_t i ) const;
+};
+
+struct array_subdata_elem_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct array_subdata_elem* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    const char* str() const { return DL_VIEW_PTR( const char*, dl_packed_instance, dl_data->str ); }
+    uint32_t aligned_count() const { return dl_data->aligned.count; }
+    A128BitAlignedType_view aligned( uint32_t i ) const;
+    uint32_t strs_count() const { return dl_data->strs.count; }
+    const char* strs( uint32_t i ) const { return DL_VIEW_PTR( const char*, dl_packed_instance, DL_VIEW_PTR( const char* const*, dl_packed_instance, dl_data->strs.data )[i] ); }
+    Pods2_view ptr() const;
+};
+
+struct array_subdata_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct array_subdata* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return dl_data->arr.count; }
+    array_subdata_elem_view arr( uint32_t i ) const;
+};
+
+struct test_inline_array_size_from_enum_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_inline_array_size_from_enum* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr1_count() const { return 7; }
+    int32_t arr1( uint32_t i ) const { return dl_data->arr1[i]; }
+    uint32_t arr2_count() const { return 3; }
+    int32_t arr2( uint32_t i ) const { return dl_data->arr2[i]; }
+};
+
+struct test_inline_array_of_unions_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_inline_array_of_unions* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return 3; }
+    test_union_simple_view arr( uint32_t i ) const;
+};
+
+struct single_int_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct single_int* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    int32_t val() const { return dl_data->val; }
+};
+
+struct struct_with_a_bitfield_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct struct_with_a_bitfield* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint64_t my_variable_1() const { return dl_data->my_variable_1; }
+    uint32_t my_variable_2() const { return dl_data->my_variable_2; }
+    uint8_t my_variable_3() const { return dl_data->my_variable_3; }
+};
+
+struct struct_with_some_defaults_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct struct_with_some_defaults* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t some_variable_1() const { return dl_data->some_variable_1; }
+    float some_variable_2() const { return dl_data->some_variable_2; }
+    float some_variable_3() const { return dl_data->some_variable_3; }
+    float some_variable_4() const { return dl_data->some_variable_4; }
+    float some_variable_5() const { return dl_data->some_variable_5; }
+};
+
+struct struct_with_one_member_and_default_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct struct_with_one_member_and_default* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t dummy() const { return dl_data->dummy; }
+};
+
+struct single_default_uint32_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct single_default_uint32* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t u() const { return dl_data->u; }
+};
+
+struct test_inline_array_default_struct1_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_inline_array_default_struct1* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return 3; }
+    single_default_uint32_view arr( uint32_t i ) const;
+};
+
+struct test_inline_array_default_struct2_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_inline_array_default_struct2* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t arr_count() const { return 3; }
+    single_default_uint32_view arr( uint32_t i ) const;
+};
+
+struct vector2_type_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct vector2_type* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    float x() const { return dl_data->x; }
+    float y() const { return dl_data->y; }
+};
+
+struct member_with_array_of_vector_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct member_with_array_of_vector* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t varr_count() const { return 2; }
+    vector2_type_view varr( uint32_t i ) const;
+};
+
+struct struct_with_member_with_array_of_vector_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct struct_with_member_with_array_of_vector* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    member_with_array_of_vector_view a() const;
+};
+
+struct union_with_weird_members_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct union_with_weird_members* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    enum union_with_weird_members_type type() const { return dl_data->type; }
+    struct_with_a_bitfield_view spawn_particles() const;
+    struct_with_some_defaults_view decay() const;
+    struct_with_one_member_and_default_view hide_all_meshes() const;
+};
+
+struct test_union_inline_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_union_inline_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    enum test_union_inline_array_type type() const { return dl_data->type; }
+    int32_t i32() const { return dl_data->value.i32; }
+    uint32_t inlarr_count() const { return 6; }
+    int32_t inlarr( uint32_t i ) const { return dl_data->value.inlarr[i]; }
+};
+
+struct test_union_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_union_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    enum test_union_array_type type() const { return dl_data->type; }
+    int32_t i32() const { return dl_data->value.i32; }
+    uint32_t arr_count() const { return dl_data->type == test_union_array_type_arr ? dl_data->value.arr.count : 0; }
+    int32_t arr( uint32_t i ) const { if( dl_data->type != test_union_array_type_arr ) return {}; return DL_VIEW_PTR( int32_t const*, dl_packed_instance, dl_data->value.arr.data )[i]; }
+};
+
+struct test_union_ptr_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_union_ptr* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    enum test_union_ptr_type type() const { return dl_data->type; }
+    Pods_view p1() const;
+    SubString_view p2() const;
+    WithInlineArray_view p3() const;
+};
+
+struct test_has_union_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_has_union_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    enum test_has_union_array_type type() const { return dl_data->type; }
+    uint32_t floats_count() const { return dl_data->type == test_has_union_array_type_floats ? dl_data->value.floats.count : 0; }
+    float floats( uint32_t i ) const { if( dl_data->type != test_has_union_array_type_floats ) return {}; return DL_VIEW_PTR( float const*, dl_packed_instance, dl_data->value.floats.data )[i]; }
+    uint32_t ints_count() const { return dl_data->type == test_has_union_array_type_ints ? dl_data->value.ints.count : 0; }
+    int32_t ints( uint32_t i ) const { if( dl_data->type != test_has_union_array_type_ints ) return {}; return DL_VIEW_PTR( int32_t const*, dl_packed_instance, dl_data->value.ints.data )[i]; }
+};
+
+struct union_with_weird_members_event_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct union_with_weird_members_event* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    union_with_weird_members_view effect() const;
+    float delay() const { return dl_data->delay; }
+};
+
+struct struct_with_array_of_weird_unions_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct struct_with_array_of_weird_unions* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t event_array_count() const { return dl_data->event_array.count; }
+    union_with_weird_members_event_view event_array( uint32_t i ) const;
+};
+
+struct test_with_union_array_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_with_union_array* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint32_t properties_count() const { return dl_data->properties.count; }
+    test_has_union_array_view properties( uint32_t i ) const;
+};
+
+struct test_lots_of_members_view
+{
+    const unsigned char* dl_packed_instance;
+    const struct test_lots_of_members* dl_data;
+
+    explicit operator bool() const { return dl_data != 0; }
+    uint8_t mem00() const { return dl_data->mem00; }
+    uint8_t mem01() const { return dl_data->mem01; }
+    uint8_t mem02() const { return dl_data->mem02; }
+    uint8_t mem03() const { return dl_data->mem03; }
+    uint8_t mem04() const { return dl_data->mem04; }
+    uint8_t mem05() const { return dl_data->mem05; }
+    uint8_t mem06() const { return dl_data->mem06; }
+    uint8_t mem07() const { return dl_data->mem07; }
+    uint8_t mem08() const { return dl_data->mem08; }
+    uint8_t mem09() const { return dl_data->mem09; }
+    uint8_t mem10() const { return dl_data->mem10; }
+    uint8_t mem11() const { return dl_data->mem11; }
+    uint8_t mem12() const { return dl_data->mem12; }
+    uint8_t mem13() const { return dl_data->mem13; }
+    uint8_t mem14() const { return dl_data->mem14; }
+    uint8_t mem15() const { return dl_data->mem15; }
+    uint8_t mem16() const { return dl_data->mem16; }
+    uint8_t mem17() const { return dl_data->mem17; }
+    uint8_t mem18() const { return dl_data->mem18; }
+    uint8_t mem19() const { return dl_data->mem19; }
+    uint8_t mem20() const { return dl_data->mem20; }
+    uint8_t mem21() const { return dl_data->mem21; }
+    uint8_t mem22() const { return dl_data->mem22; }
+    uint8_t mem23() const { return dl_data->mem23; }
+    uint8_t mem24() const { return dl_data->mem24; }
+    uint8_t mem25() const { return dl_data->mem25; }
+    uint8_t mem26() const { return dl_data->mem26; }
+    uint8_t mem27() const { return dl_data->mem27; }
+    uint8_t mem28() const { return dl_data->mem28; }
+    uint8_t mem29() const { return dl_data->mem29; }
+    uint8_t mem30() const { return dl_data->mem30; }
+    uint8_t mem31() const { return dl_data->mem31; }
+    uint8_t mem32() const { return dl_data->mem32; }
+    uint8_t mem33() const { return dl_data->mem33; }
+    uint8_t mem34() const { return dl_data->mem34; }
+    uint8_t mem35() const { return dl_data->mem35; }
+    uint8_t mem36() const { return dl_data->mem36; }
+    uint8_t mem37() const { return dl_data->mem37; }
+    uint8_t mem38() const { return dl_data->mem38; }
+    uint8_t mem39() const { return dl_data->mem39; }
+    uint8_t mem40() const { return dl_data->mem40; }
+    uint8_t mem41() const { return dl_data->mem41; }
+    uint8_t mem42() const { return dl_data->mem42; }
+    uint8_t mem43() const { return dl_data->mem43; }
+    uint8_t mem44() const { return dl_data->mem44; }
+    uint8_t mem45() const { return dl_data->mem45; }
+    uint8_t mem46() const { return dl_data->mem46; }
+    uint8_t mem47() const { return dl_data->mem47; }
+    uint8_t mem48() const { return dl_data->mem48; }
+    uint8_t mem49() const { return dl_data->mem49; }
+    uint8_t mem50() const { return dl_data->mem50; }
+    uint8_t mem51() const { return dl_data->mem51; }
+    uint8_t mem52() const { return dl_data->mem52; }
+    uint8_t mem53() const { return dl_data->mem53; }
+    uint8_t mem54() const { return dl_data->mem54; }
+    uint8_t mem55() const { return dl_data->mem55; }
+    uint8_t mem56() const { return dl_data->mem56; }
+    uint8_t mem57() const { return dl_data->mem57; }
+    uint8_t mem58() const { return dl_data->mem58; }
+    uint8_t mem59() const { return dl_data->mem59; }
+    uint8_t mem60() const { return dl_data->mem60; }
+    uint8_t mem61() const { return dl_data->mem61; }
+    uint8_t mem62() const { return dl_data->mem62; }
+    uint8_t mem63() const { return dl_data->mem63; }
+    uint8_t mem64() const { return dl_data->mem64; }
+    uint8_t mem65() const { return dl_data->mem65; }
+    uint8_t mem66() const { return dl_data->mem66; }
+    uint8_t mem67() const { return dl_data->mem67; }
+    uint8_t mem68() const { return dl_data->mem68; }
+    uint8_t mem69() const { return dl_data->mem69; }
+    uint8_t mem70() const { return dl_data->mem70; }
+    uint8_t mem71() const { return dl_data->mem71; }
+    uint8_t mem72() const { return dl_data->mem72; }
+    uint8_t mem73() const { return dl_data->mem73; }
+    uint8_t mem74() const { return dl_data->mem74; }
+    uint8_t mem75() const { return dl_data->mem75; }
+    uint8_t mem76() const { return dl_data->mem76; }
+    uint8_t mem77() const { return dl_data->mem77; }
+    uint8_t mem78() const { return dl_data->mem78; }
+    uint8_t mem79() const { return dl_data->mem79; }
+};
+
+inline Pods_view ptrArray_view::arr( uint32_t i ) const { return Pods_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods*, dl_packed_instance, DL_VIEW_PTR( struct Pods* const*, dl_packed_instance, dl_data->arr.data )[i] ) }; }
+inline Pods_view test_union_simple_view::item3() const { if( dl_data->type != test_union_simple_type_item3 ) return {}; return Pods_view{ dl_packed_instance, &dl_data->value.item3 }; }
+inline Pods_view MorePods_view::Pods1() const { return Pods_view{ dl_packed_instance, &dl_data->Pods1 }; }
+inline Pods_view MorePods_view::Pods2() const { return Pods_view{ dl_packed_instance, &dl_data->Pods2 }; }
+inline Pods2_view Pod2InStruct_view::Pod1() const { return Pods2_view{ dl_packed_instance, &dl_data->Pod1 }; }
+inline Pods2_view Pod2InStruct_view::Pod2() const { return Pods2_view{ dl_packed_instance, &dl_data->Pod2 }; }
+inline Pods2_view PodPtr_view::PodPtr1() const { return Pods2_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods2*, dl_packed_instance, dl_data->PodPtr1 ) }; }
+inline Pod2InStruct_view Pod2InStructInStruct_view::p2struct() const { return Pod2InStruct_view{ dl_packed_instance, &dl_data->p2struct }; }
+inline Pods2_view WithInlineStructArray_view::Array( uint32_t i ) const { return Pods2_view{ dl_packed_instance, &dl_data->Array[i] }; }
+inline WithInlineStructArray_view WithInlineStructStructArray_view::Array( uint32_t i ) const { return WithInlineStructArray_view{ dl_packed_instance, &dl_data->Array[i] }; }
+inline SubString_view InlineArrayWithSubString_view::Array( uint32_t i ) const { return SubString_view{ dl_packed_instance, &dl_data->Array[i] }; }
+inline PodArray1_view PodArray2_view::sub_arr( uint32_t i ) const { return PodArray1_view{ dl_packed_instance, &DL_VIEW_PTR( struct PodArray1 const*, dl_packed_instance, dl_data->sub_arr.data )[i] }; }
+inline Pods2_view StructArray1_view::Array( uint32_t i ) const { return Pods2_view{ dl_packed_instance, &DL_VIEW_PTR( struct Pods2 const*, dl_packed_instance, dl_data->Array.data )[i] }; }
+inline StructArrayRecursive2_view StructArrayRecursive1_view::Array( uint32_t i ) const { return StructArrayRecursive2_view{ dl_packed_instance, &DL_VIEW_PTR( struct StructArrayRecursive2 const*, dl_packed_instance, dl_data->Array.data )[i] }; }
+inline StructArrayRecursive1_view StructArrayRecursive2_view::Array( uint32_t i ) const { return StructArrayRecursive1_view{ dl_packed_instance, &DL_VIEW_PTR( struct StructArrayRecursive1 const*, dl_packed_instance, dl_data->Array.data )[i] }; }
+inline Pods_view SimplePtr_view::Ptr1() const { return Pods_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods*, dl_packed_instance, dl_data->Ptr1 ) }; }
+inline Pods_view SimplePtr_view::Ptr2() const { return Pods_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods*, dl_packed_instance, dl_data->Ptr2 ) }; }
+inline PtrChain_view PtrChain_view::Next() const { return PtrChain_view{ dl_packed_instance, DL_VIEW_PTR( const struct PtrChain*, dl_packed_instance, dl_data->Next ) }; }
+inline DoublePtrChain_view DoublePtrChain_view::Next() const { return DoublePtrChain_view{ dl_packed_instance, DL_VIEW_PTR( const struct DoublePtrChain*, dl_packed_instance, dl_data->Next ) }; }
+inline DoublePtrChain_view DoublePtrChain_view::Prev() const { return DoublePtrChain_view{ dl_packed_instance, DL_VIEW_PTR( const struct DoublePtrChain*, dl_packed_instance, dl_data->Prev ) }; }
+inline Pods2_view inline_ptr_array_view::arr( uint32_t i ) const { return Pods2_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods2*, dl_packed_instance, dl_data->arr[i] ) }; }
+inline Pods2_view ptr_array_view::arr( uint32_t i ) const { return Pods2_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods2*, dl_packed_instance, DL_VIEW_PTR( struct Pods2* const*, dl_packed_instance, dl_data->arr.data )[i] ) }; }
+inline WithInlineArray_view ptr_inline_array_view::ptr() const { return WithInlineArray_view{ dl_packed_instance, DL_VIEW_PTR( const struct WithInlineArray*, dl_packed_instance, dl_data->ptr ) }; }
+inline WithInlineStructArray_view ptr_inline_array2_view::ptr() const { return WithInlineStructArray_view{ dl_packed_instance, DL_VIEW_PTR( const struct WithInlineStructArray*, dl_packed_instance, dl_data->ptr ) }; }
+inline PodPtr_view inline_array_pod_ptr_view::inlarr( uint32_t i ) const { return PodPtr_view{ dl_packed_instance, &dl_data->inlarr[i] }; }
+inline inline_array_pod_ptr_view ptr_struct_inline_array_ptr_view::ptr() const { return inline_array_pod_ptr_view{ dl_packed_instance, DL_VIEW_PTR( const struct inline_array_pod_ptr*, dl_packed_instance, dl_data->ptr ) }; }
+inline Pods2_view DefaultStruct_view::Struct() const { return Pods2_view{ dl_packed_instance, &dl_data->Struct }; }
+inline Pods_view DefaultPtr_view::Ptr() const { return Pods_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods*, dl_packed_instance, dl_data->Ptr ) }; }
+inline PodArray1_view DefaultInlArrayArray_view::Arr( uint32_t i ) const { return PodArray1_view{ dl_packed_instance, &dl_data->Arr[i] }; }
+inline PodArray1_view DefaultArrayArray_view::Arr( uint32_t i ) const { return PodArray1_view{ dl_packed_instance, &DL_VIEW_PTR( struct PodArray1 const*, dl_packed_instance, dl_data->Arr.data )[i] }; }
+inline issue_40_1_view issue_40_2_view::member1() const { return issue_40_1_view{ dl_packed_instance, &dl_data->member1 }; }
+inline StringArray_view BugTest4_view::struct_with_str_arr( uint32_t i ) const { return StringArray_view{ dl_packed_instance, &DL_VIEW_PTR( struct StringArray const*, dl_packed_instance, dl_data->struct_with_str_arr.data )[i] }; }
+inline PtrChain_view BugTest5_view::array( uint32_t i ) const { return PtrChain_view{ dl_packed_instance, &DL_VIEW_PTR( struct PtrChain const*, dl_packed_instance, dl_data->array.data )[i] }; }
+inline Pods2_view PtrHolder_view::ptr() const { return Pods2_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods2*, dl_packed_instance, dl_data->ptr ) }; }
+inline PtrHolder_view PtrArray_view::arr( uint32_t i ) const { return PtrHolder_view{ dl_packed_instance, &DL_VIEW_PTR( struct PtrHolder const*, dl_packed_instance, dl_data->arr.data )[i] }; }
+inline circular_array_view circular_array_ptr_holder_view::ptr() const { return circular_array_view{ dl_packed_instance, DL_VIEW_PTR( const struct circular_array*, dl_packed_instance, dl_data->ptr ) }; }
+inline circular_array_ptr_holder_view circular_array_view::arr( uint32_t i ) const { return circular_array_ptr_holder_view{ dl_packed_instance, &DL_VIEW_PTR( struct circular_array_ptr_holder const*, dl_packed_instance, dl_data->arr.data )[i] }; }
+inline str_before_array_bug_arr_type_view str_before_array_bug_view::arr( uint32_t i ) const { return str_before_array_bug_arr_type_view{ dl_packed_instance, &DL_VIEW_PTR( struct str_before_array_bug_arr_type const*, dl_packed_instance, dl_data->arr.data )[i] }; }
+inline A128BitAlignedType_view bug_alignment_struct_view::aligned() const { return A128BitAlignedType_view{ dl_packed_instance, &dl_data->aligned }; }
+inline Pods2_view bug_alignment_struct_view::ptr() const { return Pods2_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods2*, dl_packed_instance, dl_data->ptr ) }; }
+inline bug_array_alignment_struct_view bug_array_alignment_view::components( uint32_t i ) const { return bug_array_alignment_struct_view{ dl_packed_instance, &DL_VIEW_PTR( struct bug_array_alignment_struct const*, dl_packed_instance, dl_data->components.data )[i] }; }
+inline test_array_pad_1_view test_array_pad_view::components( uint32_t i ) const { return test_array_pad_1_view{ dl_packed_instance, &DL_VIEW_PTR( struct test_array_pad_1 const*, dl_packed_instance, dl_data->components.data )[i] }; }
+inline A128BitAlignedType_view array_subdata_elem_view::aligned( uint32_t i ) const { return A128BitAlignedType_view{ dl_packed_instance, &DL_VIEW_PTR( struct A128BitAlignedType const*, dl_packed_instance, dl_data->aligned.data )[i] }; }
+inline Pods2_view array_subdata_elem_view::ptr() const { return Pods2_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods2*, dl_packed_instance, dl_data->ptr ) }; }
+inline array_subdata_elem_view array_subdata_view::arr( uint32_t i ) const { return array_subdata_elem_view{ dl_packed_instance, &DL_VIEW_PTR( struct array_subdata_elem const*, dl_packed_instance, dl_data->arr.data )[i] }; }
+inline test_union_simple_view test_inline_array_of_unions_view::arr( uint32_t i ) const { return test_union_simple_view{ dl_packed_instance, &dl_data->arr[i] }; }
+inline single_default_uint32_view test_inline_array_default_struct1_view::arr( uint32_t i ) const { return single_default_uint32_view{ dl_packed_instance, &dl_data->arr[i] }; }
+inline single_default_uint32_view test_inline_array_default_struct2_view::arr( uint32_t i ) const { return single_default_uint32_view{ dl_packed_instance, &dl_data->arr[i] }; }
+inline vector2_type_view member_with_array_of_vector_view::varr( uint32_t i ) const { return vector2_type_view{ dl_packed_instance, &dl_data->varr[i] }; }
+inline member_with_array_of_vector_view struct_with_member_with_array_of_vector_view::a() const { return member_with_array_of_vector_view{ dl_packed_instance, &dl_data->a }; }
+inline struct_with_a_bitfield_view union_with_weird_members_view::spawn_particles() const { if( dl_data->type != union_with_weird_members_type_spawn_particles ) return {}; return struct_with_a_bitfield_view{ dl_packed_instance, &dl_data->value.spawn_particles }; }
+inline struct_with_some_defaults_view union_with_weird_members_view::decay() const { if( dl_data->type != union_with_weird_members_type_decay ) return {}; return struct_with_some_defaults_view{ dl_packed_instance, &dl_data->value.decay }; }
+inline struct_with_one_member_and_default_view union_with_weird_members_view::hide_all_meshes() const { if( dl_data->type != union_with_weird_members_type_hide_all_meshes ) return {}; return struct_with_one_member_and_default_view{ dl_packed_instance, &dl_data->value.hide_all_meshes }; }
+inline Pods_view test_union_ptr_view::p1() const { if( dl_data->type != test_union_ptr_type_p1 ) return {}; return Pods_view{ dl_packed_instance, DL_VIEW_PTR( const struct Pods*, dl_packed_instance, dl_data->value.p1 ) }; }
+inline SubString_view test_union_ptr_view::p2() const { if( dl_data->type != test_union_ptr_type_p2 ) return {}; return SubString_view{ dl_packed_instance, DL_VIEW_PTR( const struct SubString*, dl_packed_instance, dl_data->value.p2 ) }; }
+inline WithInlineArray_view test_union_ptr_view::p3() const { if( dl_data->type != test_union_ptr_type_p3 ) return {}; return WithInlineArray_view{ dl_packed_instance, DL_VIEW_PTR( const struct WithInlineArray*, dl_packed_instance, dl_data->value.p3 ) }; }
+inline union_with_weird_members_view union_with_weird_members_event_view::effect() const { return union_with_weird_members_view{ dl_packed_instance, &dl_data->effect }; }
+inline union_with_weird_members_event_view struct_with_array_of_weird_unions_view::event_array( uint32_t i ) const { return union_with_weird_members_event_view{ dl_packed_instance, &DL_VIEW_PTR( struct union_with_weird_members_event const*, dl_packed_instance, dl_data->event_array.data )[i] }; }
+inline test_has_union_array_view test_with_union_array_view::properties( uint32_t i ) const { return test_has_union_array_view{ dl_packed_instance, &DL_VIEW_PTR( struct test_has_union_array const*, dl_packed_instance, dl_data->properties.data )[i] }; }
+
+#endif // defined( __cplusplus )
+
+#endif // __DL_AUTOGEN_HEADER_UNITTEST_H_INCLUDED
+
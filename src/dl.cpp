@@ -2,10 +2,13 @@
 #include "dl_swap.h"
 #include "dl_binary_writer.h"
 #include "dl_patch_ptr.h"
+#include "dl_hash_table.h"
 
 #include <dl/dl.h>
 
 #include <algorithm>
+#include <system_error>
+#include <thread>
 
 dl_error_t dl_context_create( dl_ctx_t* dl_ctx, dl_create_params_t* create_params )
 {
@@ -23,23 +26,127 @@ dl_error_t dl_context_create( dl_ctx_t* dl_ctx, dl_create_params_t* create_param
 	ctx->error_msg_func = create_params->error_msg_func;
 	ctx->error_msg_ctx  = create_params->error_msg_ctx;
 
+	ctx->store_merge_strings = create_params->disable_string_merge == 0;
+
 	*dl_ctx = ctx;
 
 	return DL_ERROR_OK;
 }
 
+static dl_hash_lookup::slot* dl_internal_lookup_alloc( dl_ctx_t ctx, dl_hash_lookup* lookup, uint32_t count )
+{
+	dl_free( &ctx->alloc, lookup->slots );
+	memset( lookup, 0x0, sizeof( dl_hash_lookup ) );
+
+	if( count == 0 )
+		return 0x0;
+
+	// keep load-factor <= 0.5 to keep probe-sequences short.
+	uint32_t slot_count = 8;
+	while( slot_count < count * 2 )
+		slot_count *= 2;
+
+	dl_hash_lookup::slot* slots = (dl_hash_lookup::slot*)dl_alloc( &ctx->alloc, sizeof( dl_hash_lookup::slot ) * slot_count );
+	if( slots == 0x0 )
+		return 0x0; // ... all lookups will fall back to a linear search.
+
+	for( uint32_t i = 0; i < slot_count; ++i )
+		slots[i].index = UINT32_MAX;
+
+	lookup->slots = slots;
+	lookup->mask  = slot_count - 1;
+	lookup->count = count;
+	return slots;
+}
+
+static void dl_internal_lookup_insert( dl_hash_lookup* lookup, uint32_t hash, uint32_t key, uint32_t index )
+{
+	// no check for duplicates, if the same key is inserted multiple times the first one will be found first
+	// while probing, same as a linear search would.
+	uint32_t slot = hash & lookup->mask;
+	while( lookup->slots[slot].index != UINT32_MAX )
+		slot = ( slot + 1 ) & lookup->mask;
+
+	lookup->slots[slot].key   = key;
+	lookup->slots[slot].index = index;
+}
+
+void dl_internal_build_lookups( dl_ctx_t ctx )
+{
+	if( dl_internal_lookup_alloc( ctx, &ctx->type_lookup, ctx->type_count ) )
+		for( uint32_t i = 0; i < ctx->type_count; ++i )
+			dl_internal_lookup_insert( &ctx->type_lookup, dl_internal_lookup_hash( ctx->type_ids[i] ), ctx->type_ids[i], i );
+
+	if( dl_internal_lookup_alloc( ctx, &ctx->enum_lookup, ctx->enum_count ) )
+		for( uint32_t i = 0; i < ctx->enum_count; ++i )
+			dl_internal_lookup_insert( &ctx->enum_lookup, dl_internal_lookup_hash( ctx->enum_ids[i] ), ctx->enum_ids[i], i );
+
+	if( dl_internal_lookup_alloc( ctx, &ctx->type_name_lookup, ctx->type_count ) )
+	{
+		for( uint32_t i = 0; i < ctx->type_count; ++i )
+		{
+			uint32_t name_hash = dl_internal_hash_string( dl_internal_type_name( ctx, ctx->type_descs + i ) );
+			dl_internal_lookup_insert( &ctx->type_name_lookup, dl_internal_lookup_hash( name_hash ), name_hash, i );
+		}
+	}
+
+	if( dl_internal_lookup_alloc( ctx, &ctx->member_lookup, ctx->member_count ) )
+	{
+		for( uint32_t i = 0; i < ctx->type_count; ++i )
+		{
+			const dl_type_desc* type = ctx->type_descs + i;
+			for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+			{
+				uint32_t name_hash = dl_internal_hash_string( dl_internal_member_name( ctx, dl_get_type_member( ctx, type, member_index ) ) );
+				dl_internal_lookup_insert( &ctx->member_lookup, dl_internal_lookup_member_hash( type, name_hash ), name_hash, type->member_start + member_index );
+			}
+		}
+	}
+}
+
+dl_error_t dl_context_freeze( dl_ctx_t dl_ctx )
+{
+	if( dl_ctx->frozen )
+		return DL_ERROR_OK;
+
+	// make sure that all descriptors are indexed so that no lookups need to fall back to linear search.
+	if( dl_ctx->type_lookup.count   != dl_ctx->type_count ||
+		dl_ctx->enum_lookup.count   != dl_ctx->enum_count ||
+		dl_ctx->member_lookup.count != dl_ctx->member_count )
+		dl_internal_build_lookups( dl_ctx );
+
+	if( dl_ctx->type_plan_count != dl_ctx->type_count )
+		dl_internal_build_plans( dl_ctx );
+
+	dl_ctx->frozen = true;
+	return DL_ERROR_OK;
+}
+
+static void dl_internal_free_descriptors( dl_ctx_t dl_ctx, void* descs )
+{
+	// descriptors borrowed from a type library loaded with dl_context_load_type_library_inplace is owned by the user.
+	if( !dl_internal_is_borrowed( dl_ctx, descs ) )
+		dl_free( &dl_ctx->alloc, descs );
+}
+
 dl_error_t dl_context_destroy(dl_ctx_t dl_ctx)
 {
-	dl_free( &dl_ctx->alloc, dl_ctx->type_ids );
-	dl_free( &dl_ctx->alloc, dl_ctx->type_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->enum_ids );
-	dl_free( &dl_ctx->alloc, dl_ctx->enum_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->member_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->enum_value_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->enum_alias_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->typedata_strings );
+	dl_free( &dl_ctx->alloc, dl_ctx->type_lookup.slots );
+	dl_free( &dl_ctx->alloc, dl_ctx->enum_lookup.slots );
+	dl_free( &dl_ctx->alloc, dl_ctx->type_name_lookup.slots );
+	dl_free( &dl_ctx->alloc, dl_ctx->member_lookup.slots );
+	dl_free( &dl_ctx->alloc, dl_ctx->type_plans );
+	dl_free( &dl_ctx->alloc, dl_ctx->plan_ops );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->type_ids );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->type_descs );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->enum_ids );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->enum_descs );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->member_descs );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->enum_value_descs );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->enum_alias_descs );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->typedata_strings );
 	dl_free( &dl_ctx->alloc, dl_ctx->default_data );
-	dl_free( &dl_ctx->alloc, dl_ctx->c_includes );
+	dl_internal_free_descriptors( dl_ctx, dl_ctx->c_includes );
 	for( size_t i = 0; i < dl_ctx->metadatas_count; ++i)
 		dl_free( &dl_ctx->alloc, dl_ctx->metadatas[i] );
 	dl_free( &dl_ctx->alloc, dl_ctx->metadatas );
@@ -71,6 +178,196 @@ static dl_error_t dl_ptr_chain_patching( const dl_data_header* header, uint8_t*
 	return DL_ERROR_OK;
 }
 
+/**
+ * Patch the pointers listed in [patch_iter, patch_end) of a patch-table, pos is the position of the pointer listed
+ * just before patch_iter or 0 at the start of the patch-table.
+ */
+static dl_error_t dl_patch_table_patch_range( uint8_t* base_ptr, uintptr_t header_offset, uintptr_t instance_end, const uint8_t* patch_iter, const uint8_t* patch_end, uintptr_t pos )
+{
+	while( patch_iter != patch_end )
+	{
+		patch_iter = dl_internal_patch_table_read( patch_iter, patch_end, &pos );
+		if( patch_iter == 0x0 || pos < header_offset || pos + sizeof(uintptr_t) > instance_end )
+			return DL_ERROR_MALFORMED_DATA;
+		uintptr_t offset = *(uintptr_t*)( base_ptr + pos );
+		if( offset > instance_end )
+			return DL_ERROR_MALFORMED_DATA;
+		*(uint8_t**)( base_ptr + pos ) = base_ptr + offset;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_patch_table_patching( const dl_data_header* header, uint8_t* instance, const uint8_t* patch_table, const dl_type_desc* instance_type )
+{
+	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), instance_type->alignment[DL_PTR_SIZE_HOST] );
+	return dl_patch_table_patch_range( instance - header_offset,
+									   header_offset,
+									   header_offset + header->instance_size,
+									   patch_table,
+									   patch_table + header->patch_table_size,
+									   0 );
+}
+
+/**
+ * Smallest part of a patch-table, in bytes, that is patched by its own job. A byte in the patch-table is about one
+ * pointer so smaller parts do not make up for the cost of running a job.
+ */
+static const size_t DL_PATCH_TABLE_MIN_JOB_SIZE = 16 * 1024;
+
+struct dl_patch_table_job
+{
+	const uint8_t* patch_iter; ///< first entry in the part of the patch-table patched by this job.
+	const uint8_t* patch_end;  ///< end of the part of the patch-table patched by this job.
+	uintptr_t      pos;        ///< sum of all distances in the part, then the position of the pointer listed before patch_iter.
+	dl_error_t     err;
+};
+
+struct dl_patch_table_jobs
+{
+	uint8_t*            base_ptr;
+	uintptr_t           header_offset;
+	uintptr_t           instance_end;
+	dl_patch_table_job* jobs;
+};
+
+static void dl_patch_table_job_sum( unsigned int job_index, void* job_ctx )
+{
+	dl_patch_table_job* job = &( (dl_patch_table_jobs*)job_ctx )->jobs[job_index];
+	uintptr_t sum = 0;
+	for( const uint8_t* iter = job->patch_iter; iter != job->patch_end; )
+	{
+		// ... most pointers are close to the previous one, sum 8 single-byte entries at a time. Entries with a distance
+		//     of 0 are not found here but when patching ...
+		uint64_t bytes;
+		if( job->patch_end - iter >= 8 && ( memcpy( &bytes, iter, sizeof(bytes) ), ( bytes & 0x8080808080808080ULL ) == 0 ) )
+		{
+			bytes = ( bytes & 0x00FF00FF00FF00FFULL ) + ( ( bytes >> 8 ) & 0x00FF00FF00FF00FFULL );
+			sum  += (uintptr_t)( ( bytes * 0x0001000100010001ULL ) >> 48 );
+			iter += 8;
+			continue;
+		}
+
+		iter = dl_internal_patch_table_read( iter, job->patch_end, &sum );
+		if( iter == 0x0 )
+		{
+			job->err = DL_ERROR_MALFORMED_DATA;
+			return;
+		}
+	}
+	job->pos = sum;
+	job->err = DL_ERROR_OK;
+}
+
+static void dl_patch_table_job_patch( unsigned int job_index, void* job_ctx )
+{
+	dl_patch_table_jobs* jobs = (dl_patch_table_jobs*)job_ctx;
+	dl_patch_table_job*  job  = &jobs->jobs[job_index];
+	job->err = dl_patch_table_patch_range( jobs->base_ptr, jobs->header_offset, jobs->instance_end, job->patch_iter, job->patch_end, job->pos );
+}
+
+/**
+ * dl_job_dispatch_func used when none is passed by the user, runs job 0 on the calling thread and all other jobs on
+ * a thread each.
+ */
+static void dl_thread_dispatch( dl_job_func job, void* job_ctx, unsigned int job_count, void* dispatch_ctx )
+{
+	dl_allocator* alloc = (dl_allocator*)dispatch_ctx;
+	unsigned int worker_count = job_count - 1;
+	std::thread* workers = (std::thread*)dl_alloc( alloc, sizeof(std::thread) * worker_count );
+	if( workers == 0x0 )
+		worker_count = 0; // ... run all jobs on the calling thread ...
+
+	// ... jobs that did not get a thread, if starting one failed, are run on the calling thread ...
+	unsigned int started = 0;
+	try
+	{
+		for( ; started < worker_count; ++started )
+			new (&workers[started]) std::thread( job, started + 1, job_ctx );
+	}
+	catch( const std::system_error& )
+	{
+	}
+	worker_count = started;
+
+	job( 0, job_ctx );
+	for( unsigned int i = worker_count + 1; i < job_count; ++i )
+		job( i, job_ctx );
+	for( unsigned int i = 0; i < worker_count; ++i )
+	{
+		workers[i].join();
+		workers[i].~thread();
+	}
+	if( workers )
+		dl_free( alloc, workers );
+}
+
+/**
+ * Patch pointers from the patch-table in job_count jobs, each patching a part of the patch-table of about the same size.
+ * As every entry is the distance to the previous one, the jobs first sum the distances in their part to find where
+ * the parts start before the pointers are patched.
+ */
+static dl_error_t dl_patch_table_patching_parallel( dl_ctx_t dl_ctx, const dl_data_header* header, uint8_t* instance, const uint8_t* patch_table, const dl_type_desc* instance_type,
+													unsigned int job_count, dl_job_dispatch_func dispatch_func, void* dispatch_ctx )
+{
+	if( job_count > header->patch_table_size / DL_PATCH_TABLE_MIN_JOB_SIZE )
+		job_count = (unsigned int)( header->patch_table_size / DL_PATCH_TABLE_MIN_JOB_SIZE );
+	if( job_count <= 1 )
+		return dl_patch_table_patching( header, instance, patch_table, instance_type );
+
+	if( dispatch_func == 0x0 )
+	{
+		dispatch_func = dl_thread_dispatch;
+		dispatch_ctx  = &dl_ctx->alloc;
+	}
+
+	dl_patch_table_job* job_storage = (dl_patch_table_job*)dl_alloc( &dl_ctx->alloc, sizeof(dl_patch_table_job) * job_count );
+	if( job_storage == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	// ... split the patch-table at the first entry starting at or after every job_count:th byte ...
+	const uint8_t* patch_end = patch_table + header->patch_table_size;
+	for( unsigned int i = 0; i < job_count; ++i )
+	{
+		const uint8_t* iter = patch_table + (size_t)header->patch_table_size * i / job_count;
+		while( iter != patch_table && iter != patch_end && ( iter[-1] & 0x80 ) != 0 )
+			++iter;
+		job_storage[i].patch_iter = iter;
+	}
+	for( unsigned int i = 0; i < job_count; ++i )
+		job_storage[i].patch_end = i + 1 < job_count ? job_storage[i + 1].patch_iter : patch_end;
+
+	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), instance_type->alignment[DL_PTR_SIZE_HOST] );
+	dl_patch_table_jobs jobs;
+	jobs.base_ptr      = instance - header_offset;
+	jobs.header_offset = header_offset;
+	jobs.instance_end  = header_offset + header->instance_size;
+	jobs.jobs          = job_storage;
+
+	dl_error_t err = DL_ERROR_OK;
+	dispatch_func( dl_patch_table_job_sum, &jobs, job_count, dispatch_ctx );
+
+	uintptr_t pos = 0;
+	for( unsigned int i = 0; i < job_count && err == DL_ERROR_OK; ++i )
+	{
+		uintptr_t sum = job_storage[i].pos;
+		err = job_storage[i].err;
+		job_storage[i].pos = pos;
+		if( pos + sum < pos )
+			err = DL_ERROR_MALFORMED_DATA;
+		pos += sum;
+	}
+
+	if( err == DL_ERROR_OK )
+	{
+		dispatch_func( dl_patch_table_job_patch, &jobs, job_count, dispatch_ctx );
+		for( unsigned int i = 0; i < job_count && err == DL_ERROR_OK; ++i )
+			err = job_storage[i].err;
+	}
+
+	dl_free( &dl_ctx->alloc, job_storage );
+	return err;
+}
+
 dl_error_t dl_instance_load( dl_ctx_t             dl_ctx,          dl_typeid_t  type_id,
                              void*                instance,        size_t instance_size,
                              const unsigned char* packed_instance, size_t packed_instance_size,
@@ -81,7 +378,8 @@ dl_error_t dl_instance_load( dl_ctx_t             dl_ctx,          dl_typeid_t
 	if( packed_instance_size < sizeof(dl_data_header) ) return DL_ERROR_MALFORMED_DATA;
 	if( header->id == DL_INSTANCE_ID_SWAPED )           return DL_ERROR_ENDIAN_MISMATCH;
 	if( header->id != DL_INSTANCE_ID )                  return DL_ERROR_MALFORMED_DATA;
-	if( header->version != DL_INSTANCE_VERSION )        return DL_ERROR_VERSION_MISMATCH;
+	if( header->version != DL_INSTANCE_VERSION &&
+		header->version != DL_INSTANCE_VERSION_CHAIN )  return DL_ERROR_VERSION_MISMATCH;
 	if( header->root_instance_type != type_id )         return DL_ERROR_TYPE_MISMATCH;
 	if( header->instance_size > instance_size )         return DL_ERROR_BUFFER_TOO_SMALL;
 
@@ -96,29 +394,39 @@ dl_error_t dl_instance_load( dl_ctx_t             dl_ctx,          dl_typeid_t
 
 	DL_ASSERT( (uint8_t*)instance + header->instance_size > packed_instance || (uint8_t*)instance < packed_instance + header->instance_size );
 	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+	size_t packed_size   = dl_internal_packed_instance_size( header, header_offset );
+	if( packed_size > packed_instance_size )
+		return DL_ERROR_MALFORMED_DATA;
+
 	memcpy( instance, packed_instance + header_offset, header->instance_size );
 
 	if (consumed)
-		*consumed = (size_t)header->instance_size + header_offset;
+		*consumed = packed_size;
+
+	if( header->using_relative_ptrs )
+		return DL_ERROR_OK; // relative pointers are still valid after copy, nothing to patch.
 
 	if( header->not_using_ptr_chain_patching )
-		dl_internal_patch_instance( dl_ctx, root_type, (uint8_t*)instance, 0x0, (uintptr_t)instance - header_offset );
-	else
+		return dl_internal_patch_instance( dl_ctx, root_type, (uint8_t*)instance, 0x0, (uintptr_t)instance - header_offset );
+	else if( header->version == DL_INSTANCE_VERSION_CHAIN )
 		return dl_ptr_chain_patching( header, (uint8_t*)instance, root_type );
-
-	return DL_ERROR_OK;
+	else
+		return dl_patch_table_patching( header, (uint8_t*)instance, packed_instance + header_offset + header->instance_size, root_type );
 }
 
-dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,          dl_typeid_t type_id,
-												   unsigned char* packed_instance, size_t      packed_instance_size,
-												   void**         loaded_instance, size_t*     consumed)
+static dl_error_t dl_internal_instance_load_inplace( dl_ctx_t             dl_ctx,          dl_typeid_t type_id,
+													 unsigned char*       packed_instance, size_t      packed_instance_size,
+													 unsigned int         job_count,       dl_job_dispatch_func dispatch_func,
+													 void*                dispatch_ctx,
+													 void**               loaded_instance, size_t*     consumed )
 {
 	dl_data_header* header = (dl_data_header*)packed_instance;
 
 	if( packed_instance_size < sizeof(dl_data_header) ) return DL_ERROR_MALFORMED_DATA;
 	if( header->id == DL_INSTANCE_ID_SWAPED )           return DL_ERROR_ENDIAN_MISMATCH;
 	if( header->id != DL_INSTANCE_ID )                  return DL_ERROR_MALFORMED_DATA;
-	if( header->version != DL_INSTANCE_VERSION )        return DL_ERROR_VERSION_MISMATCH;
+	if( header->version != DL_INSTANCE_VERSION &&
+		header->version != DL_INSTANCE_VERSION_CHAIN )  return DL_ERROR_VERSION_MISMATCH;
 	if( header->root_instance_type != type_id )         return DL_ERROR_TYPE_MISMATCH;
 
 	const dl_type_desc* root_type = dl_internal_find_type( dl_ctx, header->root_instance_type );
@@ -126,28 +434,74 @@ dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,
 		return DL_ERROR_TYPE_NOT_FOUND;
 
 	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+	size_t packed_size   = dl_internal_packed_instance_size( header, header_offset );
+	if( packed_size > packed_instance_size )
+		return DL_ERROR_MALFORMED_DATA;
+
 	*loaded_instance = packed_instance + header_offset;
 
 	if( consumed )
-		*consumed = header->instance_size + header_offset;
+		*consumed = packed_size;
 
-	if( header->version == DL_INSTANCE_VERSION && !header->not_using_ptr_chain_patching )
-	{
+	if( header->using_relative_ptrs )
+		return DL_ERROR_OK; // nothing to patch, packed_instance is never written to.
+
+	if( header->not_using_ptr_chain_patching )
+		return dl_internal_patch_instance( dl_ctx, root_type, (uint8_t*)*loaded_instance, 0x0, (uintptr_t)packed_instance );
+	else if( header->version == DL_INSTANCE_VERSION_CHAIN )
 		return dl_ptr_chain_patching( header, (uint8_t*)*loaded_instance, root_type );
-	}
-	else if( header->not_using_ptr_chain_patching )
-	{
-		dl_internal_patch_instance( dl_ctx, root_type, (uint8_t*)*loaded_instance, 0x0, (uintptr_t)packed_instance );
-	}
-	return DL_ERROR_OK;
+	else
+		return dl_patch_table_patching_parallel( dl_ctx,
+												 header,
+												 (uint8_t*)*loaded_instance,
+												 packed_instance + header_offset + header->instance_size,
+												 root_type,
+												 job_count,
+												 dispatch_func,
+												 dispatch_ctx );
+}
+
+dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,          dl_typeid_t type_id,
+												   unsigned char* packed_instance, size_t      packed_instance_size,
+												   void**         loaded_instance, size_t*     consumed)
+{
+	return dl_internal_instance_load_inplace( dl_ctx, type_id, packed_instance, packed_instance_size, 1, 0x0, 0x0, loaded_instance, consumed );
+}
+
+dl_error_t DL_DLL_EXPORT dl_instance_load_inplace_parallel( dl_ctx_t             dl_ctx,          dl_typeid_t type_id,
+															unsigned char*       packed_instance, size_t      packed_instance_size,
+															unsigned int         job_count,       dl_job_dispatch_func dispatch_func,
+															void*                dispatch_ctx,
+															void**               loaded_instance, size_t*     consumed )
+{
+	if( job_count == 0 )
+		job_count = std::thread::hardware_concurrency();
+	if( job_count == 0 )
+		job_count = 1;
+	return dl_internal_instance_load_inplace( dl_ctx, type_id, packed_instance, packed_instance_size, job_count, dispatch_func, dispatch_ctx, loaded_instance, consumed );
+}
+
+
+struct SStoredString
+{
+	const char* str;
+	uint32_t    length;
+	uint32_t    hash;
+};
+
+static inline uint32_t dl_hash_table_key_hash( const SStoredString& s ) { return s.hash; }
+static inline bool     dl_hash_table_key_equal( const SStoredString& s1, const SStoredString& s2 )
+{
+	return s1.hash == s2.hash && s1.length == s2.length && memcmp( s1.str, s2.str, s1.length ) == 0;
 }
 
 struct CDLBinStoreContext
 {
-	CDLBinStoreContext( uint8_t* out_data, size_t out_data_size, bool is_dummy, dl_allocator alloc )
+	CDLBinStoreContext( uint8_t* out_data, size_t out_data_size, bool is_dummy, bool merge_strings, dl_allocator alloc )
 	    : written_ptrs(alloc)
 	    , ptrs(alloc)
 		, strings(alloc)
+		, merge_strings(merge_strings)
 	{
 		dl_binary_writer_init( &writer, out_data, out_data_size, is_dummy, DL_ENDIAN_HOST, DL_ENDIAN_HOST, DL_PTR_SIZE_HOST );
 	}
@@ -157,74 +511,62 @@ struct CDLBinStoreContext
 		if( ptr == 0 )
 			return (uintptr_t)0;
 
-		size_t len = written_ptrs.Len();
-		for( size_t i = 0; i < len; ++i )
-			if( written_ptrs[i].ptr == ptr )
-				return written_ptrs[i].pos;
-
-		return (uintptr_t)0;
+		uintptr_t* pos = written_ptrs.Find( ptr );
+		return pos ? *pos : (uintptr_t)0;
 	}
 
-	void AddWrittenPtr( const void* ptr, uintptr_t pos )
+	bool AddWrittenPtr( const void* ptr, uintptr_t pos )
 	{
-		written_ptrs.Add( { pos, ptr } );
+		return written_ptrs.Insert( ptr, pos );
 	}
 
-	uint32_t GetStringOffset(const char* str, uint32_t length, uint32_t hash)
+	uintptr_t GetStringOffset( const SStoredString& str )
 	{
-		for (size_t i = 0; i < strings.Len(); ++i)
-			if (strings[i].hash == hash && strings[i].length == length && strcmp(str, strings[i].str) == 0)
-				return strings[i].offset;
-
-		return 0;
+		uintptr_t* offset = strings.Find( str );
+		return offset ? *offset : 0;
 	}
 
 	dl_binary_writer writer;
 
-	struct SWrittenPtr
-	{
-		uintptr_t   pos;
-		const void* ptr;
-	};
-	CArrayStatic<SWrittenPtr, 128> written_ptrs;
+	CHashTableStatic<const void*, uintptr_t, 128> written_ptrs;
 	CArrayStatic<uintptr_t, 256> ptrs;
 
-	struct SString
-	{
-		const char* str;
-		uint32_t length;
-		uint32_t hash;
-		uint32_t offset;
-	};
-	CArrayStatic<SString, 128> strings;
+	CHashTableStatic<SStoredString, uintptr_t, 128> strings;
+	bool merge_strings;
 };
 
-static void dl_internal_store_string( const uint8_t* instance, CDLBinStoreContext* store_ctx )
+static dl_error_t dl_internal_store_string( const uint8_t* instance, CDLBinStoreContext* store_ctx )
 {
 	char* str = *(char**)instance;
 	if( str == 0x0 )
 	{
 		dl_binary_writer_write( &store_ctx->writer, &DL_NULL_PTR_OFFSET[ DL_PTR_SIZE_HOST ], sizeof(uintptr_t) );
-		return;
+		return DL_ERROR_OK;
 	}
-	uint32_t hash = dl_internal_hash_string(str);
-	uint32_t length = (uint32_t) strlen(str);
-	uintptr_t offset = store_ctx->GetStringOffset(str, length, hash);
-	if (offset == 0) // Merge identical strings
+	SStoredString stored = { str, (uint32_t)strlen(str), 0 };
+	uintptr_t offset = 0;
+	if( store_ctx->merge_strings ) // Merge identical strings
+	{
+		stored.hash = dl_internal_hash_buffer( (const uint8_t*)str, stored.length );
+		offset = store_ctx->GetStringOffset( stored );
+	}
+	if (offset == 0)
 	{
 		uintptr_t pos = dl_binary_writer_tell(&store_ctx->writer);
 		dl_binary_writer_seek_end(&store_ctx->writer);
 		offset = dl_binary_writer_tell(&store_ctx->writer);
-		dl_binary_writer_write(&store_ctx->writer, str, length + 1);
-		store_ctx->strings.Add( {str, length, hash, (uint32_t) offset} );
+		dl_binary_writer_write(&store_ctx->writer, str, stored.length + 1);
+		if( store_ctx->merge_strings && !store_ctx->strings.Insert( stored, offset ) )
+			return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
 		dl_binary_writer_seek_set(&store_ctx->writer, pos);
 	}
-	if( !store_ctx->writer.dummy )
-		store_ctx->ptrs.Add( dl_binary_writer_tell( &store_ctx->writer ) );
+	store_ctx->ptrs.Add( dl_binary_writer_tell( &store_ctx->writer ) );
 	dl_binary_writer_write( &store_ctx->writer, &offset, sizeof(uintptr_t) );
+	return DL_ERROR_OK;
 }
 
 static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_desc* type, uint8_t* instance, CDLBinStoreContext* store_ctx );
+static dl_error_t dl_internal_instance_store_plan( dl_ctx_t dl_ctx, const dl_type_plan* plan, uint8_t* instance, uintptr_t instance_pos, bool copy_pods, CDLBinStoreContext* store_ctx );
 
 static dl_error_t dl_internal_store_ptr( dl_ctx_t dl_ctx, uint8_t* instance, const dl_type_desc* sub_type, CDLBinStoreContext* store_ctx )
 {
@@ -250,7 +592,8 @@ static dl_error_t dl_internal_store_ptr( dl_ctx_t dl_ctx, uint8_t* instance, con
 		// write data!
 		dl_binary_writer_reserve( &store_ctx->writer, size ); // reserve space for ptr so subdata is placed correctly
 
-		store_ctx->AddWrittenPtr(data, offset);
+		if( !store_ctx->AddWrittenPtr(data, offset) )
+			return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
 
 		dl_error_t err = dl_internal_instance_store(dl_ctx, sub_type, data, store_ctx);
 		if (DL_ERROR_OK != err)
@@ -258,7 +601,7 @@ static dl_error_t dl_internal_store_ptr( dl_ctx_t dl_ctx, uint8_t* instance, con
 		dl_binary_writer_seek_set( &store_ctx->writer, pos );
 	}
 
-	if( !store_ctx->writer.dummy && data != 0x0 )
+	if( data != 0x0 )
 		store_ctx->ptrs.Add( dl_binary_writer_tell( &store_ctx->writer ) );
 
 	dl_binary_writer_write( &store_ctx->writer, &offset, sizeof(uintptr_t) );
@@ -272,7 +615,20 @@ static dl_error_t dl_internal_store_array( dl_ctx_t dl_ctx, dl_type_storage_t st
 		case DL_TYPE_STORAGE_STRUCT:
 		{
 			uintptr_t size_ = sub_type->size[DL_PTR_SIZE_HOST];
-			if( sub_type->flags & DL_TYPE_FLAG_HAS_SUBDATA )
+			const dl_type_plan* plan = dl_internal_type_plan( dl_ctx, sub_type );
+			if( ( sub_type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) && plan )
+			{
+				// copy all elements in one go and only visit the members that need to be fixed up per element.
+				uintptr_t array_pos = dl_binary_writer_tell( &store_ctx->writer );
+				dl_binary_writer_write( &store_ctx->writer, instance, count * size_ );
+				for( uint32_t elem = 0; elem < count; ++elem )
+				{
+					dl_error_t err = dl_internal_instance_store_plan( dl_ctx, plan, instance + ( elem * size_ ), array_pos + ( elem * size_ ), false, store_ctx );
+					if( DL_ERROR_OK != err )
+						return err;
+				}
+			}
+			else if( sub_type->flags & DL_TYPE_FLAG_HAS_SUBDATA )
 			{
 				for (uint32_t elem = 0; elem < count; ++elem)
 				{
@@ -287,7 +643,11 @@ static dl_error_t dl_internal_store_array( dl_ctx_t dl_ctx, dl_type_storage_t st
 		break;
 		case DL_TYPE_STORAGE_STR:
 			for( uint32_t elem = 0; elem < count; ++elem )
-				dl_internal_store_string( instance + (elem * sizeof(char*)), store_ctx );
+			{
+				dl_error_t err = dl_internal_store_string( instance + (elem * sizeof(char*)), store_ctx );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
 			break;
 		case DL_TYPE_STORAGE_PTR:
 			for( uint32_t elem = 0; elem < count; ++elem )
@@ -304,6 +664,44 @@ static dl_error_t dl_internal_store_array( dl_ctx_t dl_ctx, dl_type_storage_t st
 	return DL_ERROR_OK;
 }
 
+static dl_error_t dl_internal_store_dynamic_array( dl_ctx_t dl_ctx, dl_type_storage_t storage_type, const dl_type_desc* sub_type, uintptr_t size, uint32_t alignment, uint8_t* instance, CDLBinStoreContext* store_ctx )
+{
+	uint8_t* data_ptr = instance;
+	uint32_t count    = *(uint32_t*)( data_ptr + sizeof(void*) );
+
+	uintptr_t offset = 0;
+
+	if( count == 0 )
+		offset = DL_NULL_PTR_OFFSET[ DL_PTR_SIZE_HOST ];
+	else
+	{
+		uintptr_t pos = dl_binary_writer_tell( &store_ctx->writer );
+		dl_binary_writer_seek_end( &store_ctx->writer );
+		dl_binary_writer_align( &store_ctx->writer, alignment );
+
+		offset = dl_binary_writer_tell( &store_ctx->writer );
+
+		// write data!
+		dl_binary_writer_reserve( &store_ctx->writer, count * size ); // reserve space for array so subdata is placed correctly
+
+		uint8_t* data = *(uint8_t**)data_ptr;
+
+		dl_error_t err = dl_internal_store_array(dl_ctx, storage_type, sub_type, data, count, size, store_ctx);
+		if (DL_ERROR_OK != err)
+			return err;
+		dl_binary_writer_seek_set( &store_ctx->writer, pos );
+
+		store_ctx->ptrs.Add( dl_binary_writer_tell( &store_ctx->writer ) );
+	}
+
+	// make room for ptr
+	dl_binary_writer_write( &store_ctx->writer, &offset, sizeof(uintptr_t) );
+
+	// write count
+	dl_binary_writer_write( &store_ctx->writer, &count, sizeof(uint32_t) );
+	return DL_ERROR_OK;
+}
+
 static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_desc* member, uint8_t* instance, CDLBinStoreContext* store_ctx )
 {
 	dl_type_atom_t    atom_type    = member->AtomType();
@@ -329,8 +727,12 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 				}
 				break;
 				case DL_TYPE_STORAGE_STR:
-					dl_internal_store_string( instance, store_ctx );
-					break;
+				{
+					dl_error_t err = dl_internal_store_string( instance, store_ctx );
+					if( DL_ERROR_OK != err )
+						return err;
+				}
+				break;
 				case DL_TYPE_STORAGE_PTR:
 				{
 					const dl_type_desc* sub_type = dl_internal_find_type( dl_ctx, member->type_id );
@@ -374,59 +776,25 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 
 		case DL_TYPE_ATOM_ARRAY:
 		{
-			uintptr_t size = 0;
 			const dl_type_desc* sub_type = 0x0;
-
-			uint8_t* data_ptr = instance;
-			uint32_t count    = *(uint32_t*)( data_ptr + sizeof(void*) );
-
-			uintptr_t offset = 0;
-
-			if( count == 0 )
-				offset = DL_NULL_PTR_OFFSET[ DL_PTR_SIZE_HOST ];
-			else
+			uintptr_t size      = dl_pod_size( storage_type );
+			uint32_t  alignment = (uint32_t)size;
+			if( storage_type == DL_TYPE_STORAGE_STRUCT || storage_type == DL_TYPE_STORAGE_PTR )
 			{
-				uintptr_t pos = dl_binary_writer_tell( &store_ctx->writer );
-				dl_binary_writer_seek_end( &store_ctx->writer );
-
-				switch(storage_type)
+				sub_type = dl_internal_find_type( dl_ctx, member->type_id );
+				if( sub_type == 0x0 )
 				{
-					case DL_TYPE_STORAGE_STRUCT:
-						sub_type = dl_internal_find_type( dl_ctx, member->type_id );
-						size = dl_internal_align_up( sub_type->size[DL_PTR_SIZE_HOST], sub_type->alignment[DL_PTR_SIZE_HOST] );
-						dl_binary_writer_align( &store_ctx->writer, sub_type->alignment[DL_PTR_SIZE_HOST] );
-						break;
-					case DL_TYPE_STORAGE_PTR:
-						sub_type = dl_internal_find_type( dl_ctx, member->type_id );
-						/*fallthrough*/
-					default:
-						size = dl_pod_size( member->StorageType() );
-						dl_binary_writer_align( &store_ctx->writer, size );
+					dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, member ) );
+					return DL_ERROR_TYPE_NOT_FOUND;
+				}
+				if( storage_type == DL_TYPE_STORAGE_STRUCT )
+				{
+					size      = dl_internal_align_up( sub_type->size[DL_PTR_SIZE_HOST], sub_type->alignment[DL_PTR_SIZE_HOST] );
+					alignment = sub_type->alignment[DL_PTR_SIZE_HOST];
 				}
-
-				offset = dl_binary_writer_tell( &store_ctx->writer );
-
-				// write data!
-				dl_binary_writer_reserve( &store_ctx->writer, count * size ); // reserve space for array so subdata is placed correctly
-
-				uint8_t* data = *(uint8_t**)data_ptr;
-
-				dl_error_t err = dl_internal_store_array(dl_ctx, storage_type, sub_type, data, count, size, store_ctx);
-				if (DL_ERROR_OK != err)
-					return err;
-				dl_binary_writer_seek_set( &store_ctx->writer, pos );
-
-				if( !store_ctx->writer.dummy )
-				    store_ctx->ptrs.Add( dl_binary_writer_tell( &store_ctx->writer ) );
 			}
-
-			// make room for ptr
-			dl_binary_writer_write( &store_ctx->writer, &offset, sizeof(uintptr_t) );
-
-			// write count
-			dl_binary_writer_write( &store_ctx->writer, &count, sizeof(uint32_t) );
+			return dl_internal_store_dynamic_array( dl_ctx, storage_type, sub_type, size, alignment, instance, store_ctx );
 		}
-		return DL_ERROR_OK;
 
 		case DL_TYPE_ATOM_BITFIELD:
 			dl_binary_writer_write( &store_ctx->writer, instance, member->size[DL_PTR_SIZE_HOST] );
@@ -440,6 +808,68 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 	return DL_ERROR_OK;
 }
 
+static dl_error_t dl_internal_store_plan_op( dl_ctx_t dl_ctx, const dl_plan_op* op, uint8_t* instance, CDLBinStoreContext* store_ctx )
+{
+	const dl_type_desc* sub_type = op->sub_type == UINT32_MAX ? 0x0 : dl_ctx->type_descs + op->sub_type;
+	switch( op->kind )
+	{
+		case DL_PLAN_OP_COPY:
+			dl_binary_writer_write( &store_ctx->writer, instance, op->size );
+			break;
+		case DL_PLAN_OP_STR:
+			for( uint32_t elem = 0; elem < op->count; ++elem )
+			{
+				dl_error_t err = dl_internal_store_string( instance + ( elem * sizeof(char*) ), store_ctx );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
+			break;
+		case DL_PLAN_OP_PTR:
+			for( uint32_t elem = 0; elem < op->count; ++elem )
+			{
+				dl_error_t err = dl_internal_store_ptr( dl_ctx, instance + ( elem * sizeof(void*) ), sub_type, store_ctx );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
+			break;
+		case DL_PLAN_OP_STRUCT:
+		{
+			uintptr_t pos = dl_binary_writer_tell( &store_ctx->writer );
+			for( uint32_t elem = 0; elem < op->count; ++elem )
+			{
+				dl_binary_writer_seek_set( &store_ctx->writer, pos + elem * op->size );
+				dl_error_t err = dl_internal_instance_store( dl_ctx, sub_type, instance + ( elem * op->size ), store_ctx );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
+		}
+		break;
+		case DL_PLAN_OP_ARRAY:
+			return dl_internal_store_dynamic_array( dl_ctx, (dl_type_storage_t)op->storage, sub_type, op->size, op->align, instance, store_ctx );
+		default:
+			DL_ASSERT(false && "Invalid plan-op!");
+			break;
+	}
+	return DL_ERROR_OK;
+}
+
+/**
+ * Store instance by running the ops in plan, if copy_pods is false all pod-data is expected to already be written.
+ */
+static dl_error_t dl_internal_instance_store_plan( dl_ctx_t dl_ctx, const dl_type_plan* plan, uint8_t* instance, uintptr_t instance_pos, bool copy_pods, CDLBinStoreContext* store_ctx )
+{
+	const dl_plan_op* ops = dl_ctx->plan_ops + plan->op_start;
+	for( uint32_t op_index = copy_pods ? 0 : plan->copy_count; op_index < plan->op_count; ++op_index )
+	{
+		const dl_plan_op* op = &ops[op_index];
+		dl_binary_writer_seek_set( &store_ctx->writer, instance_pos + op->offset );
+		dl_error_t err = dl_internal_store_plan_op( dl_ctx, op, instance + op->offset, store_ctx );
+		if( err != DL_ERROR_OK )
+			return err;
+	}
+	return DL_ERROR_OK;
+}
+
 static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_desc* type, uint8_t* instance, CDLBinStoreContext* store_ctx )
 {
 	bool last_was_bitfield = false;
@@ -447,6 +877,11 @@ static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_des
 	dl_binary_writer_align( &store_ctx->writer, type->alignment[DL_PTR_SIZE_HOST] );
 
 	uintptr_t instance_pos = dl_binary_writer_tell( &store_ctx->writer );
+
+	const dl_type_plan* plan = dl_internal_type_plan( dl_ctx, type );
+	if( plan )
+		return dl_internal_instance_store_plan( dl_ctx, plan, instance, instance_pos, true, store_ctx );
+
 	if( type->flags & DL_TYPE_FLAG_IS_UNION )
 	{
 		size_t type_offset = dl_internal_union_type_offset( dl_ctx, type, DL_PTR_SIZE_HOST );
@@ -488,6 +923,45 @@ static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_des
 	return DL_ERROR_OK;
 }
 
+/**
+ * Store instance after the header, followed by the patch-table, and write the header when the writer holds all the stored data.
+ */
+static dl_error_t dl_internal_store_root( dl_ctx_t dl_ctx, const dl_type_desc* type, dl_typeid_t type_id, const void* instance, CDLBinStoreContext* store_ctx, size_t* produced_bytes )
+{
+	dl_binary_writer* writer = &store_ctx->writer;
+	size_t header_plus_alignment = dl_internal_align_up( sizeof( dl_data_header ), type->alignment[DL_PTR_SIZE_HOST] );
+	dl_binary_writer_seek_set( writer, header_plus_alignment );
+	dl_binary_writer_update_needed_size( writer );
+
+	dl_binary_writer_reserve( writer, type->size[DL_PTR_SIZE_HOST] );
+	if( !store_ctx->AddWrittenPtr( instance, header_plus_alignment ) ) // if pointer refers to root-node, it can be found at offset "sizeof(dl_data_header)" plus alignment
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	dl_error_t err = dl_internal_instance_store( dl_ctx, type, (uint8_t*)instance, store_ctx );
+
+	// write patch-table after instance!
+	dl_binary_writer_seek_end( writer );
+	size_t instance_end = dl_binary_writer_tell( writer );
+	std::sort( store_ctx->ptrs.m_Ptr, store_ctx->ptrs.m_Ptr + store_ctx->ptrs.m_nElements );
+	dl_internal_patch_table_write( writer, store_ctx->ptrs.m_Ptr, store_ctx->ptrs.Len() );
+
+	size_t stored_size = dl_binary_writer_tell( writer );
+	if( produced_bytes )
+		*produced_bytes = stored_size;
+
+	if( writer->dummy || !dl_binary_writer_fits( writer, stored_size ) )
+		return err;
+
+	dl_data_header* header = (dl_data_header*)writer->data;
+	header->id                 = DL_INSTANCE_ID;
+	header->version            = DL_INSTANCE_VERSION;
+	header->root_instance_type = type_id;
+	header->is_64_bit_ptr      = sizeof( void* ) == 8 ? 1 : 0;
+	header->instance_size      = uint32_t( instance_end - header_plus_alignment );
+	header->patch_table_size   = uint32_t( stored_size - instance_end );
+	return err;
+}
+
 dl_error_t dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type_id,         const void* instance,
 							  unsigned char* out_buffer, size_t      out_buffer_size, size_t*     produced_bytes )
 {
@@ -499,9 +973,8 @@ dl_error_t dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type_id,
 		return DL_ERROR_TYPE_NOT_FOUND;
 
 	bool store_ctx_is_dummy = out_buffer_size == 0;
-	CDLBinStoreContext store_context( out_buffer, out_buffer_size, store_ctx_is_dummy, dl_ctx->alloc );
+	CDLBinStoreContext store_context( out_buffer, out_buffer_size, store_ctx_is_dummy, dl_ctx->store_merge_strings, dl_ctx->alloc );
 
-	dl_data_header* header = (dl_data_header*)out_buffer;
 	size_t header_plus_alignment = dl_internal_align_up( sizeof( dl_data_header ), type->alignment[DL_PTR_SIZE_HOST] );
 	if( out_buffer_size > 0 )
 	{
@@ -509,52 +982,50 @@ dl_error_t dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type_id,
 			memset( out_buffer, 0, header_plus_alignment );
 		else
 			memset( out_buffer, 0, out_buffer_size );
-
-		header->id                 = DL_INSTANCE_ID;
-		header->version            = DL_INSTANCE_VERSION;
-		header->root_instance_type = type_id;
-		header->is_64_bit_ptr      = sizeof( void* ) == 8 ? 1 : 0;
 	}
-	dl_binary_writer_seek_set( &store_context.writer, header_plus_alignment );
-	dl_binary_writer_update_needed_size( &store_context.writer );
 
-	dl_binary_writer_reserve( &store_context.writer, type->size[DL_PTR_SIZE_HOST] );
-	store_context.AddWrittenPtr( instance, header_plus_alignment ); // if pointer refers to root-node, it can be found at offset "sizeof(dl_data_header)" plus alignment
+	size_t stored_size = 0;
+	dl_error_t err = dl_internal_store_root( dl_ctx, type, type_id, instance, &store_context, &stored_size );
+	if( produced_bytes )
+		*produced_bytes = stored_size;
 
-	dl_error_t err = dl_internal_instance_store( dl_ctx, type, (uint8_t*)instance, &store_context );
+	if( out_buffer_size > 0 && stored_size > out_buffer_size )
+		return DL_ERROR_BUFFER_TOO_SMALL;
 
-	// write instance size!
-	dl_binary_writer_seek_end( &store_context.writer );
-	if( header )
-	{
-		header->instance_size = uint32_t( dl_binary_writer_tell( &store_context.writer ) - header_plus_alignment );
+	return err;
+}
 
-		uintptr_t offset_shift = sizeof( uintptr_t ) * 4;
-		if( dl_binary_writer_tell( &store_context.writer ) >= ( 1ULL << offset_shift ) )
-			header->not_using_ptr_chain_patching = 1;
-		else
-		{
-			std::sort( store_context.ptrs.m_Ptr, store_context.ptrs.m_Ptr + store_context.ptrs.m_nElements );
-			if( out_buffer && store_context.ptrs.Len() )
-			{
-				store_context.ptrs.Add( store_context.ptrs[store_context.ptrs.Len() - 1] ); // Adding last pointer again so the offset to next pointer becomes 0 which terminates patching
-				for( size_t i = 0; i < store_context.ptrs.Len() - 1; ++i )
-				{
-					uintptr_t offset                                = *(uintptr_t*)&out_buffer[store_context.ptrs[i]];
-					*(uintptr_t*)&out_buffer[store_context.ptrs[i]] = offset | ( ( (uintptr_t)( store_context.ptrs[i + 1] - store_context.ptrs[i] ) ) << offset_shift );
-				}
-				header->first_pointer_to_patch = (uint32_t)store_context.ptrs[0];
-			}
-		}
-	}
+dl_error_t dl_instance_store_alloc( dl_ctx_t         dl_ctx,     dl_typeid_t     type_id,      const void* instance,
+									dl_alloc_func    alloc_func, dl_realloc_func realloc_func,
+									dl_free_func     free_func,  void*           alloc_ctx,
+									unsigned char**  out_buffer, size_t*         out_size )
+{
+	dl_allocator out_alloc;
+	if( out_buffer == 0x0 || !dl_allocator_initialize( &out_alloc, alloc_func, realloc_func, free_func, alloc_ctx ) )
+		return DL_ERROR_INVALID_PARAMETER;
 
-	if( produced_bytes )
-		*produced_bytes = (uint32_t)dl_binary_writer_tell( &store_context.writer );
+	const dl_type_desc* type = dl_internal_find_type( dl_ctx, type_id );
+	if( type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
 
-	if( out_buffer_size > 0 && dl_binary_writer_tell( &store_context.writer ) > out_buffer_size )
-		return DL_ERROR_BUFFER_TOO_SMALL;
+	CDLBinStoreContext store_context( 0x0, 0, false, dl_ctx->store_merge_strings, dl_ctx->alloc );
+	store_context.writer.grow_alloc = &out_alloc;
 
-	return err;
+	size_t stored_size = 0;
+	dl_error_t err = dl_internal_store_root( dl_ctx, type, type_id, instance, &store_context, &stored_size );
+	if( store_context.writer.out_of_memory )
+		err = DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	if( err != DL_ERROR_OK )
+	{
+		if( store_context.writer.data )
+			dl_free( &out_alloc, store_context.writer.data );
+		return err;
+	}
+
+	*out_buffer = store_context.writer.data;
+	if( out_size )
+		*out_size = stored_size;
+	return DL_ERROR_OK;
 }
 
 dl_error_t dl_instance_calc_size( dl_ctx_t dl_ctx, dl_typeid_t type, const void* instance, size_t* out_size )
@@ -596,6 +1067,7 @@ const char* dl_error_to_string( dl_error_t error )
 
 		DL_ERR_TO_STR(DL_ERROR_UTIL_FILE_NOT_FOUND);
 		DL_ERR_TO_STR(DL_ERROR_UTIL_FILE_TYPE_MISMATCH);
+		DL_ERR_TO_STR(DL_ERROR_UTIL_FILE_WRITE_FAILED);
 
 		DL_ERR_TO_STR(DL_ERROR_INTERNAL_ERROR);
 		default: return "Unknown error!";
@@ -607,9 +1079,12 @@ dl_error_t dl_instance_get_info( const unsigned char* packed_instance, size_t pa
 {
 	dl_data_header* header = (dl_data_header*)packed_instance;
 
-	if( packed_instance_size < sizeof(dl_data_header) && header->id != DL_INSTANCE_ID_SWAPED && header->id != DL_INSTANCE_ID )
+	if( packed_instance_size < sizeof(dl_data_header) )
+		return DL_ERROR_MALFORMED_DATA;
+	if( header->id != DL_INSTANCE_ID_SWAPED && header->id != DL_INSTANCE_ID )
 		return DL_ERROR_MALFORMED_DATA;
-	if( header->version != DL_INSTANCE_VERSION && header->version != DL_INSTANCE_VERSION_SWAPED )
+	if( header->version != DL_INSTANCE_VERSION       && header->version != DL_INSTANCE_VERSION_SWAPED &&
+		header->version != DL_INSTANCE_VERSION_CHAIN && header->version != DL_INSTANCE_VERSION_CHAIN_SWAPED )
 		return DL_ERROR_VERSION_MISMATCH;
 
 	out_info->ptrsize   = header->is_64_bit_ptr ? 8 : 4;
@@ -50,6 +50,8 @@ inline void* dl_realloc( dl_allocator* alloc, void* ptr, size_t size, size_t old
 		return alloc->realloc( ptr, size, old_size, alloc->ctx );
 
 	void* new_ptr = dl_alloc( alloc, size );
+	if( new_ptr == 0x0 )
+		return 0x0; // ... ptr is kept, as with realloc() ...
 	if( ptr != 0x0 )
 	{
 		memcpy( new_ptr, ptr, old_size );
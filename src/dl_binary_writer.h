@@ -12,6 +12,11 @@
 	#define DL_LOG_BIN_WRITER_VERBOSE(_Fmt, ...)
 #endif
 
+/**
+ * Called by a flushing writer with the bytes written since the last flush.
+ */
+typedef void (*dl_binary_writer_flush_func)( const uint8_t* data, size_t data_size, void* flush_ctx );
+
 struct dl_binary_writer
 {
 	bool          dummy;
@@ -22,6 +27,14 @@ struct dl_binary_writer
 	size_t        needed_size;
 	uint8_t*      data;
 	size_t        data_size;
+	dl_allocator* grow_alloc; // if set, data is reallocated with this allocator when written past data_size.
+	bool          out_of_memory; // set if growing data failed, or a write did not fit the buffer of a flushing writer. data is then kept as it was and nothing more is written or flushed.
+
+	// if set, data is handed to flush_func and reused from the start when full. pos and needed_size are then relative
+	// to the last flush, flushed holds the number of bytes flushed before that. Only usable by writers that only append.
+	dl_binary_writer_flush_func flush_func;
+	void*                       flush_ctx;
+	size_t                      flushed;
 };
 
 static inline void dl_binary_writer_init( dl_binary_writer* writer,
@@ -37,6 +50,64 @@ static inline void dl_binary_writer_init( dl_binary_writer* writer,
 	writer->needed_size    = 0;
 	writer->data           = out_data;
 	writer->data_size      = out_data_size;
+	writer->grow_alloc     = 0x0;
+	writer->out_of_memory  = false;
+	writer->flush_func     = 0x0;
+	writer->flush_ctx      = 0x0;
+	writer->flushed        = 0;
+}
+
+/**
+ * Hand all data written so far to flush_func and restart writing from the start of data.
+ */
+static inline void dl_binary_writer_flush( dl_binary_writer* writer )
+{
+	DL_ASSERT( writer->flush_func != 0x0 && writer->pos == writer->needed_size && "only appending writers can be flushed!" );
+	// pos has moved past data_size if a write did not fit, flushing would then read outside of data.
+	if( writer->pos > 0 && !writer->out_of_memory )
+		writer->flush_func( writer->data, writer->pos, writer->flush_ctx );
+	writer->flushed    += writer->pos;
+	writer->pos         = 0;
+	writer->needed_size = 0;
+}
+
+/**
+ * Return true if the bytes up to end can be written, growing data if the writer has a grow_alloc.
+ * Grown memory is zeroed so that space only reserved and never written is deterministic. If growing fails
+ * out_of_memory is set and false is returned from then on.
+ * A writer with a flush_func is flushed instead, moving pos back to 0, so callers should read pos after this call.
+ * A single write to it need to fit data_size, if it does not out_of_memory is set and nothing more is flushed.
+ */
+static inline bool dl_binary_writer_fits( dl_binary_writer* writer, size_t end )
+{
+	if( end <= writer->data_size )
+		return true;
+	if( writer->flush_func != 0x0 )
+	{
+		size_t bytes = end - writer->pos;
+		DL_ASSERT( bytes <= writer->data_size && "a single write to a flushing writer need to fit its buffer!" );
+		dl_binary_writer_flush( writer );
+		if( bytes <= writer->data_size )
+			return true;
+		writer->out_of_memory = true;
+		return false;
+	}
+	if( writer->grow_alloc == 0x0 || writer->out_of_memory )
+		return false;
+
+	size_t new_size = writer->data_size * 2;
+	if( new_size < end )  new_size = end;
+	if( new_size < 1024 ) new_size = 1024;
+	uint8_t* new_data = (uint8_t*)dl_realloc( writer->grow_alloc, writer->data, new_size, writer->data_size );
+	if( new_data == 0x0 )
+	{
+		writer->out_of_memory = true;
+		return false;
+	}
+	memset( new_data + writer->data_size, 0x0, new_size - writer->data_size );
+	writer->data      = new_data;
+	writer->data_size = new_size;
+	return true;
 }
 
 static inline void   dl_binary_writer_seek_set( dl_binary_writer* writer, size_t pos ) { writer->pos  = pos;                 DL_LOG_BIN_WRITER_VERBOSE("Seek Set: " DL_PINT_FMT_STR, writer->pos); }
@@ -51,7 +122,7 @@ static inline void dl_binary_writer_update_needed_size( dl_binary_writer* writer
 
 static inline void dl_binary_writer_write( dl_binary_writer* writer, const void* data, size_t size )
 {
-	if( !writer->dummy && ( writer->pos + size <= writer->data_size ) )
+	if( !writer->dummy && dl_binary_writer_fits( writer, writer->pos + size ) )
 	{
 		switch( size )
 		{
@@ -81,6 +152,23 @@ static inline void dl_binary_writer_write_fp32  ( dl_binary_writer* writer, floa
 static inline void dl_binary_writer_write_fp64  ( dl_binary_writer* writer, double    u ) { dl_binary_writer_write( writer, &u, sizeof(double)   );  }
 static inline void dl_binary_writer_write_pint  ( dl_binary_writer* writer, uintptr_t u ) { dl_binary_writer_write( writer, &u, sizeof(uintptr_t) ); }
 
+/**
+ * Write value as an unsigned LEB128 varint, 7 bits per byte starting with the lowest bits and the high bit set on
+ * all bytes but the last.
+ */
+static inline void dl_binary_writer_write_varint( dl_binary_writer* writer, uint64_t value )
+{
+	uint8_t bytes[10];
+	size_t  count = 0;
+	do
+	{
+		uint8_t byte = (uint8_t)( value & 0x7F );
+		value >>= 7;
+		bytes[count++] = value ? (uint8_t)( byte | 0x80 ) : byte;
+	} while( value );
+	dl_binary_writer_write( writer, bytes, count );
+}
+
 static inline void dl_binary_writer_write_1byte( dl_binary_writer* writer, const void* data )
 {
 	dl_binary_writer_write( writer, data, 1 );
@@ -153,21 +241,15 @@ static inline void dl_binary_writer_write_array( dl_binary_writer* writer, const
 		}
 	}
 
-	if( writer->source_endian != writer->target_endian )
+	if( writer->source_endian != writer->target_endian && elem_size > 1 )
 	{
-		for(size_t i = 0; i < count; ++i)
-		{
-			switch( elem_size )
-			{
-				case 1: dl_binary_writer_write_1byte( writer, (const uint8_t*)array + i * elem_size ); break;
-				case 2: dl_binary_writer_write_2byte( writer, (const uint8_t*)array + i * elem_size ); break;
-				case 4: dl_binary_writer_write_4byte( writer, (const uint8_t*)array + i * elem_size ); break;
-				case 8: dl_binary_writer_write_8byte( writer, (const uint8_t*)array + i * elem_size ); break;
-				default:
-					DL_ASSERT( false && "unhandled case!" );
-					break;
-			}
-		}
+		DL_ASSERT( ( elem_size == 2 || elem_size == 4 || elem_size == 8 ) && "unhandled case!" );
+		size_t size = elem_size * count;
+		if( !writer->dummy && dl_binary_writer_fits( writer, writer->pos + size ) )
+			dl_swap_endian_array( writer->data + writer->pos, array, count, elem_size );
+
+		writer->pos += size;
+		dl_binary_writer_update_needed_size( writer );
 	}
 	else
 		dl_binary_writer_write( writer, array, elem_size * count );
@@ -211,34 +293,54 @@ static inline void dl_binary_writer_write_zero( dl_binary_writer* writer, size_t
 	if( !writer->dummy )
 	{
 		DL_LOG_BIN_WRITER_VERBOSE("Write zero: " DL_PINT_FMT_STR " + " DL_PINT_FMT_STR, writer->pos, bytes);
-		DL_ASSERT( writer->pos + bytes <= writer->data_size && "To small buffer!" );
-		memset( writer->data + writer->pos, 0x0, bytes );
+		if( dl_binary_writer_fits( writer, writer->pos + bytes ) )
+			memset( writer->data + writer->pos, 0x0, bytes );
+		else
+			DL_ASSERT( writer->grow_alloc != 0x0 && "To small buffer!" );
 	}
 
 	writer->pos += bytes;
 	dl_binary_writer_update_needed_size( writer );
 }
 
+/**
+ * Return a pointer where at most max_bytes can be written directly into the output buffer, or 0x0 if the writer is
+ * a dummy or the data would not fit. Finish with dl_binary_writer_direct_commit() with the amount of bytes actually written.
+ */
+static inline uint8_t* dl_binary_writer_direct( dl_binary_writer* writer, size_t max_bytes )
+{
+	if( writer->dummy || !dl_binary_writer_fits( writer, writer->pos + max_bytes ) )
+		return 0x0;
+	return writer->data + writer->pos;
+}
+
+static inline void dl_binary_writer_direct_commit( dl_binary_writer* writer, size_t bytes )
+{
+	writer->pos += bytes;
+	dl_binary_writer_update_needed_size( writer );
+}
+
 static inline void dl_binary_writer_reserve( dl_binary_writer* writer, size_t bytes )
 {
 	DL_LOG_BIN_WRITER_VERBOSE( "Reserve: " DL_PINT_FMT_STR " + " DL_PINT_FMT_STR, writer->pos, bytes );
 	writer->needed_size = writer->needed_size >= writer->pos + bytes ? writer->needed_size : writer->pos + bytes;
 }
 
-static inline uint8_t  dl_binary_writer_read_uint8 ( dl_binary_writer* writer ) { return writer->dummy ? ( uint8_t)0 : *( uint8_t*)( writer->data + writer->pos ); }
-static inline uint16_t dl_binary_writer_read_uint16( dl_binary_writer* writer ) { return writer->dummy ? (uint16_t)0 : *(uint16_t*)( writer->data + writer->pos ); }
-static inline uint32_t dl_binary_writer_read_uint32( dl_binary_writer* writer ) { return writer->dummy ? (uint32_t)0 : *(uint32_t*)( writer->data + writer->pos ); }
-static inline uint64_t dl_binary_writer_read_uint64( dl_binary_writer* writer ) { return writer->dummy ? (uint64_t)0 : *(uint64_t*)( writer->data + writer->pos ); }
+// reads might be unaligned, txt-pack writes array-elements that has subdata unaligned before relocating them.
+static inline uint8_t  dl_binary_writer_read_uint8 ( dl_binary_writer* writer ) { uint8_t  v = 0; if( !writer->dummy && writer->pos + sizeof(v) <= writer->data_size ) memcpy( &v, writer->data + writer->pos, sizeof(v) ); return v; }
+static inline uint16_t dl_binary_writer_read_uint16( dl_binary_writer* writer ) { uint16_t v = 0; if( !writer->dummy && writer->pos + sizeof(v) <= writer->data_size ) memcpy( &v, writer->data + writer->pos, sizeof(v) ); return v; }
+static inline uint32_t dl_binary_writer_read_uint32( dl_binary_writer* writer ) { uint32_t v = 0; if( !writer->dummy && writer->pos + sizeof(v) <= writer->data_size ) memcpy( &v, writer->data + writer->pos, sizeof(v) ); return v; }
+static inline uint64_t dl_binary_writer_read_uint64( dl_binary_writer* writer ) { uint64_t v = 0; if( !writer->dummy && writer->pos + sizeof(v) <= writer->data_size ) memcpy( &v, writer->data + writer->pos, sizeof(v) ); return v; }
 
 static inline void dl_binary_writer_align( dl_binary_writer* writer, size_t align )
 {
-	size_t alignment = dl_internal_align_up( writer->pos, align );
-	if( !writer->dummy && alignment != writer->pos )
+	size_t pad = dl_internal_align_up( writer->pos, align ) - writer->pos;
+	if( !writer->dummy && pad != 0 && dl_binary_writer_fits( writer, writer->pos + pad ) )
 	{
-		DL_LOG_BIN_WRITER_VERBOSE( "Align: " DL_PINT_FMT_STR " + " DL_PINT_FMT_STR " (" DL_PINT_FMT_STR ")", writer->pos, alignment - writer->pos, align );
-		memset( writer->data + writer->pos, 0x0, alignment - writer->pos);
+		DL_LOG_BIN_WRITER_VERBOSE( "Align: " DL_PINT_FMT_STR " + " DL_PINT_FMT_STR " (" DL_PINT_FMT_STR ")", writer->pos, pad, align );
+		memset( writer->data + writer->pos, 0x0, pad );
 	}
-	writer->pos = alignment;
+	writer->pos += pad;
 	dl_binary_writer_update_needed_size( writer );
 };
 
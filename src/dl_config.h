@@ -40,6 +40,11 @@
  *   The 2 macros must expand to something converting to an uint32_t in the end.
  * 
  *   If none of the macros are defined, dl will use a fairly simple default hash-function.
+ *
+ * SIMD:
+ *
+ *   Endian-swapping of large arrays of pods use SSE2/SSSE3/AVX2 or NEON when the compiler targets them.
+ *   Define DL_NO_SIMD to always use the plain scalar code.
  */
 #if defined(DL_USER_CONFIG)
 #  include DL_USER_CONFIG
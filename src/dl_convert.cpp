@@ -2,6 +2,7 @@
 
 #include "dl_types.h"
 #include "dl_binary_writer.h"
+#include "dl_hash_table.h"
 
 #include <dl/dl.h>
 #include <dl/dl_convert.h>
@@ -39,15 +40,22 @@ public:
 		, src_ptr_size(src_ptr_size)
 		, target_ptr_size(tgt_ptr_size)
 	    , instances(allocator)
+	    , instance_addresses(allocator)
 	    , m_lPatchOffset(allocator)
+	    , out_of_memory(false)
 	{}
 
+	bool AddInstance( const SInstance& inst )
+	{
+		instances.Add( inst );
+		if( !IsSwapped( inst.address ) && !instance_addresses.Insert( inst.address, true ) )
+			out_of_memory = true;
+		return !out_of_memory;
+	}
+
 	bool IsSwapped( const uint8_t* ptr )
 	{
-		for(unsigned int i = 0; i < instances.Len(); ++i)
-			if(ptr == instances[i].address)
-				return true;
-		return false;
+		return instance_addresses.Find( ptr ) != 0x0;
 	}
 
 	dl_endian_t src_endian;
@@ -57,6 +65,9 @@ public:
 
 	CArrayStatic<SInstance, 128> instances;
 
+	// addresses of all instances, to not have to search instances for each pointer.
+	CHashTableStatic<const void*, bool, 128> instance_addresses;
+
 	struct PatchPos
 	{
 		PatchPos() : pos(0), old_offset(0) {}
@@ -69,6 +80,9 @@ public:
 	};
 
 	CArrayStatic<PatchPos, 256> m_lPatchOffset;
+
+	// set if an instance address could not be recorded, the conversion can't be trusted after that.
+	bool out_of_memory;
 };
 
 static inline void dl_swap_header( dl_data_header* header )
@@ -184,7 +198,7 @@ static void dl_internal_convert_collect_instances_from_str( const uint8_t*
 {
 	uintptr_t offset = dl_internal_read_ptr_data( member_data, convert_ctx.src_endian, convert_ctx.src_ptr_size );
 	if(offset != DL_NULL_PTR_OFFSET[convert_ctx.src_ptr_size])
-		convert_ctx.instances.Add(SInstance(base_data + offset, 0x0, 1337, dl_make_type(DL_TYPE_ATOM_POD, DL_TYPE_STORAGE_STR)));
+		convert_ctx.AddInstance(SInstance(base_data + offset, 0x0, 1337, dl_make_type(DL_TYPE_ATOM_POD, DL_TYPE_STORAGE_STR)));
 }
 
 static dl_error_t dl_internal_convert_collect_instances_from_ptr( dl_ctx_t ctx,
@@ -201,7 +215,9 @@ static dl_error_t dl_internal_convert_collect_instances_from_ptr( dl_ctx_t ctx,
 		const uint8_t* ptr_data = base_data + offset;
 		if(!convert_ctx.IsSwapped(ptr_data))
 		{
-			convert_ctx.instances.Add(SInstance(ptr_data, sub_type, 0, dl_make_type(DL_TYPE_ATOM_POD, DL_TYPE_STORAGE_PTR)));
+			// stop here if the address could not be recorded, following ptrs again would never end on cyclic data.
+			if( !convert_ctx.AddInstance(SInstance(ptr_data, sub_type, 0, dl_make_type(DL_TYPE_ATOM_POD, DL_TYPE_STORAGE_PTR))) )
+				return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
 			err = dl_internal_convert_collect_instances( ctx, sub_type, base_data + offset, base_data, convert_ctx );
 		}
 	}
@@ -215,6 +231,10 @@ static dl_error_t dl_internal_convert_collect_instances_from_struct_array( dl_ct
 																		   const uint8_t*      base_data,
 																		   SConvertContext&    convert_ctx )
 {
+	// ... nothing to collect from structs without pointers ...
+	if( ( sub_type->flags & ( DL_TYPE_FLAG_HAS_SUBDATA | DL_TYPE_FLAG_IS_UNION ) ) == 0 )
+		return DL_ERROR_OK;
+
 	uint32_t elem_size = sub_type->size[convert_ctx.src_ptr_size];
 	for( uint32_t elem = 0; elem < array_count; ++elem )
 	{
@@ -362,7 +382,7 @@ static dl_error_t dl_internal_convert_collect_instances_from_member( dl_ctx_t
 					break;
 			}
 
-			convert_ctx.instances.Add(SInstance(array_data, sub_type, array_count, member->type));
+			convert_ctx.AddInstance(SInstance(array_data, sub_type, array_count, member->type));
 		}
 		break;
 
@@ -484,6 +504,38 @@ static dl_error_t dl_internal_convert_write_struct( dl_ctx_t            dl_ctx,
 													SConvertContext&    conv_ctx,
 													dl_binary_writer*   writer );
 
+/**
+ * If all members of type are pods of the same size, packed without padding, return that size and 0 otherwise.
+ * Arrays of such types can be written as one big array of pods instead of struct by struct and member by member.
+ */
+static size_t dl_internal_convert_uniform_pod_size( dl_ctx_t ctx, const dl_type_desc* type, const SConvertContext& conv_ctx )
+{
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+		return 0;
+	if( type->size[conv_ctx.src_ptr_size] != type->size[conv_ctx.target_ptr_size] )
+		return 0;
+
+	size_t pod_size = 0;
+	size_t offset   = 0;
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_desc* member = dl_get_type_member( ctx, type, member_index );
+		dl_type_atom_t atom = member->AtomType();
+		if( ( atom != DL_TYPE_ATOM_POD && atom != DL_TYPE_ATOM_INLINE_ARRAY ) || !member->IsSimplePod() )
+			return 0;
+
+		size_t size = dl_pod_size( member->StorageType() );
+		if( pod_size != 0 && size != pod_size )
+			return 0;
+		if( member->offset[conv_ctx.src_ptr_size] != offset )
+			return 0;
+
+		pod_size = size;
+		offset  += member->size[conv_ctx.src_ptr_size];
+	}
+	return offset == type->size[conv_ctx.src_ptr_size] ? pod_size : 0;
+}
+
 static dl_error_t dl_internal_convert_write_member( dl_ctx_t              ctx,
 													const uint8_t*        member_data,
 													const dl_type_desc*   type,
@@ -534,6 +586,13 @@ static dl_error_t dl_internal_convert_write_member( dl_ctx_t              ctx,
 						return DL_ERROR_TYPE_NOT_FOUND;
 
 					uintptr_t SubtypeSize = sub_type->size[conv_ctx.src_ptr_size];
+					size_t pod_size = dl_internal_convert_uniform_pod_size( ctx, sub_type, conv_ctx );
+					if( pod_size != 0 )
+					{
+						dl_binary_writer_write_array( writer, member_data, member->inline_array_cnt() * SubtypeSize / pod_size, pod_size );
+						break;
+					}
+
 					for( uint32_t i = 0; i < member->inline_array_cnt(); ++i )
 			        {
 						dl_error_t err = dl_internal_convert_write_struct( ctx, member_data + i * SubtypeSize, sub_type, conv_ctx, writer );
@@ -724,6 +783,14 @@ static dl_error_t dl_internal_convert_write_instance( dl_ctx_t          dl_ctx,
 				case DL_TYPE_STORAGE_STRUCT:
 				{
 					uintptr_t type_size = inst.type->size[conv_ctx.src_ptr_size];
+					size_t pod_size = dl_internal_convert_uniform_pod_size( dl_ctx, inst.type, conv_ctx );
+					if( pod_size != 0 )
+					{
+						// ... no pointers or padding, swap the entire array in one go ...
+						dl_binary_writer_write_array( writer, u8, inst.array_count * type_size / pod_size, pod_size );
+						break;
+					}
+
 					for( uintptr_t elem = 0; elem < inst.array_count; ++elem )
 					{
 						dl_error_t err = dl_internal_convert_write_struct( dl_ctx, u8 + ( elem * type_size ), inst.type, conv_ctx, writer );
@@ -817,8 +884,12 @@ dl_error_t dl_internal_convert_no_header( dl_ctx_t            dl_ctx,
                                           dl_binary_writer*   writer,               size_t*          needed_size,
                                           const dl_type_desc* root_type )
 {
-	conv_ctx.instances.Add(SInstance(packed_instance, root_type, 0x0, dl_make_type(DL_TYPE_ATOM_POD, DL_TYPE_STORAGE_STRUCT)));
+	conv_ctx.AddInstance(SInstance(packed_instance, root_type, 0x0, dl_make_type(DL_TYPE_ATOM_POD, DL_TYPE_STORAGE_STRUCT)));
 	dl_error_t err = dl_internal_convert_collect_instances(dl_ctx, root_type, packed_instance, packed_instance_base, conv_ctx);
+	if( err == DL_ERROR_OK && conv_ctx.out_of_memory )
+		err = DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	if( err != DL_ERROR_OK )
+		return err;
 
 	// TODO: we need to sort the instances here after their offset!
 
@@ -837,48 +908,55 @@ dl_error_t dl_internal_convert_no_header( dl_ctx_t            dl_ctx,
 	}
 
 	dl_binary_writer_seek_end( writer );
-	*needed_size = (unsigned int)dl_binary_writer_tell( writer );
+	size_t instance_end = dl_binary_writer_tell( writer );
+
+	SConvertContext::PatchPos* patch_pos = conv_ctx.m_lPatchOffset.m_Ptr;
+	size_t                     patch_cnt = conv_ctx.m_lPatchOffset.Len();
+	std::sort( patch_pos, patch_pos + patch_cnt, dl_internal_sort_patchpos_pred );
 
 	if( !writer->dummy ) // no need to patch data if we are only calculating size
 	{
-		dl_data_header* new_header = (dl_data_header*)writer->data;
-		uintptr_t offset_shift     = ( conv_ctx.target_ptr_size == DL_PTR_SIZE_32BIT ? 4 : 8 ) * 4;
-
-		if( *needed_size >= ( 1ULL << offset_shift ) )
-			new_header->not_using_ptr_chain_patching = 1;
-		else
-			new_header->not_using_ptr_chain_patching = 0;
-		size_t header_offset      = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
-		new_header->instance_size = uint32_t( *needed_size - header_offset );
-
-		if( conv_ctx.m_lPatchOffset.Len() )
+		for( size_t i = 0; i < patch_cnt; ++i )
 		{
-			std::sort( conv_ctx.m_lPatchOffset.m_Ptr, conv_ctx.m_lPatchOffset.m_Ptr + conv_ctx.m_lPatchOffset.Len(), dl_internal_sort_patchpos_pred );
-			conv_ctx.m_lPatchOffset.Add( conv_ctx.m_lPatchOffset[conv_ctx.m_lPatchOffset.Len() - 1] ); // Adding last pointer again so the offset to next pointer becomes 0 which terminates patching
-			for( unsigned int i = 0; i < conv_ctx.m_lPatchOffset.Len() - 1; ++i )
-			{
-				SConvertContext::PatchPos& pp = conv_ctx.m_lPatchOffset[i];
+			SConvertContext::PatchPos& pp = patch_pos[i];
 
-				if( i == 0 && !new_header->not_using_ptr_chain_patching )
-					new_header->first_pointer_to_patch = conv_ctx.tgt_endian != DL_ENDIAN_HOST ? dl_swap_endian_uint32( (uint32_t)pp.pos ) : (uint32_t)pp.pos;
+			// find new offset
+			uint64_t new_offset = 0;
+			const SInstance* instance = std::lower_bound( conv_ctx.instances.m_Ptr, conv_ctx.instances.m_Ptr + conv_ctx.instances.Len(), pp.old_offset + (uintptr_t)packed_instance_base, dl_internal_search_pred );
+			if( instance != conv_ctx.instances.m_Ptr + conv_ctx.instances.Len() )
+			{
+				uintptr_t old_offset = (uintptr_t)( instance->address - packed_instance_base );
+				if( old_offset == pp.old_offset )
+					new_offset = instance->offset_after_patch;
+			}
 
-				// find new offset
-				uint64_t new_offset = 0;
-				const SInstance* instance = std::lower_bound( conv_ctx.instances.m_Ptr, conv_ctx.instances.m_Ptr + conv_ctx.instances.Len(), pp.old_offset + (uintptr_t)packed_instance_base, dl_internal_search_pred );
-				if( instance != conv_ctx.instances.m_Ptr + conv_ctx.instances.Len() )
-				{
-					uintptr_t old_offset = (uintptr_t)( instance->address - packed_instance_base );
-					if( old_offset == pp.old_offset )
-						new_offset = instance->offset_after_patch;
-				}
+			DL_ASSERT_MSG( new_offset != (uintptr_t)0, "We should have found the instance!" );
+			dl_binary_writer_seek_set( writer, pp.pos );
+			dl_binary_writer_write_ptr( writer, new_offset );
+		}
+	}
 
-				DL_ASSERT_MSG( new_offset != (uintptr_t)0, "We should have found the instance!" );
-				dl_binary_writer_seek_set( writer, pp.pos );
-				if( !new_header->not_using_ptr_chain_patching )
-					new_offset = new_offset | ( ( (uint64_t)( conv_ctx.m_lPatchOffset[i + 1].pos - conv_ctx.m_lPatchOffset[i].pos ) ) << offset_shift );
+	// ... the patch-table is written after the instance in both passes, its size depends on the positions ...
+	dl_binary_writer_seek_set( writer, instance_end );
+	uintptr_t prev_pos = 0;
+	for( size_t i = 0; i < patch_cnt; ++i )
+	{
+		DL_ASSERT( patch_pos[i].pos > prev_pos && "pointers to patch need to be sorted and unique!" );
+		dl_binary_writer_write_varint( writer, patch_pos[i].pos - prev_pos );
+		prev_pos = patch_pos[i].pos;
+	}
+	*needed_size = dl_binary_writer_tell( writer );
 
-				dl_binary_writer_write_ptr( writer, new_offset );
-			}
+	if( !writer->dummy )
+	{
+		dl_data_header* new_header = (dl_data_header*)writer->data;
+		size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+		new_header->instance_size    = uint32_t( instance_end - header_offset );
+		new_header->patch_table_size = uint32_t( *needed_size - instance_end );
+		if( conv_ctx.tgt_endian != DL_ENDIAN_HOST )
+		{
+			new_header->instance_size    = dl_swap_endian_uint32( new_header->instance_size );
+			new_header->patch_table_size = dl_swap_endian_uint32( new_header->patch_table_size );
 		}
 	}
 
@@ -898,11 +976,18 @@ static dl_error_t dl_internal_convert_instance( dl_ctx_t       dl_ctx,
 		header.id != DL_INSTANCE_ID_SWAPED )                       return DL_ERROR_MALFORMED_DATA;
 	if( header.version != DL_INSTANCE_VERSION &&
 		header.version != DL_INSTANCE_VERSION_SWAPED &&
+		header.version != DL_INSTANCE_VERSION_CHAIN &&
+		header.version != DL_INSTANCE_VERSION_CHAIN_SWAPED &&
 		header.version != 1 &&
 		header.version != dl_swap_endian_uint32(1) )               return DL_ERROR_VERSION_MISMATCH;
 	if( header.root_instance_type != type &&
 		header.root_instance_type != dl_swap_endian_uint32(type) ) return DL_ERROR_TYPE_MISMATCH;
 	if( out_ptr_size != 4 && out_ptr_size != 8 )                   return DL_ERROR_INVALID_PARAMETER;
+	if( header.using_relative_ptrs )
+	{
+		dl_log_error( dl_ctx, "instances with relative pointers can't be converted" );
+		return DL_ERROR_UNSUPPORTED_OPERATION;
+	}
 
 	dl_ptr_size_t src_ptr_size = header.is_64_bit_ptr != 0 ? DL_PTR_SIZE_64BIT : DL_PTR_SIZE_32BIT;
 	dl_ptr_size_t dst_ptr_size;
@@ -952,20 +1037,15 @@ static dl_error_t dl_internal_convert_instance( dl_ctx_t       dl_ctx,
 		new_header->id                 = DL_INSTANCE_ID;
 		new_header->version            = DL_INSTANCE_VERSION;
 		new_header->root_instance_type = type;
-		new_header->instance_size      = uint32_t( out_instance_size - header_offset );
 		new_header->is_64_bit_ptr      = out_ptr_size == 4 ? 0 : 1;
 
-		uintptr_t offset_shift = out_ptr_size * 4;
-		if( out_instance_size >= ( 1ULL << offset_shift ) )
-			new_header->not_using_ptr_chain_patching = 1;
-
 		if( DL_ENDIAN_HOST != out_endian )
 			dl_swap_header( new_header );
 	}
 	
 	SConvertContext conv_ctx( src_endian, out_endian, src_ptr_size, dst_ptr_size, dl_ctx->alloc );
 	// While converting we always do slow patching, so neutralize the patch offsets
-	if( header.version == DL_INSTANCE_VERSION && !header.not_using_ptr_chain_patching )
+	if( header.version == DL_INSTANCE_VERSION_CHAIN && !header.not_using_ptr_chain_patching )
 	{
 		uint32_t offset_to_next_pointer_to_patch = header.first_pointer_to_patch;
 		uint8_t* patch_mem = packed_instance;
@@ -1006,7 +1086,7 @@ static dl_error_t dl_internal_convert_instance( dl_ctx_t       dl_ctx,
 	}
 	return dl_internal_convert_no_header( dl_ctx,
 	                                      packed_instance + header_offset,
-										  packed_instance + (header.version == DL_INSTANCE_VERSION ? 0 : header_offset),
+										  packed_instance + (header.version == 1 ? header_offset : 0),
 										  conv_ctx,
 										  &writer,
 										  out_size,
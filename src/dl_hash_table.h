@@ -0,0 +1,139 @@
+#ifndef DL_HASH_TABLE_H_INCLUDED
+#define DL_HASH_TABLE_H_INCLUDED
+
+#include "dl_types.h"
+
+/**
+ * Hash and compare functions used by CHashTableStatic, overload these for new key-types.
+ */
+static inline uint32_t dl_hash_table_key_hash( uintptr_t key )
+{
+	uint64_t h = (uint64_t)key;
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return (uint32_t)h;
+}
+
+static inline uint32_t dl_hash_table_key_hash( const void* key )                   { return dl_hash_table_key_hash( (uintptr_t)key ); }
+static inline bool     dl_hash_table_key_equal( uintptr_t k1, uintptr_t k2 )       { return k1 == k2; }
+static inline bool     dl_hash_table_key_equal( const void* k1, const void* k2 )   { return k1 == k2; }
+
+// An open addressing hash-table using a stack buffer while small. Same as with CArrayStatic, use it to avoid dynamic
+// allocations while the stack is big enough, but fall back to heap if it grows past the wanted stack size.
+// SIZE need to be a power of 2.
+template <typename K, typename V, int SIZE>
+class CHashTableStatic
+{
+private:
+	struct SEntry
+	{
+		K    key;
+		V    value;
+		bool used;
+	};
+
+	SEntry* FindEntry( const K& key ) const
+	{
+		size_t mask = m_nCapacity - 1;
+		for( size_t slot = dl_hash_table_key_hash( key ) & mask; m_Ptr[slot].used; slot = ( slot + 1 ) & mask )
+			if( dl_hash_table_key_equal( m_Ptr[slot].key, key ) )
+				return &m_Ptr[slot];
+		return 0x0;
+	}
+
+	void InsertNoGrow( const K& key, const V& value )
+	{
+		size_t mask = m_nCapacity - 1;
+		size_t slot = dl_hash_table_key_hash( key ) & mask;
+		while( m_Ptr[slot].used )
+			slot = ( slot + 1 ) & mask;
+
+		new (&m_Ptr[slot].key) K(key);
+		new (&m_Ptr[slot].value) V(value);
+		m_Ptr[slot].used = true;
+	}
+
+	// returns false, and leaves the table as it was, if the new entries could not be allocated.
+	inline bool GrowIfNeeded()
+	{
+		// keep load-factor <= 0.5 to keep probe-sequences short.
+		if( ( m_nElements + 1 ) * 2 <= m_nCapacity )
+			return true;
+
+		SEntry* new_entries = reinterpret_cast<SEntry*>( dl_alloc( &m_Allocator, sizeof(SEntry) * m_nCapacity * 2 ) );
+		if( new_entries == 0x0 )
+			return false;
+
+		SEntry* old_entries  = m_Ptr;
+		size_t  old_capacity = m_nCapacity;
+
+		m_nCapacity *= 2;
+		m_Ptr = new_entries;
+		for( size_t i = 0; i < m_nCapacity; ++i )
+			m_Ptr[i].used = false;
+
+		for( size_t i = 0; i < old_capacity; ++i )
+			if( old_entries[i].used )
+				InsertNoGrow( old_entries[i].key, old_entries[i].value );
+
+		if( old_entries != &m_Storage[0] )
+			dl_free( &m_Allocator, old_entries );
+		return true;
+	}
+
+public:
+	SEntry* m_Ptr;
+	SEntry m_Storage[SIZE];
+	size_t m_nElements;
+	size_t m_nCapacity;
+	dl_allocator m_Allocator;
+
+	explicit CHashTableStatic(dl_allocator allocator)
+	{
+		m_nElements = 0;
+		m_nCapacity = SIZE;
+		m_Ptr = &m_Storage[0];
+		m_Allocator = allocator;
+		for( size_t i = 0; i < m_nCapacity; ++i )
+			m_Ptr[i].used = false;
+	}
+
+	~CHashTableStatic()
+	{
+		if (m_Ptr != &m_Storage[0])
+		{
+			dl_free(&m_Allocator, m_Ptr);
+		}
+	}
+
+	inline size_t Len()
+	{
+		return m_nElements;
+	}
+
+	/**
+	 * Return pointer to value stored for key or 0x0 if key is not in the table.
+	 */
+	V* Find( const K& key ) const
+	{
+		SEntry* e = FindEntry( key );
+		return e ? &e->value : 0x0;
+	}
+
+	/**
+	 * Insert value for key, key is required to not already be in the table.
+	 * Returns false, without inserting, if the table needed to grow and memory for that could not be allocated.
+	 */
+	bool Insert( const K& key, const V& value )
+	{
+		DL_ASSERT( FindEntry( key ) == 0x0 && "key is already in the table!" );
+		if( !GrowIfNeeded() )
+			return false;
+		InsertNoGrow( key, value );
+		m_nElements++;
+		return true;
+	}
+};
+
+#endif // DL_HASH_TABLE_H_INCLUDED
@@ -1,5 +1,6 @@
 #include "dl_patch_ptr.h"
 #include "dl_types.h"
+#include "dl_binary_writer.h"
 
 static uintptr_t dl_internal_patch_ptr( uint8_t* ptrptr, uintptr_t patch_distance )
 {
@@ -16,7 +17,7 @@ static void dl_internal_patch_struct( dl_ctx_t            ctx,
 									  uintptr_t           base_address,
 									  uintptr_t           patch_distance,
 									  dl_patched_ptrs*    patched_ptrs,
-									  dl_patched_ptrs*    patched_payloads );
+									  dl_patched_payloads* patched_payloads );
 
 static void dl_internal_patch_ptr_instance( dl_ctx_t            ctx,
 		   	   	   	   	   	   	   	   	    const dl_type_desc* sub_type,
@@ -24,7 +25,7 @@ static void dl_internal_patch_ptr_instance( dl_ctx_t            ctx,
 											uintptr_t           base_address,
 											uintptr_t           patch_distance,
 											dl_patched_ptrs*    patched_ptrs,
-											dl_patched_ptrs*    patched_payloads )
+											dl_patched_payloads* patched_payloads )
 {
 	uintptr_t offset = dl_internal_patch_ptr( ptr_data, patch_distance );
 	if( offset == 0x0 )
@@ -34,7 +35,8 @@ static void dl_internal_patch_ptr_instance( dl_ctx_t            ctx,
 	if( patched_payloads->patched( ptr ) )
 		return;
 
-	patched_payloads->add( ptr );
+	if( !patched_payloads->add( ptr ) )
+		return; // can't know if ptr is reached again, patching it twice would break it.
 	dl_internal_patch_struct( ctx, sub_type, (uint8_t*)ptr, base_address, patch_distance, patched_ptrs, patched_payloads );
 }
 
@@ -52,7 +54,7 @@ static void dl_internal_patch_ptr_array( dl_ctx_t            ctx,
 										 uintptr_t           base_address,
 										 uintptr_t           patch_distance,
 										 dl_patched_ptrs*    patched_ptrs,
-                                         dl_patched_ptrs*    patched_payloads )
+                                         dl_patched_payloads* patched_payloads )
 {
 	for( uint32_t index = 0; index < count; ++index )
 		dl_internal_patch_ptr_instance( ctx, sub_type, array_data + index * sizeof(void*), base_address, patch_distance, patched_ptrs, patched_payloads );
@@ -65,7 +67,7 @@ static void dl_internal_patch_struct_array( dl_ctx_t            ctx,
 											uintptr_t           base_address,
 											uintptr_t           patch_distance,
 											dl_patched_ptrs*    patched_ptrs,
-											dl_patched_ptrs*    patched_payloads )
+											dl_patched_payloads* patched_payloads )
 {
 	uint32_t size = dl_internal_align_up( type->size[DL_PTR_SIZE_HOST], type->alignment[DL_PTR_SIZE_HOST] );
 	for( uint32_t index = 0; index < count; ++index )
@@ -75,13 +77,87 @@ static void dl_internal_patch_struct_array( dl_ctx_t            ctx,
 	}
 }
 
+static void dl_internal_patch_array( dl_ctx_t            ctx,
+									 dl_type_storage_t   storage_type,
+									 const dl_type_desc* sub_type,
+									 uint8_t*            member_data,
+									 uintptr_t           base_address,
+									 uintptr_t           patch_distance,
+									 dl_patched_ptrs*    patched_ptrs,
+									 dl_patched_payloads* patched_payloads )
+{
+	uintptr_t offset = dl_internal_patch_ptr( member_data, patch_distance );
+	if( offset && patched_ptrs )
+		patched_ptrs->add( uintptr_t( member_data - base_address ) );
+
+	uint8_t* src   = member_data + sizeof( void* );
+	uint32_t count = *(uint32_t*)src;
+
+	if( count == 0 )
+		return;
+
+	uint8_t* array_data = (uint8_t*)base_address + offset;
+	switch( storage_type )
+	{
+		case DL_TYPE_STORAGE_STR:
+			dl_internal_patch_str_array( array_data, count, patch_distance, base_address, patched_ptrs );
+		break;
+		case DL_TYPE_STORAGE_PTR:
+			dl_internal_patch_ptr_array( ctx, array_data, count, sub_type, base_address, patch_distance, patched_ptrs, patched_payloads );
+		break;
+		case DL_TYPE_STORAGE_STRUCT:
+			dl_internal_patch_struct_array( ctx, sub_type, array_data, count, base_address, patch_distance, patched_ptrs, patched_payloads );
+		break;
+		default:
+			break;
+	}
+}
+
+/**
+ * Patch all pointers in struct_data by running the non-copy ops in plan.
+ */
+static void dl_internal_patch_plan( dl_ctx_t            ctx,
+									const dl_type_plan* plan,
+									uint8_t*            struct_data,
+									uintptr_t           base_address,
+									uintptr_t           patch_distance,
+									dl_patched_ptrs*    patched_ptrs,
+									dl_patched_payloads* patched_payloads )
+{
+	const dl_plan_op* ops = ctx->plan_ops + plan->op_start;
+	for( uint32_t op_index = plan->copy_count; op_index < plan->op_count; ++op_index )
+	{
+		const dl_plan_op*   op       = &ops[op_index];
+		const dl_type_desc* sub_type = op->sub_type == UINT32_MAX ? 0x0 : ctx->type_descs + op->sub_type;
+		uint8_t*            op_data  = struct_data + op->offset;
+		switch( op->kind )
+		{
+			case DL_PLAN_OP_STR:
+				dl_internal_patch_str_array( op_data, op->count, patch_distance, base_address, patched_ptrs );
+			break;
+			case DL_PLAN_OP_PTR:
+				dl_internal_patch_ptr_array( ctx, op_data, op->count, sub_type, base_address, patch_distance, patched_ptrs, patched_payloads );
+			break;
+			case DL_PLAN_OP_STRUCT:
+				dl_internal_patch_struct_array( ctx, sub_type, op_data, op->count, base_address, patch_distance, patched_ptrs, patched_payloads );
+			break;
+			case DL_PLAN_OP_ARRAY:
+				dl_internal_patch_array( ctx, (dl_type_storage_t)op->storage, sub_type, op_data, base_address, patch_distance, patched_ptrs, patched_payloads );
+			break;
+			default:
+				DL_ASSERT(false && "Invalid plan-op!");
+			break;
+		}
+	}
+}
+
 static void dl_internal_patch_member( dl_ctx_t              ctx,
 								      const dl_member_desc* member,
 								      uint8_t*              member_data,
 								      uintptr_t             base_address,
 								      uintptr_t             patch_distance,
 								      dl_patched_ptrs*      patched_ptrs,
-								      dl_patched_ptrs*      patched_payloads )
+								      dl_patched_payloads*  patched_payloads )
 {
 	dl_type_atom_t    atom_type    = member->AtomType();
 	dl_type_storage_t storage_type = member->StorageType();
@@ -154,47 +230,14 @@ static void dl_internal_patch_member( dl_ctx_t              ctx,
 		break;
 
 		case DL_TYPE_ATOM_ARRAY:
-		{
-			uintptr_t offset = dl_internal_patch_ptr( member_data, patch_distance );
-			if( offset && patched_ptrs )
-				patched_ptrs->add( uintptr_t( member_data - base_address ) );
-
-			uint8_t* src   = member_data + sizeof( void* );
-			uint32_t count = *(uint32_t*)src;
-
-			if( count != 0 )
-			{
-				uint8_t* array_data = (uint8_t*)base_address + offset;
-				switch( storage_type )
-				{
-					case DL_TYPE_STORAGE_STR:
-						dl_internal_patch_str_array( array_data, count, patch_distance, base_address, patched_ptrs );
-					break;
-					case DL_TYPE_STORAGE_PTR:
-						dl_internal_patch_ptr_array( ctx,
-													 array_data,
-													 count,
-													 dl_internal_find_type( ctx, member->type_id ),
-													 base_address,
-													 patch_distance,
-													 patched_ptrs,
-													 patched_payloads );
-					break;
-					case DL_TYPE_STORAGE_STRUCT:
-						dl_internal_patch_struct_array( ctx,
-														dl_internal_find_type( ctx, member->type_id ),
-														array_data,
-														count,
-														base_address,
-														patch_distance,
-														patched_ptrs,
-														patched_payloads );
-					break;
-					default:
-						break;
-				}
-			}
-		}
+			dl_internal_patch_array( ctx,
+									 storage_type,
+									 storage_type == DL_TYPE_STORAGE_STR ? 0x0 : dl_internal_find_type( ctx, member->type_id ),
+									 member_data,
+									 base_address,
+									 patch_distance,
+									 patched_ptrs,
+									 patched_payloads );
 		break;
 		default:
 			break;
@@ -207,7 +250,7 @@ static void dl_internal_patch_union( dl_ctx_t            ctx,
 									 uintptr_t           base_address,
 									 uintptr_t           patch_distance,
 									 dl_patched_ptrs*    patched_ptrs,
-									 dl_patched_ptrs*    patched_payloads )
+									 dl_patched_payloads* patched_payloads )
 {
 	DL_ASSERT(type->flags & DL_TYPE_FLAG_IS_UNION);
 	size_t type_offset = dl_internal_union_type_offset( ctx, type, DL_PTR_SIZE_HOST );
@@ -225,11 +268,16 @@ static void dl_internal_patch_struct( dl_ctx_t            ctx,
 									  uintptr_t           base_address,
 									  uintptr_t           patch_distance,
 									  dl_patched_ptrs*    patched_ptrs,
-									  dl_patched_ptrs*    patched_payloads )
+									  dl_patched_payloads* patched_payloads )
 {
 	if( type->flags & DL_TYPE_FLAG_HAS_SUBDATA )
 	{
-		if( type->flags & DL_TYPE_FLAG_IS_UNION )
+		const dl_type_plan* plan = dl_internal_type_plan( ctx, type );
+		if( plan )
+		{
+			dl_internal_patch_plan( ctx, plan, struct_data, base_address, patch_distance, patched_ptrs, patched_payloads );
+		}
+		else if( type->flags & DL_TYPE_FLAG_IS_UNION )
 		{
 			dl_internal_patch_union( ctx, type, struct_data, base_address, patch_distance, patched_ptrs, patched_payloads );
 		}
@@ -244,27 +292,34 @@ static void dl_internal_patch_struct( dl_ctx_t            ctx,
 	}
 }
 
-void dl_internal_patch_member( dl_ctx_t              ctx,
-							   const dl_member_desc* member,
-							   uint8_t*              member_data,
-							   uintptr_t             base_address,
-							   uintptr_t             patch_distance,
-							   dl_patched_ptrs*      patched_ptrs )
+dl_error_t dl_internal_patch_member( dl_ctx_t              ctx,
+									 const dl_member_desc* member,
+									 uint8_t*              member_data,
+									 uintptr_t             base_address,
+									 uintptr_t             patch_distance,
+									 dl_patched_ptrs*      patched_ptrs )
 {
-	dl_patched_ptrs patched(ctx->alloc);
+	dl_patched_payloads patched(ctx->alloc);
 	dl_internal_patch_member( ctx, member, member_data, base_address, patch_distance, patched_ptrs, &patched );
+	return patched.out_of_memory ? DL_ERROR_OUT_OF_LIBRARY_MEMORY : DL_ERROR_OK;
 }
 
-void dl_internal_patch_instance( dl_ctx_t            ctx,
-								 const dl_type_desc* type,
-								 uint8_t*            instance,
-								 uintptr_t           base_address,
-								 uintptr_t           patch_distance )
+dl_error_t dl_internal_patch_instance( dl_ctx_t            ctx,
+									   const dl_type_desc* type,
+									   uint8_t*            instance,
+									   uintptr_t           base_address,
+									   uintptr_t           patch_distance )
 {
-	dl_patched_ptrs patched(ctx->alloc);
-	patched.add( (uintptr_t)instance );
+	dl_patched_payloads patched(ctx->alloc);
+	if( !patched.add( (uintptr_t)instance ) )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
 
-	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	const dl_type_plan* plan = dl_internal_type_plan( ctx, type );
+	if( plan )
+	{
+		dl_internal_patch_plan( ctx, plan, instance, base_address, patch_distance, 0, &patched );
+	}
+	else if( type->flags & DL_TYPE_FLAG_IS_UNION )
 	{
 		dl_internal_patch_union( ctx, type, instance, base_address, patch_distance, 0, &patched );
 	}
@@ -278,4 +333,16 @@ void dl_internal_patch_instance( dl_ctx_t            ctx,
 			dl_internal_patch_member( ctx, member, member_data, base_address, patch_distance, 0, &patched );
 		}
 	}
+	return patched.out_of_memory ? DL_ERROR_OUT_OF_LIBRARY_MEMORY : DL_ERROR_OK;
+}
+
+void dl_internal_patch_table_write( dl_binary_writer* writer, const uintptr_t* ptrs, size_t ptr_count )
+{
+	uintptr_t prev = 0;
+	for( size_t i = 0; i < ptr_count; ++i )
+	{
+		DL_ASSERT( ptrs[i] > prev && "pointers to patch need to be sorted and unique!" );
+		dl_binary_writer_write_varint( writer, ptrs[i] - prev );
+		prev = ptrs[i];
+	}
 }
@@ -2,7 +2,11 @@
 #define DL_PATCH_PTR_H_INCLUDED
 
 #include "dl_types.h"
+#include "dl_hash_table.h"
 
+/**
+ * Record of the positions of all patched ptrs, in the order they were patched.
+ */
 struct dl_patched_ptrs
 {
 	CArrayStatic<uintptr_t, 256> addresses;
@@ -14,19 +18,80 @@ struct dl_patched_ptrs
 
 	void add( uintptr_t addr )
 	{
-		DL_ASSERT( !patched( addr ) );
 		addresses.Add( addr );
 	}
+};
+
+/**
+ * Set of all payloads, i.e. the data ptrs point to, that has already been patched. Data can be pointed to by
+ * many ptrs but should only be patched once.
+ */
+struct dl_patched_payloads
+{
+	CHashTableStatic<uintptr_t, bool, 256> addresses;
+	bool out_of_memory; // set if a payload could not be recorded, patching stops following ptrs from it.
+
+	explicit dl_patched_payloads( dl_allocator alloc )
+		: addresses( alloc )
+		, out_of_memory( false )
+	{
+	}
+
+	bool add( uintptr_t addr )
+	{
+		if( !addresses.Insert( addr, true ) )
+			out_of_memory = true;
+		return !out_of_memory;
+	}
 
 	bool patched( uintptr_t addr )
 	{
-		for( size_t i = 0; i < addresses.Len(); ++i )
-			if( addr == addresses[i] )
-				return true;
-		return false;
+		return addresses.Find( addr ) != 0x0;
 	}
 };
 
+struct dl_binary_writer;
+
+/**
+ * Write the patch-table listing the pointers at positions ptrs, sorted in increasing order. Each position is written
+ * as a varint of the distance from the previous position, the first one from 0.
+ *
+ * @param writer writer to write the patch-table to.
+ * @param ptrs sorted positions of all pointers to patch.
+ * @param ptr_count number of positions in ptrs.
+ */
+void dl_internal_patch_table_write( dl_binary_writer* writer, const uintptr_t* ptrs, size_t ptr_count );
+
+/**
+ * Read the position of the next pointer to patch from a patch-table written by dl_internal_patch_table_write().
+ *
+ * @param iter where to read in the patch-table.
+ * @param end end of the patch-table.
+ * @param pos position of the previous pointer, 0 before the first one, updated to the position of the read pointer.
+ * @return where to read the next position or 0x0 if the patch-table is malformed.
+ */
+static inline const uint8_t* dl_internal_patch_table_read( const uint8_t* iter, const uint8_t* end, uintptr_t* pos )
+{
+	uintptr_t delta = 0;
+	for( unsigned int shift = 0; shift < sizeof(uintptr_t) * 8; shift += 7 )
+	{
+		if( iter == end )
+			return 0x0;
+
+		uint8_t byte = *iter++;
+		delta |= (uintptr_t)( byte & 0x7F ) << shift;
+		if( ( byte & 0x80 ) == 0 )
+		{
+			// a distance of 0 would patch the same pointer twice.
+			if( delta == 0 || *pos + delta < *pos )
+				return 0x0;
+			*pos += delta;
+			return iter;
+		}
+	}
+	return 0x0;
+}
+
 /**
  * Patch all pointers in an instance.
  *
@@ -35,12 +100,13 @@ struct dl_patched_ptrs
  * @param instance pointer to instance to patch.
  * @param base_address base address to patch the pointers against.
  * @param patch_distance distance in bytes to patch all pointers.
+ * @return DL_ERROR_OUT_OF_LIBRARY_MEMORY if the patched data could not be tracked, the instance is then not fully patched.
  */
-void dl_internal_patch_instance( dl_ctx_t            ctx,
-								 const dl_type_desc* type,
-								 uint8_t*            instance,
-								 uintptr_t           base_address,
-								 uintptr_t           patch_distance );
+dl_error_t dl_internal_patch_instance( dl_ctx_t            ctx,
+									   const dl_type_desc* type,
+									   uint8_t*            instance,
+									   uintptr_t           base_address,
+									   uintptr_t           patch_distance );
 
 /**
  * Patch all pointers in a member.
@@ -51,12 +117,13 @@ void dl_internal_patch_instance( dl_ctx_t            ctx,
  * @param base_address base address to patch the pointers against.
  * @param patch_distance distance in bytes to patch all pointers.
  * @param patched_ptrs keeps a record of all patched ptrs. Can be nullptr
+ * @return DL_ERROR_OUT_OF_LIBRARY_MEMORY if the patched data could not be tracked, the member is then not fully patched.
  */
-void dl_internal_patch_member( dl_ctx_t              ctx,
-							   const dl_member_desc* member,
-							   uint8_t*              member_data,
-							   uintptr_t             base_address,
-							   uintptr_t             patch_distance,
-							   dl_patched_ptrs*      patched_ptrs );
+dl_error_t dl_internal_patch_member( dl_ctx_t              ctx,
+									 const dl_member_desc* member,
+									 uint8_t*              member_data,
+									 uintptr_t             base_address,
+									 uintptr_t             patch_distance,
+									 dl_patched_ptrs*      patched_ptrs );
 
 #endif // DL_PATCH_PTR_H_INCLUDED
@@ -0,0 +1,179 @@
+#include "dl_types.h"
+
+typedef CArrayStatic<dl_plan_op, 64> dl_plan_op_list;
+
+static void dl_internal_plan_add_copy( dl_plan_op_list* copies, uint32_t offset, uint32_t size )
+{
+	if( size == 0 )
+		return;
+
+	// merge with previous copy if they are adjacent.
+	if( copies->Len() > 0 )
+	{
+		dl_plan_op& last = (*copies)[copies->Len() - 1];
+		if( last.offset + last.size == offset )
+		{
+			last.size += size;
+			return;
+		}
+	}
+
+	dl_plan_op op = { DL_PLAN_OP_COPY, 0, offset, 1, size, 1, UINT32_MAX };
+	copies->Add( op );
+}
+
+static void dl_internal_plan_add_fixup( dl_plan_op_list* fixups, dl_plan_op_kind kind, uint32_t offset, uint32_t count, const dl_type_desc* sub_type, dl_ctx_t ctx )
+{
+	dl_plan_op op = { (uint8_t)kind, 0, offset, count, 0, 1, UINT32_MAX };
+	if( sub_type != 0x0 )
+	{
+		op.sub_type = (uint32_t)( sub_type - ctx->type_descs );
+		op.size     = dl_internal_align_up( sub_type->size[DL_PTR_SIZE_HOST], sub_type->alignment[DL_PTR_SIZE_HOST] );
+		op.align    = sub_type->alignment[DL_PTR_SIZE_HOST];
+	}
+	fixups->Add( op );
+}
+
+/**
+ * Add ops for all members in type, placed at base_offset, to copies and fixups. Returns false if no plan can be built.
+ */
+static bool dl_internal_plan_add_members( dl_ctx_t ctx, const dl_type_desc* type, uint32_t base_offset, dl_plan_op_list* copies, dl_plan_op_list* fixups )
+{
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+		return false;
+
+	bool last_was_bitfield = false;
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_desc* member = dl_get_type_member( ctx, type, member_index );
+		dl_type_atom_t    atom_type    = member->AtomType();
+		dl_type_storage_t storage_type = member->StorageType();
+		uint32_t          offset       = base_offset + member->offset[DL_PTR_SIZE_HOST];
+
+		const dl_type_desc* sub_type = 0x0;
+		if( storage_type == DL_TYPE_STORAGE_STRUCT || storage_type == DL_TYPE_STORAGE_PTR )
+		{
+			sub_type = dl_internal_find_type( ctx, member->type_id );
+			if( sub_type == 0x0 )
+				return false; // type not loaded yet.
+		}
+
+		switch( atom_type )
+		{
+			case DL_TYPE_ATOM_POD:
+				switch( storage_type )
+				{
+					case DL_TYPE_STORAGE_STRUCT:
+						if( sub_type->flags & DL_TYPE_FLAG_IS_UNION )
+							dl_internal_plan_add_fixup( fixups, DL_PLAN_OP_STRUCT, offset, 1, sub_type, ctx );
+						else if( !dl_internal_plan_add_members( ctx, sub_type, offset, copies, fixups ) )
+							return false;
+						break;
+					case DL_TYPE_STORAGE_STR: dl_internal_plan_add_fixup( fixups, DL_PLAN_OP_STR, offset, 1, 0x0, ctx ); break;
+					case DL_TYPE_STORAGE_PTR: dl_internal_plan_add_fixup( fixups, DL_PLAN_OP_PTR, offset, 1, sub_type, ctx ); break;
+					default:
+						dl_internal_plan_add_copy( copies, offset, member->size[DL_PTR_SIZE_HOST] );
+						break;
+				}
+				break;
+
+			case DL_TYPE_ATOM_INLINE_ARRAY:
+				switch( storage_type )
+				{
+					case DL_TYPE_STORAGE_STRUCT:
+						if( sub_type->flags & ( DL_TYPE_FLAG_HAS_SUBDATA | DL_TYPE_FLAG_IS_UNION ) )
+							dl_internal_plan_add_fixup( fixups, DL_PLAN_OP_STRUCT, offset, member->inline_array_cnt(), sub_type, ctx );
+						else
+							dl_internal_plan_add_copy( copies, offset, member->inline_array_cnt() * sub_type->size[DL_PTR_SIZE_HOST] );
+						break;
+					case DL_TYPE_STORAGE_STR: dl_internal_plan_add_fixup( fixups, DL_PLAN_OP_STR, offset, member->inline_array_cnt(), 0x0, ctx ); break;
+					case DL_TYPE_STORAGE_PTR: dl_internal_plan_add_fixup( fixups, DL_PLAN_OP_PTR, offset, member->inline_array_cnt(), sub_type, ctx ); break;
+					default:
+						dl_internal_plan_add_copy( copies, offset, member->size[DL_PTR_SIZE_HOST] );
+						break;
+				}
+				break;
+
+			case DL_TYPE_ATOM_ARRAY:
+			{
+				dl_internal_plan_add_fixup( fixups, DL_PLAN_OP_ARRAY, offset, 1, sub_type, ctx );
+				dl_plan_op& op = (*fixups)[fixups->Len() - 1];
+				op.storage = (uint8_t)storage_type;
+				if( storage_type != DL_TYPE_STORAGE_STRUCT )
+				{
+					op.size  = (uint32_t)dl_pod_size( storage_type );
+					op.align = op.size;
+				}
+			}
+			break;
+
+			case DL_TYPE_ATOM_BITFIELD:
+				// all bitfield-members in a row share the same storage.
+				if( !last_was_bitfield )
+					dl_internal_plan_add_copy( copies, offset, member->size[DL_PTR_SIZE_HOST] );
+				break;
+
+			default:
+				return false;
+		}
+
+		last_was_bitfield = atom_type == DL_TYPE_ATOM_BITFIELD;
+	}
+	return true;
+}
+
+void dl_internal_build_plans( dl_ctx_t ctx )
+{
+	dl_free( &ctx->alloc, ctx->type_plans );
+	dl_free( &ctx->alloc, ctx->plan_ops );
+	ctx->type_plans      = 0x0;
+	ctx->plan_ops        = 0x0;
+	ctx->type_plan_count = 0;
+
+	if( ctx->type_count == 0 )
+		return;
+
+	dl_type_plan* plans = (dl_type_plan*)dl_alloc( &ctx->alloc, sizeof( dl_type_plan ) * ctx->type_count );
+	if( plans == 0x0 )
+		return; // ... all types will be handled member by member.
+
+	CArrayStatic<dl_plan_op, 256> ops( ctx->alloc );
+	dl_plan_op_list copies( ctx->alloc );
+	dl_plan_op_list fixups( ctx->alloc );
+	for( uint32_t i = 0; i < ctx->type_count; ++i )
+	{
+		copies.m_nElements = 0;
+		fixups.m_nElements = 0;
+
+		dl_type_plan& plan = plans[i];
+		if( !dl_internal_plan_add_members( ctx, ctx->type_descs + i, 0, &copies, &fixups ) )
+		{
+			plan.op_start   = UINT32_MAX;
+			plan.copy_count = 0;
+			plan.op_count   = 0;
+			continue;
+		}
+
+		plan.op_start   = (uint32_t)ops.Len();
+		plan.copy_count = (uint32_t)copies.Len();
+		plan.op_count   = (uint32_t)( copies.Len() + fixups.Len() );
+		for( size_t op = 0; op < copies.Len(); ++op )
+			ops.Add( copies[op] );
+		for( size_t op = 0; op < fixups.Len(); ++op )
+			ops.Add( fixups[op] );
+	}
+
+	if( ops.Len() > 0 )
+	{
+		ctx->plan_ops = (dl_plan_op*)dl_alloc( &ctx->alloc, sizeof( dl_plan_op ) * ops.Len() );
+		if( ctx->plan_ops == 0x0 )
+		{
+			dl_free( &ctx->alloc, plans );
+			return;
+		}
+		memcpy( ctx->plan_ops, ops.m_Ptr, sizeof( dl_plan_op ) * ops.Len() );
+	}
+
+	ctx->type_plans      = plans;
+	ctx->type_plan_count = ctx->type_count;
+}
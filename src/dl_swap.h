@@ -3,31 +3,42 @@
 #ifndef DL_DL_SWAP_H_INCLUDED
 #define DL_DL_SWAP_H_INCLUDED
 
+#include "dl_config.h"
+
+#include <string.h>
+
+#if !defined(DL_NO_SIMD)
+#  if defined(__AVX2__)
+#    define DL_SWAP_AVX2 1
+#    include <immintrin.h>
+#  elif defined(__SSSE3__)
+#    define DL_SWAP_SSSE3 1
+#    include <tmmintrin.h>
+#  elif defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#    define DL_SWAP_SSE2 1
+#    include <emmintrin.h>
+#  elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define DL_SWAP_NEON 1
+#    include <arm_neon.h>
+#  endif
+#endif
+
 static inline int8_t  dl_swap_endian_int8 ( int8_t  val ) { return val; }
 static inline int16_t dl_swap_endian_int16( int16_t val ) { return (int16_t)( ( ( val & 0x00FF ) << 8 )  | ( ( val & 0xFF00 ) >> 8 ) ); }
 static inline int32_t dl_swap_endian_int32( int32_t val ) { return ( ( val & 0x00FF ) << 24 ) | ( ( val & 0xFF00 ) << 8) | ( ( val >> 8 ) & 0xFF00 ) | ( ( val >> 24 ) & 0x00FF ); }
-static inline int64_t dl_swap_endian_int64( int64_t val )
-{
-	union { int32_t m_i32[2]; int64_t m_i64; } conv;
-	conv.m_i64 = val;
-	int32_t tmp   = dl_swap_endian_int32( conv.m_i32[0] );
-	conv.m_i32[0] = dl_swap_endian_int32( conv.m_i32[1] );
-	conv.m_i32[1] = tmp;
-	return conv.m_i64;
-}
 static inline uint8_t  dl_swap_endian_uint8 ( uint8_t  val ) { return val; }
 static inline uint16_t dl_swap_endian_uint16( uint16_t val ) { return (uint16_t)( ( ( val & 0x00FF ) << 8 )  | ( val & 0xFF00 ) >> 8 ); }
 static inline uint32_t dl_swap_endian_uint32( uint32_t val ) { return ( ( val & 0x00FF ) << 24 ) | ( ( val & 0xFF00 ) << 8) | ( ( val >> 8 ) & 0xFF00 ) | ( ( val >> 24 ) & 0x00FF ); }
 static inline uint64_t dl_swap_endian_uint64( uint64_t val )
 {
-	union { uint32_t m_u32[2]; uint64_t m_u64; } conv;
-	conv.m_u64 = val;
-	uint32_t tmp  = dl_swap_endian_uint32( conv.m_u32[0] );
-	conv.m_u32[0] = dl_swap_endian_uint32( conv.m_u32[1] );
-	conv.m_u32[1] = tmp;
-	return conv.m_u64;
+	// written as one expression on the full 64 bit value so that compilers can emit a single bswap.
+	val = ( val << 32 ) | ( val >> 32 );
+	val = ( ( val & 0x0000FFFF0000FFFFULL ) << 16 ) | ( ( val >> 16 ) & 0x0000FFFF0000FFFFULL );
+	return ( ( val & 0x00FF00FF00FF00FFULL ) << 8 ) | ( ( val >> 8 ) & 0x00FF00FF00FF00FFULL );
 }
 
+static inline int64_t dl_swap_endian_int64( int64_t val ) { return (int64_t)dl_swap_endian_uint64( (uint64_t)val ); }
+
 static inline float dl_swap_endian_fp32( float f )
 {
 	union { uint32_t m_u32; float m_fp32; } conv;
@@ -44,4 +55,111 @@ static inline double dl_swap_endian_fp64( double f )
 	return conv.m_fp64;
 }
 
+/**
+ * Swap endianness of count elements of elem_size bytes each from src and write them to dst.
+ * Neither src nor dst need to be aligned and dst may be the same as src or any address before it, the
+ * data is processed front to back and every block is read before it is written.
+ */
+static inline void dl_swap_endian_array_scalar( void* dst, const void* src, size_t count, size_t elem_size )
+{
+	uint8_t*       out = (uint8_t*)dst;
+	const uint8_t* in  = (const uint8_t*)src;
+	for( size_t i = 0; i < count; ++i, in += elem_size, out += elem_size )
+	{
+		switch( elem_size )
+		{
+			case 2: { uint16_t v; memcpy( &v, in, 2 ); v = dl_swap_endian_uint16( v ); memcpy( out, &v, 2 ); } break;
+			case 4: { uint32_t v; memcpy( &v, in, 4 ); v = dl_swap_endian_uint32( v ); memcpy( out, &v, 4 ); } break;
+			case 8: { uint64_t v; memcpy( &v, in, 8 ); v = dl_swap_endian_uint64( v ); memcpy( out, &v, 8 ); } break;
+			default: memmove( out, in, elem_size ); break;
+		}
+	}
+}
+
+#if defined(DL_SWAP_SSE2)
+// without pshufb bytes are swapped within 16 bit words by shifts and words are reordered by shuffles.
+static inline __m128i dl_swap_endian_sse2_16( __m128i v ) { return _mm_or_si128( _mm_slli_epi16( v, 8 ), _mm_srli_epi16( v, 8 ) ); }
+static inline __m128i dl_swap_endian_sse2_32( __m128i v )
+{
+	v = _mm_shufflelo_epi16( v, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+	v = _mm_shufflehi_epi16( v, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+	return dl_swap_endian_sse2_16( v );
+}
+static inline __m128i dl_swap_endian_sse2_64( __m128i v )
+{
+	v = _mm_shufflelo_epi16( v, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+	v = _mm_shufflehi_epi16( v, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+	return dl_swap_endian_sse2_16( v );
+}
+#endif
+
+/**
+ * Bulk version of dl_swap_endian_*(), used when converting large arrays of pods.
+ * Same aliasing rules as dl_swap_endian_array_scalar().
+ */
+static inline void dl_swap_endian_array( void* dst, const void* src, size_t count, size_t elem_size )
+{
+	uint8_t*       out   = (uint8_t*)dst;
+	const uint8_t* in    = (const uint8_t*)src;
+	size_t         bytes = count * elem_size;
+	size_t         done  = 0;
+
+	if( elem_size != 2 && elem_size != 4 && elem_size != 8 )
+	{
+		dl_swap_endian_array_scalar( dst, src, count, elem_size );
+		return;
+	}
+
+#if defined(DL_SWAP_AVX2) || defined(DL_SWAP_SSSE3)
+	// ... shuffle-mask reversing each element, same pattern for both 128 bit lanes ...
+	static const int8_t masks[3][16] = {
+		{ 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 },
+		{ 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 },
+		{ 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 }
+	};
+	const int8_t* mask_data = masks[ elem_size == 2 ? 0 : ( elem_size == 4 ? 1 : 2 ) ];
+	__m128i mask128 = _mm_loadu_si128( (const __m128i*)mask_data );
+#  if defined(DL_SWAP_AVX2)
+	__m256i mask256 = _mm256_broadcastsi128_si256( mask128 );
+	for( ; done + 32 <= bytes; done += 32 )
+	{
+		__m256i v = _mm256_loadu_si256( (const __m256i*)( in + done ) );
+		_mm256_storeu_si256( (__m256i*)( out + done ), _mm256_shuffle_epi8( v, mask256 ) );
+	}
+#  endif
+	for( ; done + 16 <= bytes; done += 16 )
+	{
+		__m128i v = _mm_loadu_si128( (const __m128i*)( in + done ) );
+		_mm_storeu_si128( (__m128i*)( out + done ), _mm_shuffle_epi8( v, mask128 ) );
+	}
+#elif defined(DL_SWAP_SSE2)
+	for( ; done + 16 <= bytes; done += 16 )
+	{
+		__m128i v = _mm_loadu_si128( (const __m128i*)( in + done ) );
+		switch( elem_size )
+		{
+			case 2:  v = dl_swap_endian_sse2_16( v ); break;
+			case 4:  v = dl_swap_endian_sse2_32( v ); break;
+			default: v = dl_swap_endian_sse2_64( v ); break;
+		}
+		_mm_storeu_si128( (__m128i*)( out + done ), v );
+	}
+#elif defined(DL_SWAP_NEON)
+	for( ; done + 16 <= bytes; done += 16 )
+	{
+		uint8x16_t v = vld1q_u8( in + done );
+		switch( elem_size )
+		{
+			case 2:  v = vrev16q_u8( v ); break;
+			case 4:  v = vrev32q_u8( v ); break;
+			default: v = vrev64q_u8( v ); break;
+		}
+		vst1q_u8( out + done, v );
+	}
+#endif
+
+	// ... and the tail that did not fill a full vector ...
+	dl_swap_endian_array_scalar( out + done, in + done, ( bytes - done ) / elem_size, elem_size );
+}
+
 #endif // DL_DL_SWAP_H_INCLUDED
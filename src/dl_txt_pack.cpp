@@ -5,6 +5,7 @@
 #include "dl_binary_writer.h"
 #include "dl_patch_ptr.h"
 #include "dl_txt_read.h"
+#include "dl_txt_number.h"
 
 #include <stdlib.h>
 #include <algorithm>
@@ -25,7 +26,16 @@
 
 inline double dl_strtod(const char* str, char** endptr)
 {
-	double res = strtod(str, endptr);
+	// ... plain decimal numbers are parsed without strtod(), that is both slow and locale dependent ...
+	double res;
+	const char* end;
+	if( dl_txt_parse_fp64( str, &end, &res ) )
+	{
+		*endptr = (char*)end;
+		return res;
+	}
+
+	res = strtod(str, endptr);
 	if(str == *endptr)
 	{
 		float sign = 1.0f;
@@ -79,7 +89,15 @@ inline double dl_strtod(const char* str, char** endptr)
 
 inline float dl_strtof(const char* str, char** endptr)
 {
-	float res = strtof(str, endptr);
+	float res;
+	const char* end;
+	if( dl_txt_parse_fp32( str, &end, &res ) )
+	{
+		*endptr = (char*)end;
+		return res;
+	}
+
+	res = strtof(str, endptr);
 	if(str == *endptr)
 	{
 		float sign = 1.0f;
@@ -141,12 +159,30 @@ struct dl_txt_pack_ctx
 	explicit dl_txt_pack_ctx(dl_allocator alloc)
 	    : subdata(alloc)
 	    , ptrs(alloc)
+	    , array_elems(alloc)
+	    , array_align(1)
+	    , scratch(0x0)
+	    , scratch_size(0)
+	    , scratch_alloc(alloc)
+	    , names(0x0)
+	    , names_left(0)
 	{
 	}
 
-	dl_txt_read_ctx read_ctx;
+	~dl_txt_pack_ctx()
+	{
+		if( scratch )
+			dl_free( &scratch_alloc, scratch );
+		while( names )
+		{
+			NameBlock* prev = names->prev;
+			dl_free( &scratch_alloc, names );
+			names = prev;
+		}
+	}
+
+	dl_txt_read_ctx read_ctx; ///< read_ctx.pin is set to the start of "__subdata" when that is found.
 	dl_binary_writer* writer;
-	const char* subdata_pos;
 	struct SSubData
 	{
 		dl_substr name;
@@ -156,8 +192,67 @@ struct dl_txt_pack_ctx
 	}; 
 	CArrayStatic<SSubData, 256> subdata;
 	dl_patched_ptrs ptrs;
+
+	/**
+	 * Arrays with elements that write subdata are packed with each element directly followed by its subdata, and
+	 * relocated into one element-block followed by all subdata when the array is closed. array_elems is a stack of
+	 * where each element of all currently open such arrays was written, the max alignment of arrays in its subdata
+	 * and how far its subdata was moved.
+	 */
+	struct SArrayElem
+	{
+		size_t pos;
+		size_t align;
+		size_t shift;
+	};
+	CArrayStatic<SArrayElem, 64> array_elems;
+	size_t array_align; ///< max alignment of all arrays packed since the innermost open array was started.
+
+	uint8_t*     scratch;
+	size_t       scratch_size;
+	dl_allocator scratch_alloc;
+
+	/**
+	 * When streaming, names of subdata that need to outlive the text in the read buffer are copied to blocks
+	 * allocated with scratch_alloc.
+	 */
+	struct NameBlock
+	{
+		NameBlock* prev;
+		size_t     size;
+	};
+	NameBlock* names;
+	size_t     names_left;
 };
 
+/**
+ * Return name or, if the text is streamed and name will be overwritten on the next refill, a copy of name.
+ */
+static dl_substr dl_txt_pack_store_name( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, dl_substr name )
+{
+	if( packctx->read_ctx.stream == 0x0 )
+		return name;
+
+	size_t len = (size_t)name.len;
+	if( packctx->names_left < len )
+	{
+		size_t block_size = len > 4096 ? len : 4096;
+		dl_txt_pack_ctx::NameBlock* block = (dl_txt_pack_ctx::NameBlock*)dl_alloc( &packctx->scratch_alloc, sizeof(dl_txt_pack_ctx::NameBlock) + block_size );
+		if( block == 0x0 )
+			dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_OUT_OF_LIBRARY_MEMORY, "out of memory storing a name" );
+		block->prev = packctx->names;
+		block->size = block_size;
+		packctx->names = block;
+		packctx->names_left = block_size;
+	}
+
+	char* copy = (char*)( packctx->names + 1 ) + packctx->names->size - packctx->names_left;
+	memcpy( copy, name.str, len );
+	packctx->names_left -= len;
+	name.str = copy;
+	return name;
+}
+
 static void dl_txt_pack_eat_and_write_int8( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx )
 {
 	long long v = dl_txt_pack_eat_strtoll(dl_ctx, &packctx->read_ctx, INT8_MIN, INT8_MAX, "int8");
@@ -280,8 +375,7 @@ static void dl_txt_pack_eat_and_write_string( dl_ctx_t dl_ctx, dl_txt_pack_ctx*
 	}
 	dl_binary_writer_write_uint8( packctx->writer, '\0' );
 	dl_binary_writer_seek_set( packctx->writer, curr );
-	if( !packctx->writer->dummy )
-		packctx->ptrs.add( dl_binary_writer_tell( packctx->writer ) );
+	packctx->ptrs.add( dl_binary_writer_tell( packctx->writer ) );
 	dl_binary_writer_write( packctx->writer, &strpos, sizeof(size_t) );
 }
 
@@ -321,10 +415,9 @@ static void dl_txt_pack_eat_and_write_ptr( dl_ctx_t dl_ctx, dl_txt_pack_ctx* pac
 	if( ptr.str == 0x0 )
 		dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TXT_INVALID_MEMBER_TYPE, "expected string" );
 
-	if( !packctx->writer->dummy )
-		packctx->ptrs.add( patch_pos );
+	packctx->ptrs.add( patch_pos );
 
-	packctx->subdata.Add({ ptr, dl_internal_hash_buffer(ptr), type, patch_pos });
+	packctx->subdata.Add({ dl_txt_pack_store_name( dl_ctx, packctx, ptr ), dl_internal_hash_buffer(ptr), type, patch_pos });
 }
 
 static void dl_txt_pack_validate_c_symbol_key( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, dl_substr symbol )
@@ -338,146 +431,92 @@ static void dl_txt_pack_validate_c_symbol_key( dl_ctx_t dl_ctx, dl_txt_pack_ctx*
 
 static dl_error_t dl_txt_pack_eat_and_write_struct( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, const dl_type_desc* type );
 
-static dl_error_t dl_txt_pack_eat_and_write_array( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, const dl_member_desc* member, uint32_t array_length )
+/**
+ * Eat the separator after an array element, return true if there are more elements to read.
+ * Trailing ',' is allowed.
+ */
+static bool dl_txt_pack_array_next( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, uint32_t elements_read, uint32_t max_elements )
 {
+	dl_txt_eat_white( &packctx->read_ctx );
+	if( *packctx->read_ctx.iter == ']' )
+		return false;
+
+	dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
+	dl_txt_eat_white( &packctx->read_ctx );
+	if( *packctx->read_ctx.iter == ']' )
+		return false;
+
+	if( elements_read == max_elements )
+		dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_MALFORMED_DATA, "to many elements in inline array, max %u", max_elements );
+	return true;
+}
+
+/**
+ * Pack array elements in order starting at array_pos until the closing ']', at least one element is expected.
+ * Any subdata written by the elements will end up after the element-block so this is only valid for arrays where
+ * the space of the elements is already reserved, i.e. inline arrays, or where no element writes subdata.
+ */
+static dl_error_t dl_txt_pack_eat_and_write_array( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, const dl_member_desc* member, size_t array_pos, uint32_t max_length, uint32_t* out_length )
+{
+	uint32_t array_length = 0;
+	dl_binary_writer_seek_set( packctx->writer, array_pos );
 	switch( member->StorageType() )
 	{
 		case DL_TYPE_STORAGE_INT8:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_int8( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_int8( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_int8( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_INT16:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_int16( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_int16( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_int16( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_INT32:
-		{
-			for( uint32_t i = 0; i < array_length -1; ++i )
-			{
-				dl_txt_pack_eat_and_write_int32( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_int32( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_int32( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_INT64:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_int64( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_int64( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_int64( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_UINT8:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_uint8( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_uint8( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_uint8( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_UINT16:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_uint16( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_uint16( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_uint16( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_UINT32:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_uint32( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_uint32( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_uint32( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_UINT64:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_uint64( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_uint64( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_uint64( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_FP32:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_fp32( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_fp32( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_fp32( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_FP64:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_fp64( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_fp64( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_fp64( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_STR:
-		{
-			for( uint32_t i = 0; i < array_length - 1; ++i )
-			{
-				dl_txt_pack_eat_and_write_string( dl_ctx, packctx );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_string( dl_ctx, packctx );
-		}
-		break;
+			do { dl_txt_pack_eat_and_write_string( dl_ctx, packctx ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
+			break;
 		case DL_TYPE_STORAGE_PTR:
 		{
 			const dl_type_desc* type = dl_internal_find_type( dl_ctx, member->type_id );
-			size_t array_pos = dl_binary_writer_tell( packctx->writer );
-			for( uint32_t i = 0; i < array_length - 1; ++i )
+			do
 			{
-				dl_txt_pack_eat_and_write_ptr( dl_ctx, packctx, type, array_pos + i * sizeof(void*) );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_ptr( dl_ctx, packctx, type, array_pos + ( array_length - 1 ) * sizeof(void*) );
+				// ... non-null ptrs are not written until the subdata is finalized, so position each element explicitly ...
+				size_t elem_pos = array_pos + array_length * sizeof(void*);
+				dl_binary_writer_seek_set( packctx->writer, elem_pos );
+				dl_binary_writer_reserve( packctx->writer, sizeof(void*) );
+				dl_txt_pack_eat_and_write_ptr( dl_ctx, packctx, type, elem_pos );
+			} while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
 		}
 		break;
 		case DL_TYPE_STORAGE_STRUCT:
 		{
 			const dl_type_desc* type = dl_internal_find_type( dl_ctx, member->type_id );
-			size_t array_pos = dl_binary_writer_tell( packctx->writer ); // TODO: this seek/set dance will only be needed if type has subptrs, optimize by making different code-paths?
-			for( uint32_t i = 0; i < array_length -1; ++i )
+			do
 			{
-				dl_binary_writer_seek_set( packctx->writer, array_pos + i * type->size[DL_PTR_SIZE_HOST] );
+				dl_binary_writer_seek_set( packctx->writer, array_pos + array_length * type->size[DL_PTR_SIZE_HOST] );
 				dl_error_t err = dl_txt_pack_eat_and_write_struct( dl_ctx, packctx, type );
 				if( DL_ERROR_OK != err ) return err;
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_binary_writer_seek_set( packctx->writer, array_pos + (array_length - 1) * type->size[DL_PTR_SIZE_HOST] );
-			dl_error_t err = dl_txt_pack_eat_and_write_struct( dl_ctx, packctx, type );
-			if( DL_ERROR_OK != err ) return err;
+			} while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
 		}
 		break;
 		case DL_TYPE_STORAGE_ENUM_INT8:
@@ -493,12 +532,7 @@ static dl_error_t dl_txt_pack_eat_and_write_array( dl_ctx_t dl_ctx, dl_txt_pack_
 			if( edesc == 0x0 )
 				dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TYPE_NOT_FOUND, "couldn't find enum-type of <type_name_here>.%s", dl_internal_member_name( dl_ctx, member ) );
 
-			for( uint32_t i = 0; i < array_length -1; ++i )
-			{
-				dl_txt_pack_eat_and_write_enum( dl_ctx, packctx, edesc );
-				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
-			}
-			dl_txt_pack_eat_and_write_enum( dl_ctx, packctx, edesc );
+			do { dl_txt_pack_eat_and_write_enum( dl_ctx, packctx, edesc ); } while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, max_length ) );
 		}
 		break;
 		default:
@@ -506,14 +540,181 @@ static dl_error_t dl_txt_pack_eat_and_write_array( dl_ctx_t dl_ctx, dl_txt_pack_
 			break;
 	}
 
-    // handle trailing ,
-    dl_txt_eat_white( &packctx->read_ctx );
-    if(*packctx->read_ctx.iter == ',')
-        ++packctx->read_ctx.iter;
-    dl_txt_eat_white( &packctx->read_ctx );
+	*out_length = array_length;
+	return DL_ERROR_OK;
+}
+
+static size_t dl_txt_pack_relocated_pos( const dl_txt_pack_ctx::SArrayElem* elems, size_t elem_count, size_t array_pos, size_t elem_size, size_t pos )
+{
+	// ... find the last element written at or before pos ...
+	size_t lo = 0;
+	size_t hi = elem_count;
+	while( hi - lo > 1 )
+	{
+		size_t mid = lo + ( hi - lo ) / 2;
+		if( elems[mid].pos <= pos )
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	size_t offset = pos - elems[lo].pos;
+	if( offset < elem_size )
+		return array_pos + lo * elem_size + offset;
+	return pos + elems[lo].shift;
+}
+
+/**
+ * Move the elements written from elems_start in packctx->array_elems into one block at array_pos and the subdata
+ * written by each element after that block. The subdata is only moved towards the end of the buffer and the
+ * subdata of each element keeps its position modulo its alignment, so the relocated array never is bigger than the
+ * buffer needed for the final instance and all alignment within the subdata is kept.
+ */
+static void dl_txt_pack_relocate_array( dl_txt_pack_ctx* packctx,
+										size_t           array_pos,
+										size_t           elem_size,
+										size_t           elems_start,
+										size_t           ptrs_start,
+										size_t           subdata_start )
+{
+	dl_binary_writer* writer = packctx->writer;
+	dl_txt_pack_ctx::SArrayElem* elems = packctx->array_elems.m_Ptr + elems_start;
+	size_t elem_count = packctx->array_elems.Len() - elems_start;
+
+	size_t packed_end = dl_binary_writer_needed_size( writer );
+	size_t block_end  = array_pos + elem_count * elem_size;
+	if( packed_end == block_end )
+		return; // no subdata was written, elements are already in place.
+
+	size_t end = block_end;
+	for( size_t i = 0; i < elem_count; ++i )
+	{
+		// ... subdata written as default-values are not aligned by the writer, keep at least 8 byte alignment for them ...
+		size_t align     = elems[i].align < 8 ? 8 : elems[i].align;
+		size_t sub_start = elems[i].pos + elem_size;
+		size_t sub_end   = i + 1 < elem_count ? elems[i + 1].pos : packed_end;
+		size_t dst       = end + ( ( sub_start - end ) & ( align - 1 ) );
+		elems[i].shift   = dst - sub_start;
+		end              = dst + ( sub_end - sub_start );
+	}
+
+	bool move_data = !writer->dummy && dl_binary_writer_fits( writer, end );
+	if( move_data )
+	{
+		size_t block_size = elem_count * elem_size;
+		if( packctx->scratch_size < block_size )
+		{
+			packctx->scratch = (uint8_t*)dl_realloc( &packctx->scratch_alloc, packctx->scratch, block_size, packctx->scratch_size );
+			packctx->scratch_size = block_size;
+		}
+
+		uint8_t* data = writer->data;
+		for( size_t i = 0; i < elem_count; ++i )
+			memcpy( packctx->scratch + i * elem_size, data + elems[i].pos, elem_size );
+
+		for( size_t i = elem_count; i > 0; --i )
+		{
+			size_t sub_start = elems[i - 1].pos + elem_size;
+			size_t sub_end   = i < elem_count ? elems[i].pos : packed_end;
+			memmove( data + sub_start + elems[i - 1].shift, data + sub_start, sub_end - sub_start );
+		}
+
+		size_t gap_start = block_end;
+		for( size_t i = 0; i < elem_count; ++i )
+		{
+			size_t sub_start = elems[i].pos + elem_size;
+			size_t sub_end   = i + 1 < elem_count ? elems[i + 1].pos : packed_end;
+			memset( data + gap_start, 0x0, sub_start + elems[i].shift - gap_start );
+			gap_start = sub_end + elems[i].shift;
+		}
+
+		memcpy( data + array_pos, packctx->scratch, block_size );
+	}
+
+	// ... patch all positions and offsets recorded while packing the array ...
+	uintptr_t* ptrs = packctx->ptrs.addresses.m_Ptr;
+	for( size_t i = ptrs_start; i < packctx->ptrs.addresses.Len(); ++i )
+	{
+		ptrs[i] = dl_txt_pack_relocated_pos( elems, elem_count, array_pos, elem_size, ptrs[i] );
+		if( !move_data )
+			continue;
+
+		uintptr_t offset;
+		memcpy( &offset, writer->data + ptrs[i], sizeof(uintptr_t) );
+		if( offset >= array_pos && offset < packed_end )
+		{
+			offset = dl_txt_pack_relocated_pos( elems, elem_count, array_pos, elem_size, offset );
+			memcpy( writer->data + ptrs[i], &offset, sizeof(uintptr_t) );
+		}
+	}
+
+	for( size_t i = subdata_start; i < packctx->subdata.Len(); ++i )
+		packctx->subdata[i].patch_pos = dl_txt_pack_relocated_pos( elems, elem_count, array_pos, elem_size, packctx->subdata[i].patch_pos );
+
+	dl_binary_writer_seek_end( writer );
+	dl_binary_writer_reserve( writer, end - packed_end );
+}
+
+/**
+ * Pack an array where the elements write subdata, strings or structs with subdata, in one pass.
+ * Each element is written at the end of the buffer directly followed by its subdata, when the array is closed
+ * the elements are moved into one block by dl_txt_pack_relocate_array().
+ */
+static dl_error_t dl_txt_pack_eat_and_write_array_subdata( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, const dl_member_desc* member, size_t array_pos, size_t elem_size, uint32_t* out_length )
+{
+	const dl_type_desc* type = member->StorageType() == DL_TYPE_STORAGE_STRUCT ? dl_internal_find_type( dl_ctx, member->type_id ) : 0x0;
+
+	size_t elems_start   = packctx->array_elems.Len();
+	size_t ptrs_start    = packctx->ptrs.addresses.Len();
+	size_t subdata_start = packctx->subdata.Len();
+	size_t parent_align  = packctx->array_align;
+	size_t max_align     = 1;
+
+	uint32_t array_length = 0;
+	do
+	{
+		dl_binary_writer_seek_end( packctx->writer );
+		size_t elem_index = packctx->array_elems.Len();
+		packctx->array_elems.Add( { dl_binary_writer_tell( packctx->writer ), 1, 0 } );
+		packctx->array_align = 1;
+
+		if( type )
+		{
+			dl_error_t err = dl_txt_pack_eat_and_write_struct( dl_ctx, packctx, type );
+			if( DL_ERROR_OK != err ) return err;
+		}
+		else
+		{
+			dl_binary_writer_reserve( packctx->writer, elem_size );
+			dl_txt_pack_eat_and_write_string( dl_ctx, packctx );
+		}
+
+		packctx->array_elems[elem_index].align = packctx->array_align;
+		if( packctx->array_align > max_align )
+			max_align = packctx->array_align;
+	} while( dl_txt_pack_array_next( dl_ctx, packctx, ++array_length, UINT32_MAX ) );
+
+	dl_txt_pack_relocate_array( packctx, array_pos, elem_size, elems_start, ptrs_start, subdata_start );
+
+	packctx->array_elems.m_nElements = elems_start;
+	packctx->array_align = parent_align > max_align ? parent_align : max_align;
+	*out_length = array_length;
 	return DL_ERROR_OK;
 }
 
+static bool dl_txt_pack_array_has_subdata( dl_ctx_t dl_ctx, const dl_member_desc* member )
+{
+	switch( member->StorageType() )
+	{
+		case DL_TYPE_STORAGE_STR:
+			return true;
+		case DL_TYPE_STORAGE_STRUCT:
+			return ( dl_internal_find_type( dl_ctx, member->type_id )->flags & DL_TYPE_FLAG_HAS_SUBDATA ) != 0;
+		default:
+			return false;
+	}
+}
+
 static void dl_txt_pack_array_item_size_align( dl_ctx_t dl_ctx,
 											   const dl_member_desc* member,
 											   size_t* size,
@@ -536,30 +737,6 @@ static void dl_txt_pack_array_item_size_align( dl_ctx_t dl_ctx,
 	}
 }
 
-const char* dl_txt_skip_array( const char* iter, const char* end )
-{
-	iter = dl_txt_skip_white( iter, end );
-	if( *iter != '[' )
-		return "\0";
-	++iter;
-
-	int depth = 1;
-	while( iter != end && depth > 0 )
-	{
-		iter = dl_txt_skip_white( iter, end );
-		switch(*iter)
-		{
-			case 0x0: return "\0";
-			case '[': ++depth; break;
-			case ']': --depth; break;
-			default: break;
-		}
-		++iter;
-	}
-
-	return iter;
-}
-
 const char* dl_txt_skip_map( const char* iter, const char* end )
 {
 	iter = dl_txt_skip_white( iter, end );
@@ -568,14 +745,23 @@ const char* dl_txt_skip_map( const char* iter, const char* end )
 	++iter;
 
 	int depth = 1;
-	while( iter != end && depth > 0 )
+	while( depth > 0 )
 	{
-		iter = dl_txt_skip_white( iter, end );
+		// ... only braces, comments and the terminator affect the depth, jump straight to the next one of them ...
+		iter = dl_txt_find_first_of( iter, end, '{', '}', '/', '\0' );
+		if( iter == end )
+			return "\0";
+
 		switch(*iter)
 		{
 			case 0x0: return "\0";
 			case '{': ++depth; break;
 			case '}': --depth; break;
+			case '/':
+				iter = dl_txt_skip_white( iter, end );
+				if( *iter == 0x0 )
+					return "\0";
+				continue;
 			default: break;
 		}
 		++iter;
@@ -586,139 +772,73 @@ const char* dl_txt_skip_map( const char* iter, const char* end )
 
 const char* dl_txt_skip_string( const char* str, const char* end )
 {
-	while( str != end && *str != '\"' )
+	while( true )
 	{
-		if( *str == '\\' )
-		{
-			++str;
-			if( str == end )
-				return 0x0;
-			++str;
-			if( str == end )
-				return 0x0;
-
-			if( *str == '\"' )
-				++str;
-		}
-		++str;
+		str = dl_txt_find_first_of( str, end, '\"', '\\', '\"', '\\' );
+		if( str == end || *str == '\"' )
+			return str;
+
+		// ... skip escaped char ...
+		if( end - str < 2 )
+			return 0x0;
+		str += 2;
 	}
-	return str;
 }
 
-static uint32_t dl_txt_pack_find_array_length( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, const dl_member_desc* member )
+/**
+ * dl_txt_skip_map() for streamed text, sets readctx->pin to the start of the map so that it is kept in the buffer
+ * and can be packed by dl_txt_pack_finalize_subdata().
+ */
+static void dl_txt_pack_stream_skip_map( dl_txt_read_ctx* readctx )
 {
-	const char* iter = packctx->read_ctx.iter;
-	const char* end  = packctx->read_ctx.end;
-
-	iter = dl_txt_skip_white( iter, end );
-	if( *iter == ']' )
-		return 0;
+	dl_txt_eat_white( readctx );
+	if( *readctx->iter != '{' )
+	{
+		readctx->iter = "\0";
+		return;
+	}
+	readctx->pin = readctx->iter;
 
-	switch( member->StorageType() )
+	// ... positions are stored relative to pin as that is moved on refill ...
+	size_t pos = 1;
+	int depth = 1;
+	while( depth > 0 )
 	{
-		case DL_TYPE_STORAGE_INT8: // TODO: for pods there are no need to check array length!
-		case DL_TYPE_STORAGE_INT16:
-		case DL_TYPE_STORAGE_INT32:
-		case DL_TYPE_STORAGE_INT64:
-		case DL_TYPE_STORAGE_UINT8:
-		case DL_TYPE_STORAGE_UINT16:
-		case DL_TYPE_STORAGE_UINT32:
-		case DL_TYPE_STORAGE_UINT64:
-		case DL_TYPE_STORAGE_FP32:
-		case DL_TYPE_STORAGE_FP64:
-		case DL_TYPE_STORAGE_PTR:
-		case DL_TYPE_STORAGE_ENUM_INT8:
-		case DL_TYPE_STORAGE_ENUM_INT16:
-		case DL_TYPE_STORAGE_ENUM_INT32:
-		case DL_TYPE_STORAGE_ENUM_INT64:
-		case DL_TYPE_STORAGE_ENUM_UINT8:
-		case DL_TYPE_STORAGE_ENUM_UINT16:
-		case DL_TYPE_STORAGE_ENUM_UINT32:
-		case DL_TYPE_STORAGE_ENUM_UINT64:
-		 // TODO: bug, but in typelib build, there can't be any , in an enum-string.
+		const char* iter = dl_txt_find_first_of( readctx->pin + pos, readctx->end, '{', '}', '/', '\0' );
+		pos = (size_t)( iter - readctx->pin );
+		if( iter == readctx->end )
 		{
-            bool last_was_comma = false;
-			uint32_t array_length = 1;
-			while(true)
-			{
-				iter = dl_txt_skip_white( iter, end );
-				switch( *iter )
-				{
-					case ',':
-						++array_length;
-						break;
-					case '\0':
-					case ']':
-						return last_was_comma ? array_length - 1 : array_length;
-                    // TODO: I guess one can fool this parser by adding a ] or , in a comment at "the right place(tm)"
-				}
-                last_was_comma = *iter == ',';
-				++iter;
-			}
-		}
-		break;
-		case DL_TYPE_STORAGE_STR:
-		{
-            bool last_was_comma = false;
-			uint32_t array_length = 1;
-			while(true)
-			{
-				iter = dl_txt_skip_white( iter, end );
-				switch( *iter )
-				{
-					case ',':
-						++array_length;
-						break;
-					case '"':
-						iter = dl_txt_skip_string( ++iter, end );
-						break;
-					case '\0':
-					case ']':
-						return last_was_comma ? array_length - 1 : array_length;
-                    // TODO: I guess one can fool this parser by adding a ] or , in a comment at "the right place(tm)"
-				}
-                last_was_comma = *iter == ',';
-				++iter;
-			}
+			if( !dl_txt_read_more( readctx, readctx->pin ) )
+				break;
+			continue;
 		}
-		break;
-		case DL_TYPE_STORAGE_STRUCT:
+
+		switch(*iter)
 		{
-			bool last_was_comma = false;
-			uint32_t array_length = 1;
-			while(true)
+			case 0x0:
+				readctx->iter = "\0";
+				return;
+			case '{': ++depth; break;
+			case '}': --depth; break;
+			case '/':
 			{
-				iter = dl_txt_skip_white(iter, end);
-				switch( *iter )
+				const char* next = dl_txt_skip_white( iter, readctx->end );
+				if( *next == 0x0 )
 				{
-					case ',':
-						++array_length;
-						++iter;
-						last_was_comma = true;
+					// ... comment cut by the end of the buffer, read more and skip it again ...
+					if( !dl_txt_read_more( readctx, readctx->pin ) )
 						break;
-					case '{':
-						last_was_comma = false;
-						iter = dl_txt_skip_map(iter, end);
-						break;
-					case '[':
-						last_was_comma = false;
-						iter = dl_txt_skip_array(iter, end);
-						break;
-					case '\0':
-					case ']':
-						return last_was_comma ? array_length - 1 : array_length;
-					default:
-						dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TXT_PARSE_ERROR,
-									"Invalid txt-format, are you missing an '}' or an ']'?");
-					// TODO: I guess one can fool this parser by adding a ] or , in a comment at "the right place(tm)"
+					continue;
 				}
+				pos = (size_t)( next - readctx->pin );
+				continue;
 			}
+			default: break;
 		}
-		break;
-		default:
-			DL_ASSERT(false);
+		++pos;
 	}
-	return (uint32_t)-1;
+
+	readctx->iter = depth > 0 ? "\0" : readctx->pin + pos;
 }
 
 static void dl_txt_pack_write_default_value( dl_ctx_t              dl_ctx,
@@ -795,7 +915,30 @@ static void dl_txt_pack_write_default_value( dl_ctx_t              dl_ctx,
 
 		uint8_t* member_data = packctx->writer->data + member_pos;
 		if( !packctx->writer->dummy )
-			dl_internal_patch_member( dl_ctx, member, member_data, (uintptr_t)packctx->writer->data, subdata_pos - member_size - sizeof( dl_data_header ), &packctx->ptrs );
+		{
+			if( dl_internal_patch_member( dl_ctx, member, member_data, (uintptr_t)packctx->writer->data, subdata_pos - member_size - sizeof( dl_data_header ), &packctx->ptrs ) != DL_ERROR_OK )
+				dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_OUT_OF_LIBRARY_MEMORY, "out of memory patching default value" );
+		}
+		else
+		{
+			// ... nothing is written when only calculating size, find the ptrs for the patch-table in a copy of the default-value ...
+			if( packctx->scratch_size < member->default_value_size )
+			{
+				packctx->scratch = (uint8_t*)dl_realloc( &packctx->scratch_alloc, packctx->scratch, member->default_value_size, packctx->scratch_size );
+				packctx->scratch_size = member->default_value_size;
+			}
+			memcpy( packctx->scratch, member_default_value, member->default_value_size );
+
+			size_t ptrs_start = packctx->ptrs.addresses.Len();
+			if( dl_internal_patch_member( dl_ctx, member, packctx->scratch, (uintptr_t)packctx->scratch - member_pos, member_pos - sizeof( dl_data_header ), &packctx->ptrs ) != DL_ERROR_OK )
+				dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_OUT_OF_LIBRARY_MEMORY, "out of memory patching default value" );
+
+			// ... the copy has the subdata directly after the member, move those ptrs to where the subdata is written ...
+			uintptr_t* ptrs = packctx->ptrs.addresses.m_Ptr;
+			for( size_t i = ptrs_start; i < packctx->ptrs.addresses.Len(); ++i )
+				if( ptrs[i] >= member_pos + member_size )
+					ptrs[i] += subdata_pos - member_pos - member_size;
+		}
 	}
 }
 
@@ -847,8 +990,8 @@ static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx,
 		case DL_TYPE_ATOM_ARRAY:
 		{
 			dl_txt_eat_char( dl_ctx, &packctx->read_ctx, '[' );
-			uint32_t array_length = dl_txt_pack_find_array_length( dl_ctx, packctx, member );
-			if( array_length == 0 )
+			dl_txt_eat_white( &packctx->read_ctx );
+			if( *packctx->read_ctx.iter == ']' )
 			{
 				dl_binary_writer_write_pint( packctx->writer, (size_t)0 );
 				dl_binary_writer_write_uint32( packctx->writer, 0 );
@@ -857,19 +1000,26 @@ static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx,
 			{
 				size_t element_size, element_align;
 				dl_txt_pack_array_item_size_align( dl_ctx, member, &element_size, &element_align );
-				size_t array_pos = dl_binary_writer_needed_size( packctx->writer );
-				array_pos = dl_internal_align_up( array_pos, element_align );
+				dl_binary_writer_seek_end( packctx->writer );
+				dl_binary_writer_align( packctx->writer, element_align );
+				size_t array_pos = dl_binary_writer_tell( packctx->writer );
+
+				packctx->ptrs.add( member_pos );
+
+				uint32_t array_length;
+				dl_error_t err;
+				if( dl_txt_pack_array_has_subdata( dl_ctx, member ) )
+					err = dl_txt_pack_eat_and_write_array_subdata( dl_ctx, packctx, member, array_pos, element_size, &array_length );
+				else
+					err = dl_txt_pack_eat_and_write_array( dl_ctx, packctx, member, array_pos, UINT32_MAX, &array_length );
+				if( DL_ERROR_OK != err ) return err;
 
-	            if( !packctx->writer->dummy )
-				    packctx->ptrs.add( dl_binary_writer_tell( packctx->writer ) );
+				if( element_align > packctx->array_align )
+					packctx->array_align = element_align;
 
+				dl_binary_writer_seek_set( packctx->writer, member_pos );
 				dl_binary_writer_write_pint( packctx->writer, array_pos );
 				dl_binary_writer_write_uint32( packctx->writer, array_length );
-				dl_binary_writer_seek_end( packctx->writer );
-				dl_binary_writer_align( packctx->writer, element_align );
-				dl_binary_writer_reserve( packctx->writer, array_length * element_size );
-				dl_error_t err = dl_txt_pack_eat_and_write_array( dl_ctx, packctx, member, array_length );
-				if( DL_ERROR_OK != err ) return err;
 			}
 			dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ']' );
 		}
@@ -877,18 +1027,11 @@ static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx,
 		case DL_TYPE_ATOM_INLINE_ARRAY:
 		{
 			dl_txt_eat_char( dl_ctx, &packctx->read_ctx, '[' );
-			uint32_t array_length = dl_txt_pack_find_array_length( dl_ctx, packctx, member );
-			if(array_length > member->inline_array_cnt())
+			dl_txt_eat_white( &packctx->read_ctx );
+			uint32_t array_length = 0;
+			if( *packctx->read_ctx.iter != ']' )
 			{
-				dl_txt_read_failed( dl_ctx,
-									&packctx->read_ctx,
-									DL_ERROR_MALFORMED_DATA,
-									"to many elements in inline array, %u > %u", array_length, member->inline_array_cnt() );
-			}
-
-			if(array_length > 0)
-			{
-				dl_error_t err = dl_txt_pack_eat_and_write_array( dl_ctx, packctx, member, array_length );
+				dl_error_t err = dl_txt_pack_eat_and_write_array( dl_ctx, packctx, member, member_pos, member->inline_array_cnt(), &array_length );
 				if( DL_ERROR_OK != err ) return err;
 			}
 
@@ -920,7 +1063,11 @@ static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx,
 					// default type to zero!
 					uint32_t missing_elements = member->inline_array_cnt() - array_length;
 					if(missing_elements > 0)
-						dl_binary_writer_write_zero(packctx->writer, missing_elements * dl_pod_size(member->StorageType()));
+					{
+						size_t pod_size = dl_pod_size(member->StorageType());
+						dl_binary_writer_seek_set( packctx->writer, member_pos + array_length * pod_size );
+						dl_binary_writer_write_zero(packctx->writer, missing_elements * pod_size);
+					}
 				}
 			}
 
@@ -1063,7 +1210,11 @@ static dl_error_t dl_txt_pack_eat_and_write_struct( dl_ctx_t dl_ctx, dl_txt_pack
 		dl_txt_eat_white( &packctx->read_ctx );
 		dl_substr member_name = dl_txt_eat_object_key( &packctx->read_ctx );
 		if( member_name.str == 0x0 )
+		{
+			if( *packctx->read_ctx.iter == ']' )
+				dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TXT_PARSE_ERROR, "Invalid txt-format, are you missing an '}'?" );
 			dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_MALFORMED_DATA, "expected map-key containing member name." );
+		}
 
 		if( member_name.str[0] == '_' && member_name.str[1] == '_' )
 		{
@@ -1072,11 +1223,16 @@ static dl_error_t dl_txt_pack_eat_and_write_struct( dl_ctx_t dl_ctx, dl_txt_pack
 			{
 				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ':' );
 
-				if( packctx->subdata_pos )
+				if( packctx->read_ctx.pin )
 					dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_MALFORMED_DATA, "\"__subdata\" set twice!" );
 
-				packctx->subdata_pos = packctx->read_ctx.iter;
-				packctx->read_ctx.iter = dl_txt_skip_map( packctx->read_ctx.iter, packctx->read_ctx.end );
+				if( packctx->read_ctx.stream )
+					dl_txt_pack_stream_skip_map( &packctx->read_ctx );
+				else
+				{
+					packctx->read_ctx.pin  = packctx->read_ctx.iter;
+					packctx->read_ctx.iter = dl_txt_skip_map( packctx->read_ctx.iter, packctx->read_ctx.end );
+				}
 				continue;
 			}
 			dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TXT_INVALID_MEMBER, "type %s has no member named %.*s", dl_internal_type_name( dl_ctx, type ), member_name.len, member_name.str );
@@ -1172,10 +1328,10 @@ static dl_error_t dl_txt_pack_finalize_subdata( dl_ctx_t dl_ctx, dl_txt_pack_ctx
 {
 	if( packctx->subdata.Len() == 0 )
 		return DL_ERROR_OK;
-	if( packctx->subdata_pos == 0x0 )
+	if( packctx->read_ctx.pin == 0x0 )
 		dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TXT_MISSING_SECTION, "instance has pointers but no \"__subdata\"-member" );
 
-	packctx->read_ctx.iter = packctx->subdata_pos;
+	packctx->read_ctx.iter = packctx->read_ctx.pin;
 
 	CArrayStatic<SSubInstance, 256> subinstances(dl_ctx->alloc);
 	subinstances.Add({ { "__root", 6 }, sizeof(dl_data_header), dl_internal_hash_string("__root") });
@@ -1192,6 +1348,7 @@ static dl_error_t dl_txt_pack_finalize_subdata( dl_ctx_t dl_ctx, dl_txt_pack_ctx
 		dl_substr subdata_name = dl_txt_eat_string( &packctx->read_ctx );
 		if( subdata_name.str == 0x0 )
 			dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_MALFORMED_DATA, "expected map-key containing subdata instance-name." );
+		subdata_name = dl_txt_pack_store_name( dl_ctx, packctx, subdata_name );
 
 		uint32_t name_hash = dl_internal_hash_buffer(subdata_name);
 		dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ':' );
@@ -1304,8 +1461,76 @@ static const dl_type_desc* dl_txt_pack_inner( dl_ctx_t dl_ctx, dl_txt_pack_ctx*
 	return 0x0;
 }
 
-dl_error_t dl_txt_pack_internal( dl_ctx_t dl_ctx, const char* txt_instance, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes, bool use_fast_ptr_patch )
+/**
+ * The reader only bounds-checks while scanning whitespace, comments and strings, all other tokens are read until
+ * the first char that does not belong to them. As all valid instances end with the '}' closing the root map that
+ * char is always found within the text, so only text that ends with something else need a terminated copy.
+ */
+static bool dl_txt_pack_ends_with_map_close( const char* txt, size_t txt_len )
 {
+	while( txt_len > 0 && dl_txt_is_white( txt[txt_len - 1] ) )
+		--txt_len;
+	return txt_len > 0 && txt[txt_len - 1] == '}';
+}
+
+/**
+ * Pack the text read by packctx->read_ctx to packctx->writer and write the header, errors are reported with the
+ * location in the text where they were found.
+ */
+static dl_error_t dl_txt_pack_run( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, size_t* produced_bytes, bool use_fast_ptr_patch )
+{
+	dl_binary_writer* writer = packctx->writer;
+	packctx->read_ctx.pin = 0x0;
+	packctx->read_ctx.err = DL_ERROR_OK;
+
+	dl_binary_writer_write_zero( writer, sizeof( dl_data_header ) );
+	const dl_type_desc* root_type = dl_txt_pack_inner( dl_ctx, packctx );
+	if( packctx->read_ctx.err == DL_ERROR_OK )
+	{
+		// write patch-table after instance
+		dl_binary_writer_seek_end( writer );
+		size_t instance_end = dl_binary_writer_tell( writer );
+		if( use_fast_ptr_patch )
+		{
+			CArrayStatic<uintptr_t, 256>& pointers = packctx->ptrs.addresses;
+			std::sort( pointers.m_Ptr, pointers.m_Ptr + pointers.m_nElements );
+			dl_internal_patch_table_write( writer, pointers.m_Ptr, pointers.Len() );
+		}
+
+		// write header
+		if( !writer->dummy && dl_binary_writer_fits( writer, dl_binary_writer_needed_size( writer ) ) )
+		{
+			dl_data_header& header              = *(dl_data_header*)writer->data;
+			header.id                           = DL_INSTANCE_ID;
+			header.version                      = DL_INSTANCE_VERSION;
+			header.root_instance_type           = dl_internal_typeid_of( dl_ctx, root_type );
+			header.instance_size                = uint32_t( instance_end - dl_internal_align_up<uint32_t>( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] ) );
+			header.is_64_bit_ptr                = sizeof( void* ) == 8 ? 1 : 0;
+			header.not_using_ptr_chain_patching = use_fast_ptr_patch ? 0 : 1;
+			header.patch_table_size             = uint32_t( dl_binary_writer_needed_size( writer ) - instance_end );
+		}
+
+		if( produced_bytes )
+			*produced_bytes = (unsigned int)dl_binary_writer_needed_size( writer );
+	}
+	else
+	{
+		dl_report_error_location( dl_ctx, packctx->read_ctx.start, packctx->read_ctx.end, packctx->read_ctx.iter );
+	}
+	return packctx->read_ctx.err;
+}
+
+dl_error_t dl_txt_pack_internal( dl_ctx_t dl_ctx, const char* txt_instance, size_t txt_instance_len, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes, bool use_fast_ptr_patch )
+{
+	char* txt_copy = 0x0;
+	if( !dl_txt_pack_ends_with_map_close( txt_instance, txt_instance_len ) )
+	{
+		txt_copy = (char*)dl_alloc( &dl_ctx->alloc, txt_instance_len + 1 );
+		memcpy( txt_copy, txt_instance, txt_instance_len );
+		txt_copy[txt_instance_len] = '\0';
+		txt_instance = txt_copy;
+	}
+
 	dl_binary_writer writer;
 	dl_binary_writer_init( &writer,
 						   out_buffer,
@@ -1316,64 +1541,87 @@ dl_error_t dl_txt_pack_internal( dl_ctx_t dl_ctx, const char* txt_instance, unsi
 						   DL_PTR_SIZE_HOST );
 	dl_txt_pack_ctx packctx(dl_ctx->alloc);
 	packctx.writer  = &writer;
-	packctx.read_ctx.start = txt_instance;
-	packctx.read_ctx.end   = txt_instance + strlen(txt_instance); // TODO: pass to function!
-	packctx.read_ctx.iter  = txt_instance;
-	packctx.subdata_pos = 0x0;
-	packctx.read_ctx.err = DL_ERROR_OK;
-
-	dl_binary_writer_write_zero( &writer, sizeof( dl_data_header ) );
-	const dl_type_desc* root_type = dl_txt_pack_inner( dl_ctx, &packctx );
-	if( packctx.read_ctx.err == DL_ERROR_OK )
-	{
-		// write header
-		if( out_buffer_size > 0 )
-		{
-			CArrayStatic<uintptr_t, 256>& pointers = packctx.ptrs.addresses;
-
-			dl_data_header& header        = *(dl_data_header*)writer.data;
-			header.id                     = DL_INSTANCE_ID;
-			header.version                = DL_INSTANCE_VERSION;
-			header.root_instance_type     = dl_internal_typeid_of( dl_ctx, root_type );
-			header.instance_size          = uint32_t(dl_binary_writer_needed_size( &writer ) - dl_internal_align_up<uint32_t>( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] ));
-			header.is_64_bit_ptr          = sizeof( void* ) == 8 ? 1 : 0;
-			header.first_pointer_to_patch = pointers.Len() ? (uint32_t)pointers[0] : 0;
-
-			uintptr_t offset_shift = sizeof( uintptr_t ) * 4;
-			if( dl_binary_writer_needed_size( &writer ) >= ( 1ULL << offset_shift ) || !use_fast_ptr_patch )
-				header.not_using_ptr_chain_patching = 1;
-			else
-			{
-				std::sort( pointers.m_Ptr, pointers.m_Ptr + pointers.m_nElements );
-				if( !packctx.writer->dummy && pointers.Len() )
-				{
-					pointers.Add( pointers[pointers.Len() - 1] ); // Adding last pointer again so the offset to next pointer becomes 0 which terminates patching
-					for( size_t i = 0; i < pointers.Len() - 1; ++i )
-					{
-						uintptr_t offset                                = *(uintptr_t*)&packctx.writer->data[pointers[i]];
-						*(uintptr_t*)&packctx.writer->data[pointers[i]] = offset | ( ( (uintptr_t)( pointers[i + 1] - pointers[i] ) ) << offset_shift );
-					}
-				}
-			}
-		}
+	packctx.read_ctx.start  = txt_instance;
+	packctx.read_ctx.end    = txt_instance + txt_instance_len;
+	packctx.read_ctx.iter   = txt_instance;
+	packctx.read_ctx.stream = 0x0;
 
-		if( produced_bytes )
-			*produced_bytes = (unsigned int)dl_binary_writer_needed_size( &writer );
-	}
-	else
-	{
-		dl_report_error_location( dl_ctx, packctx.read_ctx.start, packctx.read_ctx.end, packctx.read_ctx.iter );
-	}
-	return packctx.read_ctx.err;
+	dl_error_t err = dl_txt_pack_run( dl_ctx, &packctx, produced_bytes, use_fast_ptr_patch );
+
+	if( txt_copy )
+		dl_free( &dl_ctx->alloc, txt_copy );
+	return err;
 }
 
 dl_error_t dl_txt_pack(dl_ctx_t dl_ctx, const char* txt_instance, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes)
+{
+	return dl_txt_pack_ex( dl_ctx, txt_instance, strlen( txt_instance ), out_buffer, out_buffer_size, produced_bytes );
+}
+
+dl_error_t dl_txt_pack_ex( dl_ctx_t dl_ctx, const char* txt_instance, size_t txt_instance_len, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes )
 {
 	bool use_fast_ptr_patch = true;
-	return dl_txt_pack_internal( dl_ctx, txt_instance, out_buffer, out_buffer_size, produced_bytes, use_fast_ptr_patch );
+	return dl_txt_pack_internal( dl_ctx, txt_instance, txt_instance_len, out_buffer, out_buffer_size, produced_bytes, use_fast_ptr_patch );
 }
 
 dl_error_t dl_txt_pack_calc_size( dl_ctx_t dl_ctx, const char* txt_instance, size_t* out_instance_size )
 {
 	return dl_txt_pack( dl_ctx, txt_instance, 0x0, 0, out_instance_size );
 }
+
+dl_error_t dl_txt_pack_stream( dl_ctx_t         dl_ctx,
+                               dl_txt_read_func read_func,   void*           read_ctx,
+                               dl_alloc_func    alloc_func,  dl_realloc_func realloc_func,
+                               dl_free_func     free_func,   void*           alloc_ctx,
+                               unsigned char**  out_buffer,  size_t*         out_size )
+{
+	dl_allocator out_alloc;
+	if( read_func == 0x0 || !dl_allocator_initialize( &out_alloc, alloc_func, realloc_func, free_func, alloc_ctx ) )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	dl_txt_read_stream stream;
+	stream.read_func      = read_func;
+	stream.read_ctx       = read_ctx;
+	stream.dl_ctx         = dl_ctx;
+	stream.alloc          = &dl_ctx->alloc;
+	stream.buffer_size    = DL_TXT_READ_STREAM_CHUNK_SIZE + 1;
+	stream.buffer         = (char*)dl_alloc( stream.alloc, stream.buffer_size );
+	if( stream.buffer == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	stream.buffer[0]      = '\0';
+	stream.complete_token = 0x0;
+	stream.eof            = false;
+
+	dl_binary_writer writer;
+	dl_binary_writer_init( &writer, 0x0, 0, false, DL_ENDIAN_HOST, DL_ENDIAN_HOST, DL_PTR_SIZE_HOST );
+	writer.grow_alloc = &out_alloc;
+
+	size_t produced_bytes = 0;
+	dl_error_t err;
+	{
+		dl_txt_pack_ctx packctx(dl_ctx->alloc);
+		packctx.writer  = &writer;
+		packctx.read_ctx.start  = stream.buffer;
+		packctx.read_ctx.end    = stream.buffer;
+		packctx.read_ctx.iter   = stream.buffer;
+		packctx.read_ctx.pin    = 0x0;
+		packctx.read_ctx.stream = &stream;
+		dl_txt_read_more( &packctx.read_ctx, packctx.read_ctx.end );
+
+		err = dl_txt_pack_run( dl_ctx, &packctx, &produced_bytes, true );
+	}
+
+	dl_free( stream.alloc, stream.buffer );
+	if( writer.out_of_memory )
+		err = DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	if( err != DL_ERROR_OK )
+	{
+		if( writer.data )
+			dl_free( &out_alloc, writer.data );
+		return err;
+	}
+
+	*out_buffer = writer.data;
+	*out_size   = produced_bytes;
+	return DL_ERROR_OK;
+}
@@ -1,6 +1,7 @@
 /* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
 
 #include "dl_txt_read.h"
+#include "dl_txt_number.h"
 
 #include <errno.h>
 #include <stdlib.h>
@@ -70,10 +71,20 @@ long long dl_txt_pack_eat_strtoll( dl_ctx_t dl_ctx, dl_txt_read_ctx* read_ctx, l
 	else
 	{
 		errno = 0;
+		bool negative;
+		uint64_t value;
+		const char* end;
+		if( dl_txt_parse_int_dec( read_ctx->iter, &end, &negative, &value ) )
+		{
+			// ... plain decimal, no need for strtoll() ...
+			v    = negative ? -(long long)value : (long long)value;
+			next = (char*)end;
+		}
+		else
 	#if defined(_MSC_VER)
-		v = _strtoi64( read_ctx->iter, &next, 0 );
+			v = _strtoi64( read_ctx->iter, &next, 0 );
 	#else
-		v = strtoll( read_ctx->iter, &next, 0 );
+			v = strtoll( read_ctx->iter, &next, 0 );
 	#endif
 
 		if( read_ctx->iter == next )
@@ -130,10 +141,19 @@ unsigned long long dl_txt_pack_eat_strtoull( dl_ctx_t dl_ctx, dl_txt_read_ctx* r
 	else
 	{
 		errno = 0;
+		bool negative;
+		uint64_t value;
+		const char* end;
+		if( dl_txt_parse_int_dec( read_ctx->iter, &end, &negative, &value ) )
+		{
+			v    = value;
+			next = (char*)end;
+		}
+		else
 	#if defined(_MSC_VER)
-		v = _strtoui64( read_ctx->iter, &next, 0 );
+			v = _strtoui64( read_ctx->iter, &next, 0 );
 	#else
-		v = strtoull( read_ctx->iter, &next, 0 );
+			v = strtoull( read_ctx->iter, &next, 0 );
 	#endif
 
 		if( read_ctx->iter == next )
@@ -190,7 +210,144 @@ void dl_report_error_location( dl_ctx_t ctx, const char* txt, const char* end, c
 		dl_log_error( ctx, "at end of buffer");
 	else
 	{
-		const char* line_end = strchr( last_line, '\n' );
+		const char* line_end = (const char*)memchr( last_line, '\n', (size_t)( end - last_line ) );
+		if( line_end == 0x0 )
+			line_end = end;
 		dl_log_error( ctx, "at line %d, col %d:\n%.*s\n%*c^", line, col, (int)(line_end-last_line), last_line, col, ' ');
 	}
 }
+
+bool dl_txt_read_more( dl_txt_read_ctx* readctx, const char* keep_from )
+{
+	dl_txt_read_stream* stream = readctx->stream;
+	if( stream->eof )
+		return false;
+
+	char* old_buffer = stream->buffer;
+	const char* old_end = readctx->end;
+	if( keep_from < old_buffer || keep_from > old_end )
+		keep_from = old_end;
+	if( readctx->pin && readctx->pin >= old_buffer && readctx->pin < keep_from )
+		keep_from = readctx->pin;
+
+	// ... only move the kept text to the front of the buffer if that frees at least as much as is moved, that way each
+	//     byte is moved a constant number of times on average ...
+	size_t drop = (size_t)( keep_from - old_buffer );
+	size_t kept = (size_t)( old_end - keep_from );
+	size_t shift = 0;
+	if( drop > 0 && drop >= kept )
+	{
+		memmove( old_buffer, keep_from, kept );
+		shift = drop;
+	}
+
+	size_t used = (size_t)( old_end - old_buffer ) - shift;
+	if( stream->buffer_size - used - 1 < DL_TXT_READ_STREAM_CHUNK_SIZE / 4 )
+	{
+		size_t new_size = stream->buffer_size * 2;
+		if( new_size < used + DL_TXT_READ_STREAM_CHUNK_SIZE + 1 )
+			new_size = used + DL_TXT_READ_STREAM_CHUNK_SIZE + 1;
+		char* new_buffer = (char*)dl_realloc( stream->alloc, stream->buffer, new_size, stream->buffer_size );
+		if( new_buffer == 0x0 )
+			dl_txt_read_failed( stream->dl_ctx, readctx, DL_ERROR_OUT_OF_LIBRARY_MEMORY, "out of memory growing the text buffer to %lu bytes", (unsigned long)new_size );
+		stream->buffer      = new_buffer;
+		stream->buffer_size = new_size;
+	}
+
+	// ... the caller scans the kept text again after each refill, read at least as much as was kept to keep the
+	//     total time spent scanning linear in the size of the text ...
+	char* buffer = stream->buffer;
+	size_t read = 0;
+	do
+	{
+		size_t chunk = stream->read_func( buffer + used + read, stream->buffer_size - 1 - used - read, stream->read_ctx );
+		if( chunk == 0 )
+		{
+			stream->eof = true;
+			break;
+		}
+		read += chunk;
+	} while( read < kept && used + read < stream->buffer_size - 1 );
+	buffer[used + read] = '\0';
+
+	if( readctx->iter >= old_buffer && readctx->iter <= old_end )
+		readctx->iter = buffer + ( readctx->iter - old_buffer ) - shift;
+	if( readctx->pin >= old_buffer && readctx->pin <= old_end )
+		readctx->pin = buffer + ( readctx->pin - old_buffer ) - shift;
+	readctx->start = buffer;
+	readctx->end   = buffer + used + read;
+	stream->complete_token = 0x0;
+	return read > 0;
+}
+
+/**
+ * Return true if all of the token at token is in [token, end), i.e. it is followed by a char that can not be part
+ * of it.
+ */
+static bool dl_txt_stream_token_complete( const char* token, const char* end )
+{
+	switch( *token )
+	{
+		case '{':
+		case '}':
+		case '[':
+		case ']':
+		case ',':
+		case ':':
+			return true;
+		case '"':
+		case '\'':
+		{
+			const char quote = *token;
+			const char* iter = token + 1;
+			while( true )
+			{
+				iter = dl_txt_find_first_of( iter, end, quote, '\\', quote, '\\' );
+				if( iter == end )
+					return false;
+				if( *iter == quote )
+					return true;
+				// ... skip escaped char ...
+				if( end - iter < 2 )
+					return false;
+				iter += 2;
+			}
+		}
+		default:
+			for( const char* iter = token; iter != end; ++iter )
+			{
+				if( dl_txt_is_white( *iter ) )
+					return true;
+				switch( *iter )
+				{
+					case ',': case ':': case '{': case '}': case '[': case ']': case '/':
+						return true;
+					default:
+						break;
+				}
+			}
+			return false;
+	}
+}
+
+void dl_txt_stream_eat_white( dl_txt_read_ctx* readctx )
+{
+	dl_txt_read_stream* stream = readctx->stream;
+	while( true )
+	{
+		const char* token = dl_txt_skip_white( readctx->iter, readctx->end );
+		if( *token != '\0' && ( token == stream->complete_token || dl_txt_stream_token_complete( token, readctx->end ) ) )
+		{
+			stream->complete_token = token;
+			readctx->iter = token;
+			return;
+		}
+
+		// ... whitespace, comment or token cut by the end of the buffer, read more and scan again from iter ...
+		if( !dl_txt_read_more( readctx, readctx->iter ) )
+		{
+			readctx->iter = dl_txt_skip_white( readctx->iter, readctx->end );
+			return;
+		}
+	}
+}
@@ -3,17 +3,75 @@
 
 #include <ctype.h>
 #include <setjmp.h>
+#include <string.h>
+#include <dl/dl_txt.h>
+#include "dl_config.h"
 #include "dl_types.h"
 
+#if !defined(DL_NO_SIMD)
+#  if defined(__AVX2__)
+#    define DL_TXT_READ_AVX2 1
+#    define DL_TXT_SCAN_WIDTH 32
+#    include <immintrin.h>
+#  elif defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#    define DL_TXT_READ_SSE2 1
+#    define DL_TXT_SCAN_WIDTH 16
+#    include <emmintrin.h>
+#  elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define DL_TXT_READ_NEON 1
+#    define DL_TXT_SCAN_WIDTH 16
+#    include <arm_neon.h>
+#  endif
+#  if defined(DL_TXT_SCAN_WIDTH) && defined(_MSC_VER)
+#    include <intrin.h>
+#  endif
+#endif
+
+/**
+ * Minimum number of bytes requested from dl_txt_read_stream.read_func on each refill.
+ */
+#define DL_TXT_READ_STREAM_CHUNK_SIZE (64 * 1024)
+
+/**
+ * Text read through a callback instead of from one buffer. The buffer holds a window of the text that only keeps
+ * the bytes from the current token, or dl_txt_read_ctx.pin if that is set, and onward. As the window is moved and
+ * reallocated on refill all pointers into the text except iter and pin are invalid after each dl_txt_eat_white().
+ */
+struct dl_txt_read_stream
+{
+	dl_txt_read_func read_func;
+	void*            read_ctx;
+	dl_ctx_t         dl_ctx;         ///< context errors while reading are reported to.
+	dl_allocator*    alloc;
+	char*            buffer;
+	size_t           buffer_size;
+	const char*      complete_token; ///< last token found to be completely read into the buffer.
+	bool             eof;
+};
+
 struct dl_txt_read_ctx
 {
 	jmp_buf jumpbuf;
 	const char* start;
 	const char* end;
 	const char* iter;
+	const char* pin;               ///< if set, text from here and onward is kept in the buffer while streaming.
+	dl_txt_read_stream* stream;    ///< 0x0 if all text is in [start, end).
 	dl_error_t err;
 };
 
+/**
+ * Read more text from readctx->stream into the buffer keeping all text from keep_from, or pin if that is before
+ * keep_from. start, end, iter and pin is updated to point into the new buffer.
+ * Returns false if there was no more text to read.
+ */
+bool dl_txt_read_more( dl_txt_read_ctx* readctx, const char* keep_from );
+
+/**
+ * dl_txt_eat_white() for streamed text, reads more text until the token after the whitespace is complete.
+ */
+void dl_txt_stream_eat_white( dl_txt_read_ctx* readctx );
+
 
 #if defined( __GNUC__ )
 static void dl_txt_read_failed( dl_ctx_t ctx, dl_txt_read_ctx* readctx, dl_error_t err, const char* fmt, ... ) __attribute__((format( printf, 4, 5 )));
@@ -37,11 +95,135 @@ static /*no inline?*/ void dl_txt_read_failed( dl_ctx_t ctx, dl_txt_read_ctx* re
 	longjmp( readctx->jumpbuf, 1 );
 }
 
+/**
+ * Same set of chars as isspace() in the "C" locale, ' ', '\t', '\n', '\v', '\f' and '\r'.
+ */
+static inline bool dl_txt_is_white( char c )
+{
+	return c == ' ' || (unsigned char)( c - '\t' ) <= (unsigned char)( '\r' - '\t' );
+}
+
+#if defined(DL_TXT_SCAN_WIDTH)
+
+#if defined(DL_TXT_READ_NEON)
+static inline unsigned dl_txt_scan_first_set( uint8x16_t match )
+{
+	// ... narrow each 0xFF/0x00 byte to a nibble to get a 64 bit mask ...
+	uint64_t bits = vget_lane_u64( vreinterpret_u64_u8( vshrn_n_u16( vreinterpretq_u16_u8( match ), 4 ) ), 0 );
+	if( bits == 0 )
+		return DL_TXT_SCAN_WIDTH;
+	return (unsigned)__builtin_ctzll( bits ) / 4;
+}
+#else
+static inline unsigned dl_txt_scan_first_set( uint32_t mask )
+{
+	if( mask == 0 )
+		return DL_TXT_SCAN_WIDTH;
+#  if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward( &index, mask );
+	return (unsigned)index;
+#  else
+	return (unsigned)__builtin_ctz( mask );
+#  endif
+}
+#endif
+
+/**
+ * Return the index of the first char in the DL_TXT_SCAN_WIDTH chars at str that is not whitespace, or
+ * DL_TXT_SCAN_WIDTH if all of them are.
+ */
+static inline unsigned dl_txt_scan_first_non_white( const char* str )
+{
+#if defined(DL_TXT_READ_AVX2)
+	__m256i v     = _mm256_loadu_si256( (const __m256i*)str );
+	__m256i space = _mm256_cmpeq_epi8( v, _mm256_set1_epi8( ' ' ) );
+	__m256i ctrl  = _mm256_sub_epi8( v, _mm256_set1_epi8( '\t' ) );
+	ctrl = _mm256_cmpeq_epi8( _mm256_min_epu8( ctrl, _mm256_set1_epi8( '\r' - '\t' ) ), ctrl );
+	return dl_txt_scan_first_set( ~(uint32_t)_mm256_movemask_epi8( _mm256_or_si256( space, ctrl ) ) );
+#elif defined(DL_TXT_READ_SSE2)
+	__m128i v     = _mm_loadu_si128( (const __m128i*)str );
+	__m128i space = _mm_cmpeq_epi8( v, _mm_set1_epi8( ' ' ) );
+	__m128i ctrl  = _mm_sub_epi8( v, _mm_set1_epi8( '\t' ) );
+	ctrl = _mm_cmpeq_epi8( _mm_min_epu8( ctrl, _mm_set1_epi8( '\r' - '\t' ) ), ctrl );
+	return dl_txt_scan_first_set( ~(uint32_t)_mm_movemask_epi8( _mm_or_si128( space, ctrl ) ) & 0xFFFF );
+#elif defined(DL_TXT_READ_NEON)
+	uint8x16_t v     = vld1q_u8( (const uint8_t*)str );
+	uint8x16_t space = vceqq_u8( v, vdupq_n_u8( ' ' ) );
+	uint8x16_t ctrl  = vcleq_u8( vsubq_u8( v, vdupq_n_u8( '\t' ) ), vdupq_n_u8( '\r' - '\t' ) );
+	return dl_txt_scan_first_set( vmvnq_u8( vorrq_u8( space, ctrl ) ) );
+#endif
+}
+
+/**
+ * Return the index of the first char in the DL_TXT_SCAN_WIDTH chars at str that is any of c0, c1, c2 or c3,
+ * or DL_TXT_SCAN_WIDTH if there is none.
+ */
+static inline unsigned dl_txt_scan_first_of( const char* str, char c0, char c1, char c2, char c3 )
+{
+#if defined(DL_TXT_READ_AVX2)
+	__m256i v = _mm256_loadu_si256( (const __m256i*)str );
+	__m256i m = _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( v, _mm256_set1_epi8( c0 ) ), _mm256_cmpeq_epi8( v, _mm256_set1_epi8( c1 ) ) ),
+	                             _mm256_or_si256( _mm256_cmpeq_epi8( v, _mm256_set1_epi8( c2 ) ), _mm256_cmpeq_epi8( v, _mm256_set1_epi8( c3 ) ) ) );
+	return dl_txt_scan_first_set( (uint32_t)_mm256_movemask_epi8( m ) );
+#elif defined(DL_TXT_READ_SSE2)
+	__m128i v = _mm_loadu_si128( (const __m128i*)str );
+	__m128i m = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( v, _mm_set1_epi8( c0 ) ), _mm_cmpeq_epi8( v, _mm_set1_epi8( c1 ) ) ),
+	                          _mm_or_si128( _mm_cmpeq_epi8( v, _mm_set1_epi8( c2 ) ), _mm_cmpeq_epi8( v, _mm_set1_epi8( c3 ) ) ) );
+	return dl_txt_scan_first_set( (uint32_t)_mm_movemask_epi8( m ) );
+#elif defined(DL_TXT_READ_NEON)
+	uint8x16_t v = vld1q_u8( (const uint8_t*)str );
+	uint8x16_t m = vorrq_u8( vorrq_u8( vceqq_u8( v, vdupq_n_u8( (uint8_t)c0 ) ), vceqq_u8( v, vdupq_n_u8( (uint8_t)c1 ) ) ),
+	                         vorrq_u8( vceqq_u8( v, vdupq_n_u8( (uint8_t)c2 ) ), vceqq_u8( v, vdupq_n_u8( (uint8_t)c3 ) ) ) );
+	return dl_txt_scan_first_set( m );
+#endif
+}
+
+#endif // defined(DL_TXT_SCAN_WIDTH)
+
+/**
+ * Return the first char in [str, end) that is not whitespace, or end.
+ */
+static inline const char* dl_txt_find_non_white( const char* str, const char* end )
+{
+#if defined(DL_TXT_SCAN_WIDTH)
+	while( end - str >= DL_TXT_SCAN_WIDTH )
+	{
+		unsigned index = dl_txt_scan_first_non_white( str );
+		if( index < DL_TXT_SCAN_WIDTH )
+			return str + index;
+		str += DL_TXT_SCAN_WIDTH;
+	}
+#endif
+	while( str != end && dl_txt_is_white( *str ) ) ++str;
+	return str;
+}
+
+/**
+ * Return the first char in [str, end) that is any of c0, c1, c2 or c3, or end.
+ */
+static inline const char* dl_txt_find_first_of( const char* str, const char* end, char c0, char c1, char c2, char c3 )
+{
+#if defined(DL_TXT_SCAN_WIDTH)
+	while( end - str >= DL_TXT_SCAN_WIDTH )
+	{
+		unsigned index = dl_txt_scan_first_of( str, c0, c1, c2, c3 );
+		if( index < DL_TXT_SCAN_WIDTH )
+			return str + index;
+		str += DL_TXT_SCAN_WIDTH;
+	}
+#endif
+	while( str != end && *str != c0 && *str != c1 && *str != c2 && *str != c3 ) ++str;
+	return str;
+}
+
 inline const char* dl_txt_skip_white( const char* str, const char* end )
 {
 	while( true )
 	{
-		while( str != end && isspace(*str) ) ++str;
+		// ... most calls are made when already at a non-white char, check one char before scanning ...
+		if( str != end && dl_txt_is_white( *str ) )
+			str = dl_txt_find_non_white( str + 1, end );
 
 		if( str == end )
 			return "\0";
@@ -49,23 +231,27 @@ inline const char* dl_txt_skip_white( const char* str, const char* end )
 		if( *str == '/' )
 		{
 			++str;
+			if( str == end )
+				return "\0";
 
 			// ... skip comment ...
 			switch( *str )
 			{
 				case '/':
-					while( str != end && *str != '\n' ) ++str;
-					if( str == end )
+					str = (const char*)memchr( str, '\n', (size_t)( end - str ) );
+					if( str == 0x0 )
 						return "\0";
 					break;
 				case '*':
 					++str;
 					while( true )
 					{
-						while( str != end && *str != '*' ) ++str;
-						if( str == end )
+						str = (const char*)memchr( str, '*', (size_t)( end - str ) );
+						if( str == 0x0 )
 							return "\0";
 						++str;
+						if( str == end )
+							return "\0";
 						if( *str == '/' )
 						{
 							++str;
@@ -82,7 +268,10 @@ inline const char* dl_txt_skip_white( const char* str, const char* end )
 
 inline void dl_txt_eat_white( dl_txt_read_ctx* readctx )
 {
-	readctx->iter = dl_txt_skip_white( readctx->iter, readctx->end );
+	if( readctx->stream )
+		dl_txt_stream_eat_white( readctx );
+	else
+		readctx->iter = dl_txt_skip_white( readctx->iter, readctx->end );
 }
 
 static dl_substr dl_txt_eat_string_quote( dl_txt_read_ctx* readctx, char quote )
@@ -93,8 +282,12 @@ static dl_substr dl_txt_eat_string_quote( dl_txt_read_ctx* readctx, char quote )
 
 	const char* key_start = readctx->iter + 1;
 	const char* key_end = key_start;
-	while( *key_end )
+	while( true )
 	{
+		key_end = dl_txt_find_first_of( key_end, readctx->end, quote, '\\', '\0', quote );
+		if( key_end == readctx->end || *key_end == '\0' )
+			return res;
+
 		if( *key_end == quote )
 		{
 			res.str = key_start;
@@ -103,11 +296,11 @@ static dl_substr dl_txt_eat_string_quote( dl_txt_read_ctx* readctx, char quote )
 			return res;
 		}
 
-		if( *key_end == '\\' )
-			++key_end;
-		++key_end;
+		// ... skip escaped char ...
+		if( readctx->end - key_end < 2 )
+			return res;
+		key_end += 2;
 	}
-	return res;
 }
 
 static inline dl_substr dl_txt_eat_string( dl_txt_read_ctx* readctx )
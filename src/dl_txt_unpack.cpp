@@ -3,6 +3,7 @@
 #include "dl_internal_util.h"
 #include "dl_types.h"
 #include "dl_binary_writer.h"
+#include "dl_txt_number.h"
 #include <dl/dl_txt.h>
 
 struct dl_txt_unpack_ctx
@@ -62,78 +63,33 @@ static void dl_txt_unpack_write_string_or_null( dl_binary_writer* writer, const
 		dl_txt_unpack_write_string( writer, str );
 }
 
-static void dl_txt_unpack_int8( dl_binary_writer* writer, int8_t data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), "%d", data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-static void dl_txt_unpack_int16( dl_binary_writer* writer, int16_t data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), "%d", data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-static void dl_txt_unpack_int32( dl_binary_writer* writer, int32_t data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), "%d", data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-static void dl_txt_unpack_int64( dl_binary_writer* writer, int64_t data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), DL_INT64_FMT_STR, data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-static void dl_txt_unpack_uint8( dl_binary_writer* writer, uint8_t data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), "%u", data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-static void dl_txt_unpack_uint16( dl_binary_writer* writer, uint16_t data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), "%u", data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-static void dl_txt_unpack_uint32( dl_binary_writer* writer, uint32_t data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), "%u", data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-static void dl_txt_unpack_uint64( dl_binary_writer* writer, const uint64_t data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), DL_UINT64_FMT_STR, data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-// Writing fp32/fp64 with %.9g/%.17g for full "round-tripabillity", see
-// https://randomascii.wordpress.com/2012/03/08/float-precisionfrom-zero-to-100-digits-2/
-
-static void dl_txt_unpack_fp32( dl_binary_writer* writer, float data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), "%.9g", data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
-
-static void dl_txt_unpack_fp64( dl_binary_writer* writer, double data )
-{
-	char buffer[256];
-	int len = dl_internal_str_format( buffer, sizeof(buffer), "%.17g", data );
-	dl_binary_writer_write( writer, buffer, (size_t)len );
-}
+// numbers are formatted straight into the output when there is room, otherwise via a buffer on the stack
+// so that dl_binary_writer_write() can handle dummy writes and overflow.
+#define DL_TXT_UNPACK_NUMBER( writer, format_func, value )                                            \
+	do {                                                                                              \
+		char* direct = (char*)dl_binary_writer_direct( writer, DL_TXT_NUMBER_MAX_LEN );              \
+		if( direct )                                                                                  \
+			dl_binary_writer_direct_commit( writer, (size_t)format_func( direct, value ) );          \
+		else                                                                                          \
+		{                                                                                             \
+			char buffer[DL_TXT_NUMBER_MAX_LEN];                                                       \
+			dl_binary_writer_write( writer, buffer, (size_t)format_func( buffer, value ) );          \
+		}                                                                                             \
+	} while( false )
+
+static void dl_txt_unpack_int8  ( dl_binary_writer* writer, int8_t   data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_int64,  data ); }
+static void dl_txt_unpack_int16 ( dl_binary_writer* writer, int16_t  data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_int64,  data ); }
+static void dl_txt_unpack_int32 ( dl_binary_writer* writer, int32_t  data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_int64,  data ); }
+static void dl_txt_unpack_int64 ( dl_binary_writer* writer, int64_t  data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_int64,  data ); }
+static void dl_txt_unpack_uint8 ( dl_binary_writer* writer, uint8_t  data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_uint64, data ); }
+static void dl_txt_unpack_uint16( dl_binary_writer* writer, uint16_t data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_uint64, data ); }
+static void dl_txt_unpack_uint32( dl_binary_writer* writer, uint32_t data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_uint64, data ); }
+static void dl_txt_unpack_uint64( dl_binary_writer* writer, uint64_t data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_uint64, data ); }
+
+// Writing fp32/fp64 with the shortest representation that parse back to the same value for full "round-tripabillity",
+// see dl_txt_number.h.
+static void dl_txt_unpack_fp32( dl_binary_writer* writer, float  data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_fp32, data ); }
+static void dl_txt_unpack_fp64( dl_binary_writer* writer, double data ) { DL_TXT_UNPACK_NUMBER( writer, dl_txt_format_fp64, data ); }
 
 static void dl_txt_unpack_enum( dl_ctx_t dl_ctx, dl_binary_writer* writer, const dl_enum_desc* e, uint64_t value )
 {
@@ -162,9 +118,11 @@ static void dl_txt_unpack_ptr( dl_binary_writer* writer, dl_txt_unpack_ctx* unpa
 	}
 	else
 	{
-		char buffer[256];
-		dl_internal_str_format( buffer, sizeof( buffer ), "ptr_" DL_UINT64_FMT_STR, (uint64_t)( ptr - unpack_ctx->packed_instance ) );
-		dl_txt_unpack_write_string( writer, buffer );
+		char buffer[4 + DL_TXT_NUMBER_MAX_LEN];
+		memcpy( buffer, "\"ptr_", 5 );
+		size_t len = 5 + (size_t)dl_txt_format_uint64( buffer + 5, (uint64_t)( ptr - unpack_ctx->packed_instance ) );
+		buffer[len++] = '\"';
+		dl_binary_writer_write( writer, buffer, len );
 	}
 }
 
@@ -798,6 +756,43 @@ static dl_error_t dl_txt_unpack_root( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack
 	return DL_ERROR_OK;
 }
 
+static dl_error_t dl_txt_unpack_loaded_to_writer( dl_ctx_t dl_ctx, dl_typeid_t type, const void* loaded_packed_instance, dl_binary_writer* writer )
+{
+	dl_txt_unpack_ctx unpackctx( dl_ctx->alloc );
+	unpackctx.packed_instance      = reinterpret_cast<const uint8_t*>(loaded_packed_instance);
+	unpackctx.indent               = 0;
+	unpackctx.has_ptrs             = false;
+
+	unpackctx.ptrs.Add( { unpackctx.packed_instance, type } );
+
+	return dl_txt_unpack_root( dl_ctx, &unpackctx, writer, type );
+}
+
+static dl_error_t dl_txt_unpack_to_writer( dl_ctx_t dl_ctx, dl_typeid_t type, unsigned char* packed_instance, size_t packed_instance_size, dl_binary_writer* writer )
+{
+	if( packed_instance_size >= sizeof(dl_data_header) && ( (dl_data_header*)packed_instance )->using_relative_ptrs )
+	{
+		dl_log_error( dl_ctx, "instances with relative pointers can't be unpacked to text" );
+		return DL_ERROR_UNSUPPORTED_OPERATION;
+	}
+
+	// load from a copy, storing the loaded instance back into packed_instance would not give back the same bytes
+	// if it was packed in an older format.
+	uint8_t* instance_copy = (uint8_t*)dl_alloc( &dl_ctx->alloc, packed_instance_size > 0 ? packed_instance_size : 1 );
+	if( instance_copy == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	memcpy( instance_copy, packed_instance, packed_instance_size );
+
+	void* loaded_instance;
+	size_t consumed;
+	dl_error_t err = dl_instance_load_inplace( dl_ctx, type, instance_copy, packed_instance_size, &loaded_instance, &consumed );
+	if( err == DL_ERROR_OK )
+		err = dl_txt_unpack_loaded_to_writer( dl_ctx, type, (const void*)loaded_instance, writer );
+
+	dl_free( &dl_ctx->alloc, instance_copy );
+	return err;
+}
+
 dl_error_t dl_txt_unpack_loaded( dl_ctx_t    dl_ctx,                 dl_typeid_t type,
                                  const void* loaded_packed_instance, char*       out_txt_instance,
 	                             size_t      out_txt_instance_size,  size_t*     produced_bytes )
@@ -811,14 +806,7 @@ dl_error_t dl_txt_unpack_loaded( dl_ctx_t    dl_ctx,                 dl_typeid_t
 						   DL_ENDIAN_HOST,
 						   DL_PTR_SIZE_HOST );
 
-	dl_txt_unpack_ctx unpackctx( dl_ctx->alloc );
-	unpackctx.packed_instance      = reinterpret_cast<const uint8_t*>(loaded_packed_instance);
-	unpackctx.indent               = 0;
-	unpackctx.has_ptrs             = false;
-
-	unpackctx.ptrs.Add( { unpackctx.packed_instance, type } );
-
-	dl_error_t err = dl_txt_unpack_root( dl_ctx, &unpackctx, &writer, type );
+	dl_error_t err = dl_txt_unpack_loaded_to_writer( dl_ctx, type, loaded_packed_instance, &writer );
 	if( produced_bytes )
 		*produced_bytes = writer.needed_size;
 
@@ -835,15 +823,19 @@ dl_error_t dl_txt_unpack( dl_ctx_t       dl_ctx,           dl_typeid_t type,
                           char*          out_txt_instance, size_t      out_txt_instance_size,
                           size_t*        produced_bytes )
 {
-	void* loaded_instance;
-	size_t consumed;
-	dl_error_t err = dl_instance_load_inplace( dl_ctx, type, (uint8_t*)packed_instance, packed_instance_size, &loaded_instance, &consumed );
-	if( err != DL_ERROR_OK )
-		return err;
-	err = dl_txt_unpack_loaded( dl_ctx, type, (const void*)loaded_instance, out_txt_instance, out_txt_instance_size, produced_bytes );
-	if( err != DL_ERROR_OK )
-		return err;
-	err = dl_instance_store( dl_ctx, type, loaded_instance, (uint8_t*)packed_instance, packed_instance_size, &consumed );
+	dl_binary_writer writer;
+	dl_binary_writer_init( &writer,
+						   (uint8_t*)out_txt_instance,
+						   out_txt_instance_size,
+						   false,
+						   DL_ENDIAN_HOST,
+						   DL_ENDIAN_HOST,
+						   DL_PTR_SIZE_HOST );
+
+	dl_error_t err = dl_txt_unpack_to_writer( dl_ctx, type, packed_instance, packed_instance_size, &writer );
+	if( produced_bytes && err == DL_ERROR_OK )
+		*produced_bytes = writer.needed_size;
+
 	return err;
 }
 
@@ -853,3 +845,72 @@ dl_error_t dl_txt_unpack_calc_size( dl_ctx_t dl_ctx,                           d
 {
 	return dl_txt_unpack( dl_ctx, type, packed_instance, packed_instance_size, 0x0, 0, out_txt_instance_size );
 }
+
+// the text is written in chunks of this size, large enough to hold any single write done while unpacking.
+#define DL_TXT_UNPACK_STREAM_CHUNK_SIZE 4096
+
+struct dl_txt_unpack_stream_ctx
+{
+	dl_txt_write_func write_func;
+	void*             write_ctx;
+};
+
+static void dl_txt_unpack_stream_flush( const uint8_t* data, size_t data_size, void* flush_ctx )
+{
+	dl_txt_unpack_stream_ctx* stream = (dl_txt_unpack_stream_ctx*)flush_ctx;
+	stream->write_func( (const char*)data, data_size, stream->write_ctx );
+}
+
+static void dl_txt_unpack_stream_init_writer( dl_binary_writer* writer, uint8_t* chunk, dl_txt_unpack_stream_ctx* stream )
+{
+	dl_binary_writer_init( writer, chunk, DL_TXT_UNPACK_STREAM_CHUNK_SIZE, false, DL_ENDIAN_HOST, DL_ENDIAN_HOST, DL_PTR_SIZE_HOST );
+	writer->flush_func = dl_txt_unpack_stream_flush;
+	writer->flush_ctx  = stream;
+}
+
+static dl_error_t dl_txt_unpack_stream_finish( dl_binary_writer* writer, size_t* produced_bytes )
+{
+	dl_binary_writer_flush( writer );
+	if( produced_bytes )
+		*produced_bytes = writer->flushed;
+	// ... a write larger than a chunk would have left a hole in the text ...
+	return writer->out_of_memory ? DL_ERROR_INTERNAL_ERROR : DL_ERROR_OK;
+}
+
+dl_error_t dl_txt_unpack_stream( dl_ctx_t          dl_ctx,          dl_typeid_t type,
+                                 unsigned char*    packed_instance, size_t      packed_instance_size,
+                                 dl_txt_write_func write_func,      void*       write_ctx,
+                                 size_t*           produced_bytes )
+{
+	if( write_func == 0x0 )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	uint8_t chunk[DL_TXT_UNPACK_STREAM_CHUNK_SIZE];
+	dl_txt_unpack_stream_ctx stream = { write_func, write_ctx };
+	dl_binary_writer writer;
+	dl_txt_unpack_stream_init_writer( &writer, chunk, &stream );
+
+	dl_error_t err = dl_txt_unpack_to_writer( dl_ctx, type, packed_instance, packed_instance_size, &writer );
+	if( err == DL_ERROR_OK )
+		err = dl_txt_unpack_stream_finish( &writer, produced_bytes );
+	return err;
+}
+
+dl_error_t dl_txt_unpack_loaded_stream( dl_ctx_t          dl_ctx,     dl_typeid_t type,
+                                        const void*       loaded_instance,
+                                        dl_txt_write_func write_func, void*       write_ctx,
+                                        size_t*           produced_bytes )
+{
+	if( write_func == 0x0 )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	uint8_t chunk[DL_TXT_UNPACK_STREAM_CHUNK_SIZE];
+	dl_txt_unpack_stream_ctx stream = { write_func, write_ctx };
+	dl_binary_writer writer;
+	dl_txt_unpack_stream_init_writer( &writer, chunk, &stream );
+
+	dl_error_t err = dl_txt_unpack_loaded_to_writer( dl_ctx, type, loaded_instance, &writer );
+	if( err == DL_ERROR_OK )
+		err = dl_txt_unpack_stream_finish( &writer, produced_bytes );
+	return err;
+}
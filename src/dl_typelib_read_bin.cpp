@@ -83,8 +83,188 @@ static inline T* dl_realloc_array(dl_allocator* alloc, T* ptr, size_t new_size,
 	return (T*)dl_realloc(alloc, ptr, new_size * sizeof(T), old_size * sizeof(T));
 }
 
+static const dl_data_header* dl_internal_type_library_metadata_header( const dl_typelib_header* header, const uint8_t* metadatas, unsigned int index )
+{
+	uint32_t metadata_offset = *reinterpret_cast<const uint32_t*>( metadatas + index * sizeof( uint32_t ) );
+	metadata_offset          = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_offset ) : metadata_offset;
+	return reinterpret_cast<const dl_data_header*>( metadatas + header->metadatas_count * sizeof( uint32_t ) + metadata_offset );
+}
+
+static size_t dl_internal_type_library_metadata_size( const dl_data_header* metadata_header )
+{
+	dl_data_header header = *metadata_header;
+	if( DL_ENDIAN_HOST == DL_ENDIAN_BIG )
+	{
+		header.version          = dl_swap_endian_uint32( header.version );
+		header.instance_size    = dl_swap_endian_uint32( header.instance_size );
+		header.patch_table_size = dl_swap_endian_uint32( header.patch_table_size );
+	}
+	return dl_internal_packed_instance_size( &header, sizeof( dl_data_header ) );
+}
+
+static void dl_internal_alloc_type_library_metadatas( dl_ctx_t dl_ctx, const dl_typelib_header* header, const uint8_t* metadatas )
+{
+	if( header->metadatas_count == 0 )
+		return;
+
+	dl_ctx->metadatas          = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadatas,          dl_ctx->metadatas_count + header->metadatas_count, dl_ctx->metadatas_count );
+	dl_ctx->metadata_infos     = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadata_infos,     dl_ctx->metadatas_count + header->metadatas_count, dl_ctx->metadatas_count );
+	dl_ctx->metadata_typeinfos = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadata_typeinfos, dl_ctx->metadatas_count + header->metadatas_count, dl_ctx->metadatas_count );
+	for( unsigned int i = 0; i < header->metadatas_count; ++i )
+	{
+		const dl_data_header* metadata_header = dl_internal_type_library_metadata_header( header, metadatas, i );
+		dl_ctx->metadatas[dl_ctx->metadatas_count + i] = dl_alloc( &dl_ctx->alloc, dl_internal_type_library_metadata_size( metadata_header ) );
+	}
+}
+
+static dl_error_t dl_internal_load_type_library_metadatas( dl_ctx_t dl_ctx, const dl_typelib_header* header, const uint8_t* metadatas )
+{
+	// The types used for meta data must be known to be able to patch the data with dl_instance_load_inplace
+	for( unsigned int i = 0; i < header->metadatas_count; ++i )
+	{
+		const dl_data_header* metadata_header = dl_internal_type_library_metadata_header( header, metadatas, i );
+		size_t metadata_size                  = dl_internal_type_library_metadata_size( metadata_header );
+		memcpy( dl_ctx->metadatas[dl_ctx->metadatas_count + i], metadata_header, metadata_size );
+		dl_typeid_t type_id = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->root_instance_type ) : metadata_header->root_instance_type;
+		void* loaded_instance;
+		size_t consumed;
+		dl_error_t err = dl_instance_load_inplace( dl_ctx, type_id, (uint8_t*)dl_ctx->metadatas[dl_ctx->metadatas_count + i], metadata_size, &loaded_instance, &consumed );
+		if( err != DL_ERROR_OK )
+		{
+			return err;
+		}
+		DL_ASSERT( metadata_size == consumed );
+		dl_ctx->metadata_infos[dl_ctx->metadatas_count + i] = loaded_instance;
+		dl_ctx->metadata_typeinfos[dl_ctx->metadatas_count + i] = type_id;
+	}
+
+	dl_ctx->metadatas_count       += header->metadatas_count;
+	dl_ctx->metadatas_cap         = dl_ctx->metadatas_count;
+	return DL_ERROR_OK;
+}
+
+template <typename T>
+struct dl_internal_alignof
+{
+	struct helper { char c; T x; };
+	enum { value = sizeof( helper ) - sizeof( T ) };
+};
+
+/**
+ * Set *array to count elements of T at data, pointing straight into data if it is aligned, otherwise to a copy.
+ * Returns false, leaving *array untouched, if the copy could not be allocated.
+ */
+template <typename T>
+static inline bool dl_internal_borrow_array( dl_allocator* alloc, const uint8_t* data, size_t count, T** array )
+{
+	if( count == 0 )
+	{
+		*array = 0x0;
+		return true;
+	}
+
+	if( dl_internal_is_align( data, dl_internal_alignof<T>::value ) )
+	{
+		*array = (T*)data;
+		return true;
+	}
+
+	T* copy = (T*)dl_alloc( alloc, sizeof( T ) * count );
+	if( copy == 0x0 )
+		return false;
+	memcpy( copy, data, sizeof( T ) * count );
+	*array = copy;
+	return true;
+}
+
+/**
+ * Replace *array with a copy owned by ctx if it is borrowed. Returns false, leaving *array untouched, if the copy
+ * could not be allocated.
+ */
+template <typename T>
+static inline bool dl_internal_own_array( dl_ctx_t dl_ctx, T** array, size_t count )
+{
+	if( !dl_internal_is_borrowed( dl_ctx, *array ) )
+		return true;
+
+	T* copy = (T*)dl_alloc( &dl_ctx->alloc, sizeof( T ) * count );
+	if( copy == 0x0 )
+		return false;
+	memcpy( copy, *array, sizeof( T ) * count );
+	*array = copy;
+	return true;
+}
+
+/**
+ * Free array if it is a copy made by dl_internal_borrow_array() or dl_internal_own_array() and not original.
+ */
+template <typename T>
+static inline void dl_internal_free_array_copy( dl_allocator* alloc, T* array, const void* original )
+{
+	if( array != 0x0 && (const void*)array != original )
+		dl_free( alloc, array );
+}
+
+dl_error_t dl_internal_own_borrowed_type_library( dl_ctx_t dl_ctx )
+{
+	if( dl_ctx->borrowed_typelib == 0x0 )
+		return DL_ERROR_OK;
+
+	// ... copy all arrays before replacing any so ctx is left borrowing the type library if a copy fails ...
+	dl_typeid_t*        type_ids         = dl_ctx->type_ids;
+	dl_type_desc*       type_descs       = dl_ctx->type_descs;
+	dl_typeid_t*        enum_ids         = dl_ctx->enum_ids;
+	dl_enum_desc*       enum_descs       = dl_ctx->enum_descs;
+	dl_member_desc*     member_descs     = dl_ctx->member_descs;
+	dl_enum_value_desc* enum_value_descs = dl_ctx->enum_value_descs;
+	dl_enum_alias_desc* enum_alias_descs = dl_ctx->enum_alias_descs;
+	char*               typedata_strings = dl_ctx->typedata_strings;
+	char*               c_includes       = dl_ctx->c_includes;
+
+	bool owned = dl_internal_own_array( dl_ctx, &type_ids,         dl_ctx->type_count ) &&
+				 dl_internal_own_array( dl_ctx, &type_descs,       dl_ctx->type_count ) &&
+				 dl_internal_own_array( dl_ctx, &enum_ids,         dl_ctx->enum_count ) &&
+				 dl_internal_own_array( dl_ctx, &enum_descs,       dl_ctx->enum_count ) &&
+				 dl_internal_own_array( dl_ctx, &member_descs,     dl_ctx->member_count ) &&
+				 dl_internal_own_array( dl_ctx, &enum_value_descs, dl_ctx->enum_value_count ) &&
+				 dl_internal_own_array( dl_ctx, &enum_alias_descs, dl_ctx->enum_alias_count ) &&
+				 dl_internal_own_array( dl_ctx, &typedata_strings, dl_ctx->typedata_strings_size ) &&
+				 dl_internal_own_array( dl_ctx, &c_includes,       dl_ctx->c_includes_size );
+	if( !owned )
+	{
+		dl_internal_free_array_copy( &dl_ctx->alloc, type_ids,         dl_ctx->type_ids );
+		dl_internal_free_array_copy( &dl_ctx->alloc, type_descs,       dl_ctx->type_descs );
+		dl_internal_free_array_copy( &dl_ctx->alloc, enum_ids,         dl_ctx->enum_ids );
+		dl_internal_free_array_copy( &dl_ctx->alloc, enum_descs,       dl_ctx->enum_descs );
+		dl_internal_free_array_copy( &dl_ctx->alloc, member_descs,     dl_ctx->member_descs );
+		dl_internal_free_array_copy( &dl_ctx->alloc, enum_value_descs, dl_ctx->enum_value_descs );
+		dl_internal_free_array_copy( &dl_ctx->alloc, enum_alias_descs, dl_ctx->enum_alias_descs );
+		dl_internal_free_array_copy( &dl_ctx->alloc, typedata_strings, dl_ctx->typedata_strings );
+		dl_internal_free_array_copy( &dl_ctx->alloc, c_includes,       dl_ctx->c_includes );
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	}
+
+	dl_ctx->type_ids         = type_ids;
+	dl_ctx->type_descs       = type_descs;
+	dl_ctx->enum_ids         = enum_ids;
+	dl_ctx->enum_descs       = enum_descs;
+	dl_ctx->member_descs     = member_descs;
+	dl_ctx->enum_value_descs = enum_value_descs;
+	dl_ctx->enum_alias_descs = enum_alias_descs;
+	dl_ctx->typedata_strings = typedata_strings;
+	dl_ctx->c_includes       = c_includes;
+
+	dl_ctx->borrowed_typelib      = 0x0;
+	dl_ctx->borrowed_typelib_size = 0;
+	return DL_ERROR_OK;
+}
+
 dl_error_t dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size )
 {
+	dl_error_t err = dl_internal_check_not_frozen( dl_ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
 	if(lib_data_size < sizeof(dl_typelib_header))
 		return DL_ERROR_MALFORMED_DATA;
 
@@ -94,6 +274,11 @@ dl_error_t dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* l
 	if( header.id      != DL_TYPELIB_ID )      return DL_ERROR_MALFORMED_DATA;
 	if( header.version != DL_TYPELIB_VERSION ) return DL_ERROR_VERSION_MISMATCH;
 
+	// descriptors are about to be appended to, make sure that ctx own them.
+	err = dl_internal_own_borrowed_type_library( dl_ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
 	size_t types_lookup_offset     = sizeof(dl_typelib_header);
 	size_t enums_lookup_offset     = types_lookup_offset + sizeof( dl_typeid_t ) * header.type_count;
 	size_t types_offset            = enums_lookup_offset + sizeof( dl_typeid_t ) * header.enum_count;
@@ -116,20 +301,7 @@ dl_error_t dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* l
 	dl_ctx->typedata_strings = dl_realloc_array( &dl_ctx->alloc, dl_ctx->typedata_strings, dl_ctx->typedata_strings_size + header.typeinfo_strings_size, dl_ctx->typedata_strings_size );
 	if(header.c_includes_size)
 		dl_ctx->c_includes   = dl_realloc_array( &dl_ctx->alloc, dl_ctx->c_includes,       dl_ctx->c_includes_size + header.c_includes_size,             dl_ctx->c_includes_size );
-	if(header.metadatas_count)
-	{
-		dl_ctx->metadatas    = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadatas,        dl_ctx->metadatas_count + header.metadatas_count,             dl_ctx->metadatas_count );
-		dl_ctx->metadata_infos = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadata_infos, dl_ctx->metadatas_count + header.metadatas_count,             dl_ctx->metadatas_count );
-		dl_ctx->metadata_typeinfos = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadata_typeinfos, dl_ctx->metadatas_count + header.metadatas_count,     dl_ctx->metadatas_count );
-		for( unsigned int i = 0; i < header.metadatas_count; ++i )
-		{
-			uint32_t metadata_offset              = *reinterpret_cast<const uint32_t*>( lib_data + metadatas_offset + i * sizeof( uint32_t ) );
-			metadata_offset                       = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_offset ) : metadata_offset;
-			const dl_data_header* metadata_header = reinterpret_cast<const dl_data_header*>( lib_data + metadatas_offset + header.metadatas_count * sizeof( uint32_t ) + metadata_offset );
-			size_t instance_size                  = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->instance_size ) : metadata_header->instance_size;
-			dl_ctx->metadatas[dl_ctx->metadatas_count + i] = dl_alloc( &dl_ctx->alloc, instance_size + sizeof( dl_data_header ) );
-		}
-	}
+	dl_internal_alloc_type_library_metadatas( dl_ctx, &header, lib_data + metadatas_offset );
 
 	memcpy( dl_ctx->type_ids         + dl_ctx->type_count,            lib_data + types_lookup_offset, sizeof( dl_typeid_t ) * header.type_count );
 	memcpy( dl_ctx->enum_ids         + dl_ctx->enum_count,            lib_data + enums_lookup_offset, sizeof( dl_typeid_t ) * header.enum_count );
@@ -217,29 +389,125 @@ dl_error_t dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* l
 	dl_ctx->typedata_strings_cap  = dl_ctx->typedata_strings_size;
 	dl_ctx->c_includes_cap        = dl_ctx->c_includes_size;
 
-	// The types used for meta data must be known to be able to patch the data with dl_instance_load_inplace
-	for( unsigned int i = 0; i < header.metadatas_count; ++i )
+	dl_internal_build_lookups( dl_ctx );
+	dl_internal_build_plans( dl_ctx );
+
+	err = dl_internal_load_type_library_metadatas( dl_ctx, &header, lib_data + metadatas_offset );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	dl_internal_load_type_library_defaults( dl_ctx, lib_data + defaults_offset, header.default_value_size );
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_context_load_type_library_inplace( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size )
+{
+	dl_error_t err = dl_internal_check_not_frozen( dl_ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	// descriptors can only be used as is if no fixup is needed, i.e. no other type library is loaded and no endian-swap is needed.
+	if( DL_ENDIAN_HOST == DL_ENDIAN_BIG ||
+		dl_ctx->type_count != 0 || dl_ctx->enum_count != 0 || dl_ctx->member_count != 0 ||
+		dl_ctx->enum_value_count != 0 || dl_ctx->enum_alias_count != 0 ||
+		dl_ctx->typedata_strings_size != 0 || dl_ctx->c_includes_size != 0 ||
+		dl_ctx->metadatas_count != 0 || dl_ctx->default_data_size != 0 )
+		return dl_context_load_type_library( dl_ctx, lib_data, lib_data_size );
+
+	if(lib_data_size < sizeof(dl_typelib_header))
+		return DL_ERROR_MALFORMED_DATA;
+
+	dl_typelib_header header;
+	dl_internal_read_typelibrary_header(&header, lib_data);
+
+	if( header.id      != DL_TYPELIB_ID )      return DL_ERROR_MALFORMED_DATA;
+	if( header.version != DL_TYPELIB_VERSION ) return DL_ERROR_VERSION_MISMATCH;
+
+	size_t types_lookup_offset     = sizeof(dl_typelib_header);
+	size_t enums_lookup_offset     = types_lookup_offset + sizeof( dl_typeid_t ) * header.type_count;
+	size_t types_offset            = enums_lookup_offset + sizeof( dl_typeid_t ) * header.enum_count;
+	size_t enums_offset            = types_offset        + sizeof( dl_type_desc ) * header.type_count;
+	size_t members_offset          = enums_offset        + sizeof( dl_enum_desc ) * header.enum_count;
+	size_t enum_values_offset      = members_offset      + sizeof( dl_member_desc ) * header.member_count;
+	size_t enum_aliases_offset     = enum_values_offset  + sizeof( dl_enum_value_desc ) * header.enum_value_count;
+	size_t defaults_offset         = enum_aliases_offset + sizeof( dl_enum_alias_desc ) * header.enum_alias_count;
+	size_t typedata_strings_offset = defaults_offset + header.default_value_size;
+	size_t c_includes_offset       = typedata_strings_offset + header.typeinfo_strings_size;
+	size_t metadatas_offset        = c_includes_offset + header.c_includes_size;
+
+	if( lib_data_size < metadatas_offset )
+		return DL_ERROR_MALFORMED_DATA;
+
+	dl_typeid_t*        type_ids         = 0x0;
+	dl_typeid_t*        enum_ids         = 0x0;
+	dl_type_desc*       type_descs       = 0x0;
+	dl_enum_desc*       enum_descs       = 0x0;
+	dl_member_desc*     member_descs     = 0x0;
+	dl_enum_value_desc* enum_value_descs = 0x0;
+	dl_enum_alias_desc* enum_alias_descs = 0x0;
+	char*               typedata_strings = 0x0;
+	char*               c_includes       = 0x0;
+
+	bool borrowed = dl_internal_borrow_array( &dl_ctx->alloc, lib_data + types_lookup_offset,     header.type_count,            &type_ids ) &&
+					dl_internal_borrow_array( &dl_ctx->alloc, lib_data + enums_lookup_offset,     header.enum_count,            &enum_ids ) &&
+					dl_internal_borrow_array( &dl_ctx->alloc, lib_data + types_offset,            header.type_count,            &type_descs ) &&
+					dl_internal_borrow_array( &dl_ctx->alloc, lib_data + enums_offset,            header.enum_count,            &enum_descs ) &&
+					dl_internal_borrow_array( &dl_ctx->alloc, lib_data + members_offset,          header.member_count,          &member_descs ) &&
+					dl_internal_borrow_array( &dl_ctx->alloc, lib_data + enum_values_offset,      header.enum_value_count,      &enum_value_descs ) &&
+					dl_internal_borrow_array( &dl_ctx->alloc, lib_data + enum_aliases_offset,     header.enum_alias_count,      &enum_alias_descs ) &&
+					dl_internal_borrow_array( &dl_ctx->alloc, lib_data + typedata_strings_offset, header.typeinfo_strings_size, &typedata_strings ) &&
+					dl_internal_borrow_array( &dl_ctx->alloc, lib_data + c_includes_offset,       header.c_includes_size,       &c_includes );
+	if( !borrowed )
 	{
-		uint32_t metadata_offset              = *reinterpret_cast<const uint32_t*>( lib_data + metadatas_offset + i * sizeof( uint32_t ) );
-		metadata_offset                       = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_offset ) : metadata_offset;
-		const dl_data_header* metadata_header = reinterpret_cast<const dl_data_header*>( lib_data + metadatas_offset + header.metadatas_count * sizeof( uint32_t ) + metadata_offset );
-		size_t instance_size                  = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->instance_size ) : metadata_header->instance_size;
-		memcpy( dl_ctx->metadatas[dl_ctx->metadatas_count + i], metadata_header, instance_size + sizeof( dl_data_header ) );
-		dl_typeid_t type_id = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->root_instance_type ) : metadata_header->root_instance_type;
-		void* loaded_instance;
-		size_t consumed;
-		dl_error_t err = dl_instance_load_inplace( dl_ctx, type_id, (uint8_t*)dl_ctx->metadatas[dl_ctx->metadatas_count + i], instance_size + sizeof( dl_data_header ), &loaded_instance, &consumed );
-		if( err != DL_ERROR_OK )
-		{
-			return err;
-		}
-		DL_ASSERT( instance_size + sizeof( dl_data_header ) == consumed );
-		dl_ctx->metadata_infos[dl_ctx->metadatas_count + i] = loaded_instance;
-		dl_ctx->metadata_typeinfos[dl_ctx->metadatas_count + i] = type_id;
+		dl_internal_free_array_copy( &dl_ctx->alloc, type_ids,         lib_data + types_lookup_offset );
+		dl_internal_free_array_copy( &dl_ctx->alloc, enum_ids,         lib_data + enums_lookup_offset );
+		dl_internal_free_array_copy( &dl_ctx->alloc, type_descs,       lib_data + types_offset );
+		dl_internal_free_array_copy( &dl_ctx->alloc, enum_descs,       lib_data + enums_offset );
+		dl_internal_free_array_copy( &dl_ctx->alloc, member_descs,     lib_data + members_offset );
+		dl_internal_free_array_copy( &dl_ctx->alloc, enum_value_descs, lib_data + enum_values_offset );
+		dl_internal_free_array_copy( &dl_ctx->alloc, enum_alias_descs, lib_data + enum_aliases_offset );
+		dl_internal_free_array_copy( &dl_ctx->alloc, typedata_strings, lib_data + typedata_strings_offset );
+		dl_internal_free_array_copy( &dl_ctx->alloc, c_includes,       lib_data + c_includes_offset );
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
 	}
 
-	dl_ctx->metadatas_count       += header.metadatas_count;
-	dl_ctx->metadatas_cap         = dl_ctx->metadatas_count;
+	dl_ctx->borrowed_typelib      = lib_data;
+	dl_ctx->borrowed_typelib_size = lib_data_size;
+
+	dl_ctx->type_ids         = type_ids;
+	dl_ctx->enum_ids         = enum_ids;
+	dl_ctx->type_descs       = type_descs;
+	dl_ctx->enum_descs       = enum_descs;
+	dl_ctx->member_descs     = member_descs;
+	dl_ctx->enum_value_descs = enum_value_descs;
+	dl_ctx->enum_alias_descs = enum_alias_descs;
+	dl_ctx->typedata_strings = typedata_strings;
+	dl_ctx->c_includes       = c_includes;
+
+	dl_ctx->type_count            = header.type_count;
+	dl_ctx->enum_count            = header.enum_count;
+	dl_ctx->member_count          = header.member_count;
+	dl_ctx->enum_value_count      = header.enum_value_count;
+	dl_ctx->enum_alias_count      = header.enum_alias_count;
+	dl_ctx->typedata_strings_size = header.typeinfo_strings_size;
+	dl_ctx->c_includes_size       = header.c_includes_size;
+
+	dl_ctx->type_capacity         = dl_ctx->type_count;
+	dl_ctx->enum_capacity         = dl_ctx->enum_count;
+	dl_ctx->member_capacity       = dl_ctx->member_count;
+	dl_ctx->enum_value_capacity   = dl_ctx->enum_value_count;
+	dl_ctx->enum_alias_capacity   = dl_ctx->enum_alias_count;
+	dl_ctx->typedata_strings_cap  = dl_ctx->typedata_strings_size;
+	dl_ctx->c_includes_cap        = dl_ctx->c_includes_size;
+
+	dl_internal_build_lookups( dl_ctx );
+	dl_internal_build_plans( dl_ctx );
+
+	// metadata instances need to be patched so they are always copied.
+	dl_internal_alloc_type_library_metadatas( dl_ctx, &header, lib_data + metadatas_offset );
+	err = dl_internal_load_type_library_metadatas( dl_ctx, &header, lib_data + metadatas_offset );
+	if( err != DL_ERROR_OK )
+		return err;
 
 	dl_internal_load_type_library_defaults( dl_ctx, lib_data + defaults_offset, header.default_value_size );
 	return DL_ERROR_OK;
@@ -207,7 +207,7 @@ static const dl_builtin_type* dl_find_builtin_type( const char* name )
 }
 
 dl_type_t dl_make_type( dl_type_atom_t atom, dl_type_storage_t storage );
-dl_error_t dl_txt_pack_internal( dl_ctx_t dl_ctx, const char* txt_instance, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes, bool use_fast_ptr_patch );
+dl_error_t dl_txt_pack_internal( dl_ctx_t dl_ctx, const char* txt_instance, size_t txt_instance_len, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes, bool use_fast_ptr_patch );
 
 struct SScopedPointer
 {
@@ -263,7 +263,7 @@ static void dl_load_txt_build_default_data( dl_ctx_t ctx, dl_txt_read_ctx* read_
 
 	size_t prod_bytes;
 	dl_error_t err;
-	err = dl_txt_pack( ctx, def_buffer_ptr, 0x0, 0, &prod_bytes );
+	err = dl_txt_pack_ex( ctx, def_buffer_ptr, (size_t)wanted_length, 0x0, 0, &prod_bytes );
 	if( err != DL_ERROR_OK )
 		dl_txt_read_failed( ctx, read_state, DL_ERROR_INVALID_DEFAULT_VALUE, "failed to pack default-value for member \"%s\" with error \"%s\"",
 															dl_internal_member_name( ctx, member ),
@@ -272,7 +272,7 @@ static void dl_load_txt_build_default_data( dl_ctx_t ctx, dl_txt_read_ctx* read_
 	uint8_t* pack_buffer = (uint8_t*)dl_alloc( &ctx->alloc, prod_bytes );
 
 	bool use_fast_ptr_patch = false;
-	err = dl_txt_pack_internal( ctx, def_buffer_ptr, pack_buffer, prod_bytes, 0x0, use_fast_ptr_patch );
+	err = dl_txt_pack_internal( ctx, def_buffer_ptr, (size_t)wanted_length, pack_buffer, prod_bytes, 0x0, use_fast_ptr_patch );
 	if( err != DL_ERROR_OK )
 		dl_txt_read_failed( ctx, read_state, DL_ERROR_INVALID_DEFAULT_VALUE, "failed to pack default-value for member \"%s\" with error \"%s\"",
 															dl_internal_member_name( ctx, member ),
@@ -561,17 +561,16 @@ static void dl_context_create_metadata( dl_ctx_t ctx, dl_txt_read_ctx* read_stat
 {
 	char** start_end = (char**)*metadata;
 	read_state->iter = start_end[0];
-	char last_char = *start_end[1];
-	*start_end[1] = '\0';
+	size_t metadata_len = (size_t)( start_end[1] - start_end[0] );
 
 	size_t instance_size;
-	dl_error_t err = dl_txt_pack_calc_size(ctx, read_state->iter, &instance_size);
+	dl_error_t err = dl_txt_pack_ex(ctx, read_state->iter, metadata_len, 0x0, 0, &instance_size);
 	if (err != DL_ERROR_OK)
 		dl_txt_read_failed(ctx, read_state, err, "Failed to parse metadata");
 	uint8_t* instance = (uint8_t*)dl_alloc(&ctx->alloc, instance_size);
 
 	size_t produced_bytes;
-	err = dl_txt_pack(ctx, read_state->iter, instance, instance_size, &produced_bytes);
+	err = dl_txt_pack_ex(ctx, read_state->iter, metadata_len, instance, instance_size, &produced_bytes);
 	if (err != DL_ERROR_OK)
 		dl_txt_read_failed(ctx, read_state, err, "Failed to parse metadata");
 	DL_ASSERT( instance_size == produced_bytes );
@@ -589,7 +588,6 @@ static void dl_context_create_metadata( dl_ctx_t ctx, dl_txt_read_ctx* read_stat
 	ctx->metadata_infos[meta_index] = loaded_instance;
 	ctx->metadata_typeinfos[meta_index] = metadata_header->root_instance_type;
 
-	*start_end[1] = last_char;
 	dl_free( &ctx->alloc, *metadata );
 	*metadata = (void*)instance;
 }
@@ -654,6 +652,8 @@ static void dl_context_load_txt_type_library_read_metadata( dl_ctx_t ctx,
 		range[0]           = read_state->iter;
 		read_state->iter   = dl_txt_skip_map( read_state->iter, read_state->end );
 		range[1]           = read_state->iter;
+		if( range[1] < range[0] || range[1] > read_state->end )
+			dl_txt_read_failed( ctx, read_state, DL_ERROR_MALFORMED_DATA, "metadata is not a valid map" );
 	} while( dl_txt_try_eat_char( read_state, ',' ) );
 	dl_txt_eat_char( ctx, read_state, ']' );
 	meta_data_record[0] = (uint32_t) (ctx->metadatas_count - meta_data_record[1]);
@@ -1398,12 +1398,13 @@ static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ct
 			}
 		}
 
-		for( uint32_t member_index = member_start; member_index < ctx->member_count; ++member_index )
-			dl_load_txt_build_default_data( ctx, read_state, member_index );
-
+		// ... flags has to be set before default-values are packed, the packer lays out arrays of structs depending on them ...
 		for( unsigned int i = type_start; i < ctx->type_count; ++i )
 			dl_context_load_txt_type_set_flags( ctx, read_state, ctx->type_descs + i );
 
+		for( uint32_t member_index = member_start; member_index < ctx->member_count; ++member_index )
+			dl_load_txt_build_default_data( ctx, read_state, member_index );
+
 		for( unsigned int i = metadata_start; i < ctx->metadatas_count; ++i )
 			dl_context_create_metadata(ctx, read_state, ctx->metadatas + i);
 	}
@@ -1417,13 +1418,27 @@ dl_error_t dl_context_load_txt_type_library( dl_ctx_t ctx, const char* lib_data,
 {
 	(void)lib_data_size;
 
+	dl_error_t err = dl_internal_check_not_frozen( ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
 	dl_txt_read_ctx read_state;
-	read_state.start = lib_data;
-	read_state.end   = lib_data + lib_data_size;
-	read_state.iter  = lib_data;
-	read_state.err   = DL_ERROR_OK;
+	read_state.start  = lib_data;
+	read_state.end    = lib_data + lib_data_size;
+	read_state.iter   = lib_data;
+	read_state.pin    = 0x0;
+	read_state.stream = 0x0;
+	read_state.err    = DL_ERROR_OK;
+
+	// descriptors are about to be appended to, make sure that ctx own them.
+	err = dl_internal_own_borrowed_type_library( ctx );
+	if( err != DL_ERROR_OK )
+		return err;
 
 	dl_context_load_txt_type_library_inner( ctx, &read_state );
+	dl_internal_build_lookups( ctx );
+	if( read_state.err == DL_ERROR_OK )
+		dl_internal_build_plans( ctx );
 
 	return read_state.err;
 }
@@ -37,7 +37,11 @@ dl_error_t dl_context_write_type_library( dl_ctx_t dl_ctx, unsigned char* out_li
 	{
 		dl_binary_writer_write_uint32( &writer, metadata_offset );
 		const dl_data_header* metadata_header = (const dl_data_header*)dl_ctx->metadatas[i];
-		metadata_offset                       = metadata_offset + uint32_t( metadata_header->instance_size + sizeof( dl_data_header ) );
+		size_t size;
+		dl_error_t err = dl_instance_calc_size( dl_ctx, metadata_header->root_instance_type, (void*)(metadata_header + 1), &size );
+		if( DL_ERROR_OK != err )
+			return err;
+		metadata_offset = metadata_offset + uint32_t( size );
 	}
 	for( unsigned int i = 0; i < dl_ctx->metadatas_count; ++i )
 	{
@@ -202,6 +202,16 @@ static void dl_context_write_c_header_begin( dl_binary_writer* writer, const cha
 									   "           uint32_t count; \\\n"
 									   "       }\n"
 									   "#  endif\n"
+									   "\n"
+									   "   // ... DL_REL_PTR() ...\n"
+									   "   /// Read a pointer-, string- or array-member of an instance stored with relative pointers, see\n"
+									   "   /// dl_instance_make_relative(). The member store the distance in bytes from itself to the data, 0 for null.\n"
+									   "#  define DL_REL_PTR(type, member) ((type)( (intptr_t)(member) == 0 ? 0 : (const char*)&(member) + (intptr_t)(member) ))\n"
+									   "\n"
+									   "   // ... DL_VIEW_PTR() ...\n"
+									   "   /// Read a pointer-, string- or array-member of a packed instance that is not loaded, see dl_view_instance(). The\n"
+									   "   /// member store the offset in bytes from the start of the packed instance to the data, 0 for null.\n"
+									   "#  define DL_VIEW_PTR(type, packed_instance, member) ((type)( (uintptr_t)(member) == 0 ? 0 : (const unsigned char*)(packed_instance) + (uintptr_t)(member) ))\n"
 									   "#endif // __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED\n\n" );
 }
 
@@ -681,6 +691,293 @@ static dl_error_t dl_context_write_c_header_member( dl_binary_writer* writer, dl
 	return DL_ERROR_OK;
 }
 
+/**
+ * Write the const-qualified type returned by the relative pointer accessors for a str- or ptr-member.
+ */
+static dl_error_t dl_context_write_rel_ptr_type( dl_ctx_t ctx, dl_type_storage_t storage, dl_typeid_t tid, dl_binary_writer* writer )
+{
+	if( storage == DL_TYPE_STORAGE_STR )
+	{
+		dl_binary_writer_write_string_fmt( writer, "const char*" );
+		return DL_ERROR_OK;
+	}
+	dl_binary_writer_write_string_fmt( writer, "const " );
+	return dl_context_write_type( ctx, storage, tid, writer );
+}
+
+/**
+ * Write functions to read members with pointers in an instance stored with relative pointers, <type>_rel_<member>.
+ */
+static dl_error_t dl_context_write_c_header_rel_accessors( dl_binary_writer* writer, dl_ctx_t ctx, const dl_type_info_t* type, const dl_member_info_t* members )
+{
+	const char* value = type->is_union ? "value." : "";
+	for( unsigned int member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_info_t* member = &members[member_index];
+		if( member->storage != DL_TYPE_STORAGE_STR && member->storage != DL_TYPE_STORAGE_PTR && member->atom != DL_TYPE_ATOM_ARRAY )
+			continue;
+
+		dl_error_t err = DL_ERROR_OK;
+		switch( member->atom )
+		{
+			case DL_TYPE_ATOM_POD:
+				// const char* / const struct sub*
+				dl_binary_writer_write_string_fmt( writer, "static inline " );
+				if( DL_ERROR_OK != ( err = dl_context_write_rel_ptr_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+				dl_binary_writer_write_string_fmt( writer, " %s_rel_%s( const struct %s* s ) { return DL_REL_PTR( ", type->name, member->name, type->name );
+				if( DL_ERROR_OK != ( err = dl_context_write_rel_ptr_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+				dl_binary_writer_write_string_fmt( writer, ", s->%s%s ); }\n", value, member->name );
+				break;
+
+			case DL_TYPE_ATOM_INLINE_ARRAY:
+				dl_binary_writer_write_string_fmt( writer, "static inline " );
+				if( DL_ERROR_OK != ( err = dl_context_write_rel_ptr_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+				dl_binary_writer_write_string_fmt( writer, " %s_rel_%s( const struct %s* s, uint32_t i ) { return DL_REL_PTR( ", type->name, member->name, type->name );
+				if( DL_ERROR_OK != ( err = dl_context_write_rel_ptr_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+				dl_binary_writer_write_string_fmt( writer, ", s->%s%s[i] ); }\n", value, member->name );
+				break;
+
+			case DL_TYPE_ATOM_ARRAY:
+				if( member->storage == DL_TYPE_STORAGE_STR || member->storage == DL_TYPE_STORAGE_PTR )
+				{
+					// ... each element is relative to itself ...
+					dl_binary_writer_write_string_fmt( writer, "static inline " );
+					if( DL_ERROR_OK != ( err = dl_context_write_rel_ptr_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+					dl_binary_writer_write_string_fmt( writer, " %s_rel_%s( const struct %s* s, uint32_t i ) { ", type->name, member->name, type->name );
+					if( DL_ERROR_OK != ( err = dl_context_write_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+					dl_binary_writer_write_string_fmt( writer, " const* data = DL_REL_PTR( " );
+					if( DL_ERROR_OK != ( err = dl_context_write_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+					dl_binary_writer_write_string_fmt( writer, " const*, s->%s%s.data ); return DL_REL_PTR( ", value, member->name );
+					if( DL_ERROR_OK != ( err = dl_context_write_rel_ptr_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+					dl_binary_writer_write_string_fmt( writer, ", data[i] ); }\n" );
+				}
+				else
+				{
+					dl_binary_writer_write_string_fmt( writer, "static inline const " );
+					if( DL_ERROR_OK != ( err = dl_context_write_operator_array_access_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+					dl_binary_writer_write_string_fmt( writer, "* %s_rel_%s( const struct %s* s ) { return DL_REL_PTR( const ", type->name, member->name, type->name );
+					if( DL_ERROR_OK != ( err = dl_context_write_operator_array_access_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+					dl_binary_writer_write_string_fmt( writer, "*, s->%s%s.data ); }\n", value, member->name );
+				}
+				break;
+
+			default:
+				break;
+		}
+	}
+	return DL_ERROR_OK;
+}
+
+/**
+ * Write the type returned by a view-accessor for a value of storage, structs and pointers to structs are returned
+ * as <type>_view unless the type is extern.
+ */
+static dl_error_t dl_context_write_view_type( dl_ctx_t ctx, dl_type_storage_t storage, dl_typeid_t tid, dl_binary_writer* writer )
+{
+	if( storage != DL_TYPE_STORAGE_STRUCT && storage != DL_TYPE_STORAGE_PTR )
+		return dl_context_write_operator_array_access_type( ctx, storage, tid, writer );
+
+	dl_type_info_t sub_type;
+	dl_error_t err = dl_reflect_get_type_info( ctx, tid, &sub_type );
+	if (DL_ERROR_OK != err) return err;
+	if( !sub_type.is_extern )
+		dl_binary_writer_write_string_fmt( writer, "%s_view", sub_type.name );
+	else if( storage == DL_TYPE_STORAGE_STRUCT )
+		dl_binary_writer_write_string_fmt( writer, "const struct %s&", sub_type.name );
+	else
+		dl_binary_writer_write_string_fmt( writer, "const struct %s*", sub_type.name );
+	return DL_ERROR_OK;
+}
+
+/**
+ * Write the return-statement of a view-accessor around the expression reading the value from the packed instance,
+ * i.e. the value itself is written between dl_context_write_view_value_begin() and dl_context_write_view_value_end().
+ */
+static dl_error_t dl_context_write_view_value_begin( dl_ctx_t ctx, dl_type_storage_t storage, dl_typeid_t tid, dl_binary_writer* writer )
+{
+	dl_binary_writer_write_string_fmt( writer, "return " );
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STR:
+			dl_binary_writer_write_string_fmt( writer, "DL_VIEW_PTR( const char*, dl_packed_instance, " );
+			return DL_ERROR_OK;
+		case DL_TYPE_STORAGE_STRUCT:
+		case DL_TYPE_STORAGE_PTR:
+		{
+			dl_type_info_t sub_type;
+			dl_error_t err = dl_reflect_get_type_info( ctx, tid, &sub_type );
+			if (DL_ERROR_OK != err) return err;
+			if( !sub_type.is_extern )
+				dl_binary_writer_write_string_fmt( writer, "%s_view{ dl_packed_instance, ", sub_type.name );
+			if( storage == DL_TYPE_STORAGE_PTR )
+				dl_binary_writer_write_string_fmt( writer, "DL_VIEW_PTR( const struct %s*, dl_packed_instance, ", sub_type.name );
+			else if( !sub_type.is_extern )
+				dl_binary_writer_write_string_fmt( writer, "&" );
+			return DL_ERROR_OK;
+		}
+		default:
+			return DL_ERROR_OK;
+	}
+}
+
+static dl_error_t dl_context_write_view_value_end( dl_ctx_t ctx, dl_type_storage_t storage, dl_typeid_t tid, dl_binary_writer* writer )
+{
+	if( storage == DL_TYPE_STORAGE_STR || storage == DL_TYPE_STORAGE_PTR )
+		dl_binary_writer_write_string_fmt( writer, " )" );
+	if( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR )
+	{
+		dl_type_info_t sub_type;
+		dl_error_t err = dl_reflect_get_type_info( ctx, tid, &sub_type );
+		if (DL_ERROR_OK != err) return err;
+		if( !sub_type.is_extern )
+			dl_binary_writer_write_string_fmt( writer, " }" );
+	}
+	dl_binary_writer_write_string_fmt( writer, "; }\n" );
+	return DL_ERROR_OK;
+}
+
+/**
+ * Write the view-accessor for one member, the declaration in the view-struct if type_name is 0x0, otherwise the
+ * definition outside of it. Accessors returning another view can't be defined in the view-struct as that view
+ * might not be defined yet, so only those are defined outside of it.
+ * Accessors of union-members that resolve pointers or return views return an empty value if the member is not the
+ * one set, as the data of another member would be read as offsets.
+ */
+static dl_error_t dl_context_write_c_header_view_accessor( dl_binary_writer* writer, dl_ctx_t ctx, const dl_type_info_t* type, const dl_member_info_t* member, const char* type_name )
+{
+	const char* value = type->is_union ? "value." : "";
+
+	bool out_of_struct = false;
+	if( member->storage == DL_TYPE_STORAGE_STRUCT || member->storage == DL_TYPE_STORAGE_PTR )
+	{
+		dl_type_info_t sub_type;
+		dl_error_t err = dl_reflect_get_type_info( ctx, member->type_id, &sub_type );
+		if (DL_ERROR_OK != err) return err;
+		out_of_struct = !sub_type.is_extern;
+	}
+	if( type_name != 0x0 && !out_of_struct )
+		return DL_ERROR_OK;
+
+	bool check_type = type->is_union && ( out_of_struct ||
+										  member->storage == DL_TYPE_STORAGE_STR ||
+										  member->storage == DL_TYPE_STORAGE_PTR ||
+										  member->atom == DL_TYPE_ATOM_ARRAY );
+
+	dl_error_t err = DL_ERROR_OK;
+	if( type_name == 0x0 && member->atom == DL_TYPE_ATOM_INLINE_ARRAY )
+		dl_binary_writer_write_string_fmt( writer, "    uint32_t %s_count() const { return %u; }\n", member->name, member->array_count );
+	if( type_name == 0x0 && member->atom == DL_TYPE_ATOM_ARRAY )
+	{
+		if( check_type )
+			dl_binary_writer_write_string_fmt( writer, "    uint32_t %s_count() const { return dl_data->type == %s_type_%s ? dl_data->%s%s.count : 0; }\n", member->name, type->name, member->name, value, member->name );
+		else
+			dl_binary_writer_write_string_fmt( writer, "    uint32_t %s_count() const { return dl_data->%s%s.count; }\n", member->name, value, member->name );
+	}
+
+	dl_binary_writer_write_string_fmt( writer, type_name ? "inline " : "    " );
+	if( member->atom == DL_TYPE_ATOM_BITFIELD )
+		err = dl_context_write_operator_array_access_type( ctx, member->storage, member->type_id, writer );
+	else
+		err = dl_context_write_view_type( ctx, member->storage, member->type_id, writer );
+	if (DL_ERROR_OK != err) return err;
+
+	if( type_name )
+		dl_binary_writer_write_string_fmt( writer, " %s_view::%s(", type_name, member->name );
+	else
+		dl_binary_writer_write_string_fmt( writer, " %s(", member->name );
+	dl_binary_writer_write_string_fmt( writer, member->atom == DL_TYPE_ATOM_ARRAY || member->atom == DL_TYPE_ATOM_INLINE_ARRAY ? " uint32_t i ) const" : ") const" );
+
+	if( type_name == 0x0 && out_of_struct )
+	{
+		dl_binary_writer_write_string_fmt( writer, ";\n" );
+		return DL_ERROR_OK;
+	}
+
+	dl_binary_writer_write_string_fmt( writer, " { " );
+	if( check_type )
+		dl_binary_writer_write_string_fmt( writer, "if( dl_data->type != %s_type_%s ) return {}; ", type->name, member->name );
+	if( member->atom == DL_TYPE_ATOM_BITFIELD )
+	{
+		dl_binary_writer_write_string_fmt( writer, "return dl_data->%s%s; }\n", value, member->name );
+		return DL_ERROR_OK;
+	}
+
+	if( DL_ERROR_OK != ( err = dl_context_write_view_value_begin( ctx, member->storage, member->type_id, writer ) ) ) return err;
+	switch( member->atom )
+	{
+		case DL_TYPE_ATOM_POD:
+			dl_binary_writer_write_string_fmt( writer, "dl_data->%s%s", value, member->name );
+			break;
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			dl_binary_writer_write_string_fmt( writer, "dl_data->%s%s[i]", value, member->name );
+			break;
+		case DL_TYPE_ATOM_ARRAY:
+			dl_binary_writer_write_string_fmt( writer, "DL_VIEW_PTR( " );
+			if( DL_ERROR_OK != ( err = dl_context_write_operator_array_access_type( ctx, member->storage, member->type_id, writer ) ) ) return err;
+			dl_binary_writer_write_string_fmt( writer, " const*, dl_packed_instance, dl_data->%s%s.data )[i]", value, member->name );
+			break;
+		default:
+			DL_ASSERT( false );
+	}
+	return dl_context_write_view_value_end( ctx, member->storage, member->type_id, writer );
+}
+
+/**
+ * Write read-only C++ views of all types, <type>_view, that resolve pointers in a packed instance that is not loaded
+ * when members are read. See dl_view_instance().
+ */
+static dl_error_t dl_context_write_c_header_views( dl_binary_writer* writer, dl_ctx_t ctx, const dl_type_info_t* type_info, unsigned int type_count )
+{
+	dl_binary_writer_write_string_fmt( writer, "#if defined( __cplusplus )\n"
+											   "//----------------------------------------------\n"
+											   "//                   VIEWS                      \n"
+											   "//----------------------------------------------\n\n"
+											   "// Read-only views of a packed instance that is not loaded, pointers are resolved when read. Create the view\n"
+											   "// of the root instance from a dl_view_t returned by dl_view_instance(), { view.packed_instance, (const T*)view.data }.\n\n" );
+
+	for( unsigned int type_index = 0; type_index < type_count; ++type_index )
+		if( !type_info[type_index].is_extern )
+			dl_binary_writer_write_string_fmt( writer, "struct %s_view;\n", type_info[type_index].name );
+	dl_binary_writer_write_string_fmt( writer, "\n" );
+
+	for( int pass = 0; pass < 2; ++pass )
+	{
+		for( unsigned int type_index = 0; type_index < type_count; ++type_index )
+		{
+			const dl_type_info_t* type = &type_info[type_index];
+			if( type->is_extern )
+				continue;
+
+			dl_member_info_t* members = (dl_member_info_t*)malloc( type->member_count * sizeof(dl_member_info_t) );
+			DL_DEFER( { free( members ); } );
+			dl_error_t err = dl_reflect_get_type_members( ctx, type->tid, members, type->member_count );
+			if (DL_ERROR_OK != err) return err;
+
+			// ... first pass write the view-structs, second pass the accessors returning views ...
+			if( pass == 0 )
+				dl_binary_writer_write_string_fmt( writer, "struct %s_view\n"
+														   "{\n"
+														   "    const unsigned char* dl_packed_instance;\n"
+														   "    const struct %s* dl_data;\n\n"
+														   "    explicit operator bool() const { return dl_data != 0; }\n", type->name, type->name );
+			if( pass == 0 && type->is_union )
+				dl_binary_writer_write_string_fmt( writer, "    enum %s_type type() const { return dl_data->type; }\n", type->name );
+
+			for( unsigned int member_index = 0; member_index < type->member_count; ++member_index )
+			{
+				err = dl_context_write_c_header_view_accessor( writer, ctx, type, &members[member_index], pass == 0 ? 0x0 : type->name );
+				if (DL_ERROR_OK != err) return err;
+			}
+
+			if( pass == 0 )
+				dl_binary_writer_write_string_fmt( writer, "};\n\n" );
+		}
+	}
+
+	dl_binary_writer_write_string_fmt( writer, "\n#endif // defined( __cplusplus )\n\n" );
+	return DL_ERROR_OK;
+}
+
 static dl_error_t dl_context_write_c_header_types( dl_binary_writer* writer, dl_ctx_t ctx )
 {
 	dl_type_context_info_t ctx_info;
@@ -843,9 +1140,15 @@ static dl_error_t dl_context_write_c_header_types( dl_binary_writer* writer, dl_
 		}
 
 		dl_binary_writer_write_string_fmt( writer, "};\n\n" );
+
+		size_t accessors_start = dl_binary_writer_tell( writer );
+		err = dl_context_write_c_header_rel_accessors( writer, ctx, type, members );
+		if (DL_ERROR_OK != err) return err;
+		if( dl_binary_writer_tell( writer ) != accessors_start )
+			dl_binary_writer_write_string_fmt( writer, "\n" );
 	}
 
-	return DL_ERROR_OK;
+	return dl_context_write_c_header_views( writer, ctx, type_info, ctx_info.num_types );
 }
 
 dl_error_t dl_context_write_type_library_c_header( dl_ctx_t dl_ctx, const char* module_name, char* out_header, size_t out_header_size, size_t* produced_bytes )
@@ -48,8 +48,10 @@
 #endif
 
 static const uint32_t DL_UNUSED DL_TYPELIB_VERSION         = 5; // format version for type-libraries.
-static const uint32_t DL_UNUSED DL_INSTANCE_VERSION        = 2; // format version for instances.
+static const uint32_t DL_UNUSED DL_INSTANCE_VERSION        = 3; // format version for instances.
 static const uint32_t DL_UNUSED DL_INSTANCE_VERSION_SWAPED = dl_swap_endian_uint32( DL_INSTANCE_VERSION );
+static const uint32_t DL_UNUSED DL_INSTANCE_VERSION_CHAIN  = 2; // previous format version for instances, pointers patched via a chain stored in the pointers themselves. Still loaded.
+static const uint32_t DL_UNUSED DL_INSTANCE_VERSION_CHAIN_SWAPED = dl_swap_endian_uint32( DL_INSTANCE_VERSION_CHAIN );
 static const uint32_t DL_UNUSED DL_TYPELIB_ID              = ('D'<< 24) | ('L' << 16) | ('T' << 8) | 'L';
 static const uint32_t DL_UNUSED DL_TYPELIB_ID_SWAPED       = dl_swap_endian_uint32( DL_TYPELIB_ID );
 static const uint32_t DL_UNUSED DL_INSTANCE_ID             = ('D'<< 24) | ('L' << 16) | ('D' << 8) | 'L';
@@ -118,10 +120,26 @@ struct dl_data_header
 	uint32_t    instance_size;
 	uint8_t     is_64_bit_ptr; // currently uses uint8 instead of bitfield to be compiler-compliant.
 	uint8_t     not_using_ptr_chain_patching; // currently uses uint8 instead of bitfield to be compiler-compliant.
-	uint8_t     pad[2];
-	uint32_t    first_pointer_to_patch;
+	uint8_t     using_relative_ptrs; // pointers are stored as the distance in bytes from the pointer itself, see dl_instance_make_relative().
+	uint8_t     pad[1];
+	union
+	{
+		uint32_t first_pointer_to_patch; // DL_INSTANCE_VERSION_CHAIN, offset to the first pointer in the pointer-chain.
+		uint32_t patch_table_size;       // DL_INSTANCE_VERSION, size of the patch-table stored directly after the instance.
+	};
 };
 
+/**
+ * Size of a packed instance including header and patch-table, header is expected to be in host endian.
+ */
+static inline size_t dl_internal_packed_instance_size( const dl_data_header* header, size_t header_offset )
+{
+	size_t size = header_offset + header->instance_size;
+	if( header->version == DL_INSTANCE_VERSION )
+		size += header->patch_table_size;
+	return size;
+}
+
 enum dl_ptr_size_t
 {
 	DL_PTR_SIZE_32BIT = 0,
@@ -279,6 +297,59 @@ struct dl_enum_alias_desc
 	uint32_t value_index; ///< index of the value this alias belong to.
 };
 
+/**
+ * Open addressing hash-index from a 32-bit key to an index in a list of descriptors, used to make lookup of
+ * types, enums and members O(1). Indices are (re)built by dl_internal_build_lookups() when a type-library has
+ * been loaded, descriptors added after that are searched linearly until the next rebuild.
+ */
+struct dl_hash_lookup
+{
+	struct slot
+	{
+		uint32_t key;
+		uint32_t index; ///< index of the descriptor that key refers to, UINT32_MAX if slot is unused.
+	};
+
+	slot*    slots;
+	uint32_t mask;  ///< number of slots - 1, number of slots is always a power of 2.
+	uint32_t count; ///< number of descriptors that was indexed when lookup was built.
+};
+
+/**
+ * Operation in a precompiled per-type "plan", see dl_internal_build_plans().
+ */
+enum dl_plan_op_kind
+{
+	DL_PLAN_OP_COPY,   ///< pod-data, copy 'size' bytes at 'offset' as is.
+	DL_PLAN_OP_STR,    ///< 'count' string-pointers starting at 'offset'.
+	DL_PLAN_OP_PTR,    ///< 'count' pointers to 'sub_type' starting at 'offset'.
+	DL_PLAN_OP_STRUCT, ///< 'count' structs of 'sub_type', with stride 'size', that need to be handled one by one (unions).
+	DL_PLAN_OP_ARRAY,  ///< dynamic array at 'offset' with elements of 'storage' with size 'size' and alignment 'align'.
+};
+
+struct dl_plan_op
+{
+	uint8_t  kind;     ///< dl_plan_op_kind
+	uint8_t  storage;  ///< dl_type_storage_t of array elements for DL_PLAN_OP_ARRAY.
+	uint32_t offset;
+	uint32_t count;
+	uint32_t size;
+	uint32_t align;
+	uint32_t sub_type; ///< index of sub-type in type_descs, UINT32_MAX if not used by op.
+};
+
+/**
+ * Flattened list of operations for one type in host ptr-size. Nested structs are inlined in the plan and adjacent
+ * pod-members are merged. All DL_PLAN_OP_COPY ops are placed first so that they can be skipped by operations that
+ * only care about pointers, i.e. patching.
+ */
+struct dl_type_plan
+{
+	uint32_t op_start;   ///< first op in dl_context.plan_ops, UINT32_MAX if there is no plan for the type.
+	uint32_t copy_count; ///< number of DL_PLAN_OP_COPY ops at the start of the plan.
+	uint32_t op_count;
+};
+
 struct dl_context
 {
 	dl_allocator alloc;
@@ -286,6 +357,9 @@ struct dl_context
 	dl_error_msg_handler error_msg_func;
 	void*                error_msg_ctx;
 
+	bool store_merge_strings; ///< merge identical strings in dl_instance_store.
+	bool frozen;              ///< set by dl_context_freeze(), no type libraries can be loaded into ctx.
+
 	unsigned int type_count;
 	unsigned int enum_count;
 	unsigned int member_count;
@@ -302,12 +376,24 @@ struct dl_context
 	dl_typeid_t* type_ids; ///< list of all loaded typeid:s in the same order they appear in type_descs
 	dl_typeid_t* enum_ids; ///< list of all loaded typeid:s for enums in the same order they appear in enum_descs
 
+	dl_hash_lookup type_lookup;      ///< typeid -> index in type_descs.
+	dl_hash_lookup enum_lookup;      ///< typeid -> index in enum_descs.
+	dl_hash_lookup type_name_lookup; ///< hash of type name -> index in type_descs.
+	dl_hash_lookup member_lookup;    ///< hash of member name mixed with the owning types member_start -> index in member_descs.
+
+	dl_type_plan* type_plans;      ///< plan per type in type_descs, see dl_internal_build_plans().
+	unsigned int  type_plan_count; ///< number of types that had plans built, types added after that has no plan.
+	dl_plan_op*   plan_ops;
+
 	dl_type_desc*       type_descs;    ///< list of all loaded descriptors for types.
 	dl_member_desc*     member_descs; ///< list of all loaded descriptors for members in types.
 	dl_enum_desc*       enum_descs;
 	dl_enum_value_desc* enum_value_descs;
 	dl_enum_alias_desc* enum_alias_descs;
 
+	const uint8_t* borrowed_typelib;      ///< typelib passed to dl_context_load_type_library_inplace(), descriptors pointing into this memory is not owned by the ctx.
+	size_t         borrowed_typelib_size;
+
 	char*  typedata_strings;
 	size_t typedata_strings_size;
 	size_t typedata_strings_cap;
@@ -391,8 +477,9 @@ public:
 
 	void Add(const T& _Element)
 	{
+		T el(_Element); // _Element might be an element of this array, copy before growing.
 		GrowIfNeeded();
-		new (&m_Ptr[m_nElements]) T(_Element);
+		new (&m_Ptr[m_nElements]) T(el);
 		m_nElements++;
 	}
 
@@ -441,14 +528,89 @@ inline unsigned int dl_bf_offset( dl_endian_t endian, unsigned int bf_size, unsi
 
 static inline dl_endian_t dl_other_endian( dl_endian_t endian ) { return endian == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE; }
 
+/**
+ * (Re)build all hash-lookups in ctx, should be called when types or enums has been added to the ctx.
+ */
+void dl_internal_build_lookups( dl_ctx_t ctx );
+
+/**
+ * (Re)build store/patch plans for all types in ctx, should be called when types has been added to the ctx.
+ * Types that can not get a plan, unions or types referring to types not yet loaded, will be handled member
+ * by member.
+ */
+void dl_internal_build_plans( dl_ctx_t ctx );
+
+/**
+ * Returns true if ptr points into a type library loaded with dl_context_load_type_library_inplace(), i.e. memory that
+ * is not owned by ctx and that may not be written to.
+ */
+static inline bool dl_internal_is_borrowed( dl_ctx_t ctx, const void* ptr )
+{
+	return (const uint8_t*)ptr >= ctx->borrowed_typelib && (const uint8_t*)ptr < ctx->borrowed_typelib + ctx->borrowed_typelib_size;
+}
+
+/**
+ * Copy all descriptors that is borrowed from a type library loaded with dl_context_load_type_library_inplace() to
+ * memory owned by ctx, should be called before descriptors are modified or added.
+ * Returns DL_ERROR_OUT_OF_LIBRARY_MEMORY, with ctx still borrowing the type library, if the copies can't be allocated.
+ */
+dl_error_t dl_internal_own_borrowed_type_library( dl_ctx_t ctx );
+
+/**
+ * Check that type libraries can be loaded into ctx, i.e. that it is not frozen.
+ */
+static inline dl_error_t dl_internal_check_not_frozen( dl_ctx_t ctx )
+{
+	if( !ctx->frozen )
+		return DL_ERROR_OK;
+	dl_log_error( ctx, "can't load type library into a frozen context" );
+	return DL_ERROR_UNSUPPORTED_OPERATION;
+}
+
+static inline uint32_t dl_internal_lookup_hash( uint32_t key )
+{
+	// keys are usually already hashes, but mix them some more as only the low bits are used.
+	key ^= key >> 16;
+	key *= 0x45d9f3bU;
+	key ^= key >> 16;
+	return key;
+}
+
+static inline uint32_t dl_internal_lookup_member_hash( const dl_type_desc* type, uint32_t name_hash )
+{
+	return dl_internal_lookup_hash( name_hash + type->member_start * 0x9E3779B9U );
+}
+
+static inline uint32_t dl_internal_lookup_typeid( const dl_hash_lookup* lookup, const dl_typeid_t* ids, unsigned int id_count, dl_typeid_t type_id )
+{
+	if( lookup->slots != 0x0 )
+	{
+		for( uint32_t slot = dl_internal_lookup_hash( type_id ) & lookup->mask; lookup->slots[slot].index != UINT32_MAX; slot = ( slot + 1 ) & lookup->mask )
+			if( lookup->slots[slot].key == type_id )
+				return lookup->slots[slot].index;
+	}
+
+	// ids added since the lookup was built, i.e. while loading a txt type library.
+	for( unsigned int i = lookup->count; i < id_count; ++i )
+		if( ids[i] == type_id )
+			return i;
+
+	return UINT32_MAX;
+}
+
 static inline const dl_type_desc* dl_internal_find_type(dl_ctx_t dl_ctx, dl_typeid_t type_id)
 {
-	// linear search right now!
-    for(unsigned int i = 0; i < dl_ctx->type_count; ++i)
-    	if( dl_ctx->type_ids[i] == type_id )
-    		return &dl_ctx->type_descs[i];
+	uint32_t index = dl_internal_lookup_typeid( &dl_ctx->type_lookup, dl_ctx->type_ids, dl_ctx->type_count, type_id );
+	return index == UINT32_MAX ? 0x0 : &dl_ctx->type_descs[index];
+}
 
-    return 0x0;
+static inline const dl_type_plan* dl_internal_type_plan( dl_ctx_t dl_ctx, const dl_type_desc* type )
+{
+	size_t index = (size_t)( type - dl_ctx->type_descs );
+	if( index >= dl_ctx->type_plan_count )
+		return 0x0;
+	const dl_type_plan* plan = &dl_ctx->type_plans[index];
+	return plan->op_start == UINT32_MAX ? 0x0 : plan;
 }
 
 static inline const char* dl_internal_type_name         ( dl_ctx_t ctx, const dl_type_desc*       type   ) { return &ctx->typedata_strings[type->name]; }
@@ -460,28 +622,43 @@ static inline const char* dl_internal_enum_comment      ( dl_ctx_t ctx, const dl
 static inline const char* dl_internal_enum_alias_name   ( dl_ctx_t ctx, const dl_enum_alias_desc* alias  ) { return &ctx->typedata_strings[alias->name]; }
 static inline const char* dl_internal_enum_value_comment( dl_ctx_t ctx, const dl_enum_value_desc* value  ) { return value->comment != UINT32_MAX ? &ctx->typedata_strings[value->comment] : 0x0; }
 
-static inline const dl_type_desc* dl_internal_find_type_by_name( dl_ctx_t dl_ctx, const char* name )
+static inline const dl_type_desc* dl_internal_find_type_by_name( dl_ctx_t dl_ctx, const char* name, size_t name_len )
 {
-	for(unsigned int i = 0; i < dl_ctx->type_count; ++i)
+	const dl_hash_lookup* lookup = &dl_ctx->type_name_lookup;
+	if( lookup->slots != 0x0 )
+	{
+		uint32_t name_hash = dl_internal_hash_buffer( (const uint8_t*)name, name_len );
+		for( uint32_t slot = dl_internal_lookup_hash( name_hash ) & lookup->mask; lookup->slots[slot].index != UINT32_MAX; slot = ( slot + 1 ) & lookup->mask )
+		{
+			if( lookup->slots[slot].key != name_hash )
+				continue;
+
+			dl_type_desc* desc = &dl_ctx->type_descs[lookup->slots[slot].index];
+			const char* t_name = dl_internal_type_name( dl_ctx, desc );
+			if( strncmp( name, t_name, name_len ) == 0 && t_name[name_len] == '\0' )
+				return desc;
+		}
+	}
+
+	// types added since the lookup was built, i.e. while loading a txt type library.
+	for(unsigned int i = lookup->count; i < dl_ctx->type_count; ++i)
 	{
 		dl_type_desc* desc = &dl_ctx->type_descs[i];
-		if( strcmp( name, dl_internal_type_name( dl_ctx, desc ) ) == 0 )
+		const char* t_name = dl_internal_type_name( dl_ctx, desc );
+		if( strncmp( name, t_name, name_len ) == 0 && t_name[name_len] == '\0' )
 			return desc;
 	}
 	return 0x0;
 }
 
+static inline const dl_type_desc* dl_internal_find_type_by_name( dl_ctx_t dl_ctx, const char* name )
+{
+	return dl_internal_find_type_by_name( dl_ctx, name, strlen( name ) );
+}
+
 static inline const dl_type_desc* dl_internal_find_type_by_name( dl_ctx_t dl_ctx, const dl_substr* name )
 {
-	for(unsigned int i = 0; i < dl_ctx->type_count; ++i)
-	{
-		dl_type_desc* desc = &dl_ctx->type_descs[i];
-		const char* t_name = dl_internal_type_name( dl_ctx, desc );
-		if( strncmp( name->str, t_name, (size_t)name->len ) == 0 )
-			if(t_name[name->len] == '\0')
-				return desc;
-	}
-	return 0x0;
+	return dl_internal_find_type_by_name( dl_ctx, name->str, (size_t)name->len );
 }
 
 
@@ -532,11 +709,8 @@ static inline dl_typeid_t dl_internal_typeid_of( dl_ctx_t dl_ctx, const dl_type_
 
 static inline const dl_enum_desc* dl_internal_find_enum( dl_ctx_t dl_ctx, dl_typeid_t type_id )
 {
-	for( unsigned int i = 0; i < dl_ctx->enum_count; ++i )
-		if( dl_ctx->enum_ids[i] == type_id )
-			return &dl_ctx->enum_descs[i];
-
-	return 0x0;
+	uint32_t index = dl_internal_lookup_typeid( &dl_ctx->enum_lookup, dl_ctx->enum_ids, dl_ctx->enum_count, type_id );
+	return index == UINT32_MAX ? 0x0 : &dl_ctx->enum_descs[index];
 }
 
 static inline const dl_member_desc* dl_get_type_member( dl_ctx_t ctx, const dl_type_desc* type, unsigned int member_index )
@@ -576,6 +750,19 @@ static inline const dl_enum_alias_desc* dl_get_enum_alias( dl_ctx_t ctx, const d
 
 static inline unsigned int dl_internal_find_member( dl_ctx_t ctx, const dl_type_desc* type, dl_typeid_t name_hash )
 {
+	const dl_hash_lookup* lookup = &ctx->member_lookup;
+	if( lookup->slots != 0x0 && type->member_start + type->member_count <= lookup->count )
+	{
+		for( uint32_t slot = dl_internal_lookup_member_hash( type, name_hash ) & lookup->mask; lookup->slots[slot].index != UINT32_MAX; slot = ( slot + 1 ) & lookup->mask )
+		{
+			uint32_t member_index = lookup->slots[slot].index - type->member_start;
+			if( lookup->slots[slot].key == name_hash && member_index < type->member_count )
+				return member_index;
+		}
+		return type->member_count + 1;
+	}
+
+	// type added since the lookup was built, i.e. while loading a txt type library.
 	for(unsigned int i = 0; i < type->member_count; ++i)
 		if( dl_internal_hash_string( dl_internal_member_name( ctx, dl_get_type_member( ctx, type, i ) ) ) == name_hash )
 			return i;
@@ -3,11 +3,18 @@
 #include <dl/dl_util.h>
 #include <dl/dl_txt.h>
 #include <dl/dl_convert.h>
+#include "dl_types.h" // for dl_data_header
 
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <atomic>
+#include <system_error>
+#include <thread>
 
 static void dl_patch_alloc_funcs( dl_alloc_func& alloc_func, dl_realloc_func& realloc_func, dl_free_func& free_func )
 {
@@ -30,29 +37,95 @@ static void dl_patch_alloc_funcs( dl_alloc_func& alloc_func, dl_realloc_func& re
 	}
 }
 
-static unsigned char* dl_read_entire_stream( dl_realloc_func realloc_func, void* alloc_ctx, FILE* file, size_t* out_size )		 
+/**
+ * Set out_size to the number of bytes left to read in file, returns false if that is not known, as for pipes.
+ */
+static bool dl_util_file_size_left( FILE* file, size_t* out_size )
 {
-	const unsigned int CHUNK_SIZE = 1024;
-	size_t         total_size = 0;
-	size_t         chunk_size = 0;
-	unsigned char* out_buffer = 0;
+#if defined(_MSC_VER)
+	struct _stat64 st;
+	if( _fstat64( _fileno( file ), &st ) != 0 || ( st.st_mode & _S_IFREG ) == 0 )
+		return false;
+	__int64 pos = _ftelli64( file );
+#else
+	struct stat st;
+	if( fstat( fileno( file ), &st ) != 0 || !S_ISREG( st.st_mode ) )
+		return false;
+	off_t pos = ftello( file );
+#endif
+	if( pos < 0 || pos > st.st_size )
+		return false;
+	*out_size = (size_t)( st.st_size - pos );
+	return true;
+}
 
-	do
+/**
+ * Read the rest of file after prefix into one buffer. Files of known size are read with one fread(), other streams
+ * into a buffer grown geometrically so that a realloc falling back on alloc + memcpy do not copy O(n^2) bytes.
+ * Returns 0x0 if the buffer could not be allocated.
+ */
+static unsigned char* dl_read_entire_stream( dl_allocator* alloc, FILE* file, const unsigned char* prefix, size_t prefix_size, size_t* out_size )
+{
+	const size_t CHUNK_SIZE = 64 * 1024;
+	size_t file_left  = 0;
+	bool   known_size = dl_util_file_size_left( file, &file_left );
+	size_t capacity   = prefix_size + ( known_size ? file_left : CHUNK_SIZE );
+	size_t total_size = prefix_size;
+	if( capacity == 0 )
+		capacity = 1; // ... an empty file still get a buffer ...
+	unsigned char* out_buffer = (unsigned char*)dl_alloc( alloc, capacity );
+	if( out_buffer == 0x0 )
+		return 0x0;
+	if( prefix_size > 0 )
+		memcpy( out_buffer, prefix, prefix_size );
+
+	while( true )
 	{
-		out_buffer = (unsigned char*)realloc_func( out_buffer, CHUNK_SIZE + total_size, total_size, alloc_ctx );
-		chunk_size = fread( out_buffer + total_size, 1, CHUNK_SIZE, file );
-		total_size += chunk_size;
+		total_size += fread( out_buffer + total_size, 1, capacity - total_size, file );
+		if( known_size || total_size < capacity )
+			break;
+		unsigned char* grown = (unsigned char*)dl_realloc( alloc, out_buffer, capacity * 2, total_size );
+		if( grown == 0x0 )
+		{
+			dl_free( alloc, out_buffer );
+			return 0x0;
+		}
+		out_buffer = grown;
+		capacity *= 2;
 	}
-	while( chunk_size >= CHUNK_SIZE );
-
-	// Might need 1 extra byte to write string null terminator
-	if( total_size % CHUNK_SIZE == 0 )
-		out_buffer = (unsigned char*)realloc_func( out_buffer, 1 + total_size, total_size, alloc_ctx );
 
 	*out_size = total_size;
 	return out_buffer;
 }
 
+struct dl_util_stream_read_ctx
+{
+	FILE*                file;
+	const unsigned char* prefix;
+	size_t               prefix_size;
+	size_t               consumed;
+};
+
+/**
+ * dl_txt_read_func returning the prefix already read from the stream before reading from the stream.
+ */
+static size_t dl_util_stream_read( char* buffer, size_t buffer_size, void* read_ctx )
+{
+	dl_util_stream_read_ctx* ctx = (dl_util_stream_read_ctx*)read_ctx;
+	size_t read;
+	if( ctx->prefix_size > 0 )
+	{
+		read = buffer_size < ctx->prefix_size ? buffer_size : ctx->prefix_size;
+		memcpy( buffer, ctx->prefix, read );
+		ctx->prefix      += read;
+		ctx->prefix_size -= read;
+	}
+	else
+		read = fread( buffer, 1, buffer_size, ctx->file );
+	ctx->consumed += read;
+	return read;
+}
+
 static dl_error_t dl_util_load_from_buffer( dl_ctx_t            dl_ctx,     dl_typeid_t  type,
 											uint8_t*            buffer,     size_t       buffer_size,
 											dl_util_file_type_t filetype,   void**       out_instance,
@@ -111,13 +184,13 @@ static dl_error_t dl_util_load_from_buffer( dl_ctx_t            dl_ctx,     dl_t
 		{
 			// calc needed space
 			size_t packed_size = 0;
-			error = dl_txt_pack( dl_ctx, (char*)buffer, 0x0, 0, &packed_size );
+			error = dl_txt_pack_ex( dl_ctx, (char*)buffer, buffer_size, 0x0, 0, &packed_size );
 
 			if(error != DL_ERROR_OK) { free_func( (void*) buffer, alloc_ctx ); return error; }
 
 			load_instance = (unsigned char*)alloc_func( packed_size, alloc_ctx );
 
-			error = dl_txt_pack(dl_ctx, (char*)buffer, load_instance, packed_size, 0x0);
+			error = dl_txt_pack_ex( dl_ctx, (char*)buffer, buffer_size, load_instance, packed_size, 0x0 );
 
 			load_size = packed_size;
 
@@ -152,6 +225,10 @@ dl_error_t dl_util_load_from_file( dl_ctx_t     dl_ctx,        dl_typeid_t
 								   void**       allocated_mem, dl_alloc_func       alloc_func,
 								   dl_free_func free_func,     void*               alloc_ctx )
 {
+	dl_allocator file_alloc;
+	if( !dl_allocator_initialize( &file_alloc, alloc_func, 0x0, free_func, alloc_ctx ) )
+		return DL_ERROR_INVALID_PARAMETER;
+
 	dl_error_t error = DL_ERROR_UTIL_FILE_NOT_FOUND;
 
 	FILE* in_file = fopen( filename, "rb" );
@@ -161,21 +238,128 @@ dl_error_t dl_util_load_from_file( dl_ctx_t     dl_ctx,        dl_typeid_t
 		dl_realloc_func realloc_func = 0;
 		dl_patch_alloc_funcs( alloc_func, realloc_func, free_func );
 
-		fseek(in_file, 0, SEEK_END);
-		size_t size = static_cast<size_t>(ftell(in_file));
-		fseek(in_file, 0, SEEK_SET);
-		uint8_t* buffer = (uint8_t*) alloc_func( size + 1, alloc_ctx );
-		size_t read = fread(buffer, 1, size, in_file);
-		fclose(in_file);
-		if (read != size)
+		size_t size = 0;
+		uint8_t* buffer = dl_read_entire_stream( &file_alloc, in_file, 0x0, 0, &size );
+		bool read_failed = ferror( in_file ) != 0;
+		fclose( in_file );
+		if( buffer == 0x0 )
+			return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+		if( read_failed )
+		{
+			free_func( buffer, alloc_ctx );
 			return DL_ERROR_INTERNAL_ERROR;
-		buffer[size] = '\0';
-		error = dl_util_load_from_buffer( dl_ctx, type, buffer, size + 1, filetype, out_instance, out_type, allocated_mem, alloc_func, free_func, alloc_ctx );
+		}
+		error = dl_util_load_from_buffer( dl_ctx, type, buffer, size, filetype, out_instance, out_type, allocated_mem, alloc_func, free_func, alloc_ctx );
 	}
 
 	return error;
 }
 
+struct dl_util_load_batch_ctx
+{
+	dl_ctx_t                     dl_ctx;
+	dl_typeid_t                  type;
+	const char* const*           filenames;
+	size_t                       file_count;
+	dl_util_file_type_t          filetype;
+	dl_util_load_batch_result_t* results;
+	dl_alloc_func                alloc_func;
+	dl_free_func                 free_func;
+	void*                        alloc_ctx;
+	std::atomic<size_t>          next_file;
+};
+
+static void dl_util_load_batch_worker( dl_util_load_batch_ctx* batch )
+{
+	size_t file;
+	while( ( file = batch->next_file.fetch_add( 1, std::memory_order_relaxed ) ) < batch->file_count )
+	{
+		dl_util_load_batch_result_t* res = &batch->results[file];
+		res->error = dl_util_load_from_file( batch->dl_ctx,
+											 batch->type,
+											 batch->filenames[file],
+											 batch->filetype,
+											 &res->instance,
+											 &res->type,
+											 &res->allocated_mem,
+											 batch->alloc_func,
+											 batch->free_func,
+											 batch->alloc_ctx );
+	}
+}
+
+dl_error_t dl_util_load_batch( dl_ctx_t                     dl_ctx,       dl_typeid_t         type,
+							   const char* const*           filenames,    size_t              file_count,
+							   dl_util_file_type_t          filetype,     unsigned int        thread_count,
+							   dl_util_load_batch_result_t* out_results,  dl_alloc_func       alloc_func,
+							   dl_free_func                 free_func,    void*               alloc_ctx )
+{
+	if( thread_count == 0 )
+		thread_count = std::thread::hardware_concurrency();
+	if( thread_count == 0 )
+		thread_count = 1;
+	if( thread_count > file_count )
+		thread_count = file_count > 0 ? (unsigned int)file_count : 1;
+
+	if( thread_count > 1 && !dl_ctx->frozen )
+	{
+		dl_log_error( dl_ctx, "dl_util_load_batch() on more than one thread need a frozen context, see dl_context_freeze()" );
+		return DL_ERROR_UNSUPPORTED_OPERATION;
+	}
+
+	for( size_t i = 0; i < file_count; ++i )
+	{
+		out_results[i].error         = DL_ERROR_INTERNAL_ERROR;
+		out_results[i].instance      = 0x0;
+		out_results[i].type          = 0;
+		out_results[i].allocated_mem = 0x0;
+	}
+
+	dl_util_load_batch_ctx batch;
+	batch.dl_ctx     = dl_ctx;
+	batch.type       = type;
+	batch.filenames  = filenames;
+	batch.file_count = file_count;
+	batch.filetype   = filetype;
+	batch.results    = out_results;
+	batch.alloc_func = alloc_func;
+	batch.free_func  = free_func;
+	batch.alloc_ctx  = alloc_ctx;
+	batch.next_file.store( 0 );
+
+	// ... the calling thread loads files as well ...
+	unsigned int worker_count = thread_count - 1;
+	std::thread* workers = worker_count > 0 ? (std::thread*)dl_alloc( &dl_ctx->alloc, sizeof(std::thread) * worker_count ) : 0x0;
+	if( workers == 0x0 )
+		worker_count = 0; // ... load all files on the calling thread ...
+
+	// ... if not all threads could be started the calling thread loads the files they would have loaded ...
+	unsigned int started = 0;
+	try
+	{
+		for( ; started < worker_count; ++started )
+			new (&workers[started]) std::thread( dl_util_load_batch_worker, &batch );
+	}
+	catch( const std::system_error& )
+	{
+	}
+	worker_count = started;
+
+	dl_util_load_batch_worker( &batch );
+	for( unsigned int i = 0; i < worker_count; ++i )
+	{
+		workers[i].join();
+		workers[i].~thread();
+	}
+	if( workers )
+		dl_free( &dl_ctx->alloc, workers );
+
+	for( size_t i = 0; i < file_count; ++i )
+		if( out_results[i].error != DL_ERROR_OK )
+			return out_results[i].error;
+	return DL_ERROR_OK;
+}
+
 dl_error_t dl_util_load_from_stream( dl_ctx_t      dl_ctx,        dl_typeid_t         type,
 									 FILE*         stream,        dl_util_file_type_t filetype,
 									 void**        out_instance,  dl_typeid_t*        out_type,
@@ -183,11 +367,55 @@ dl_error_t dl_util_load_from_stream( dl_ctx_t      dl_ctx,        dl_typeid_t
 									 dl_alloc_func alloc_func,    dl_realloc_func     realloc_func,
 									 dl_free_func  free_func,     void*               alloc_ctx )
 {
+	dl_allocator file_alloc;
+	if( !dl_allocator_initialize( &file_alloc, alloc_func, realloc_func, free_func, alloc_ctx ) )
+		return DL_ERROR_INVALID_PARAMETER;
 	dl_patch_alloc_funcs( alloc_func, realloc_func, free_func );
-	unsigned char* file_content = dl_read_entire_stream( realloc_func, alloc_ctx, stream, consumed_bytes );
-	file_content[*consumed_bytes] = '\0';
 
-	return dl_util_load_from_buffer( dl_ctx, type, file_content, *consumed_bytes, filetype, out_instance, out_type, allocated_mem, alloc_func, free_func, alloc_ctx );
+	// ... read the header to detect the file type, zero-filled if the stream is shorter than a header ...
+	unsigned char header[sizeof(dl_data_header)];
+	memset( header, 0x0, sizeof(header) );
+	size_t header_size = fread( header, 1, sizeof(header), stream );
+
+	dl_instance_info_t info;
+	if( header_size == sizeof(header) && dl_instance_get_info( header, header_size, &info ) == DL_ERROR_OK )
+	{
+		size_t file_size = 0;
+		unsigned char* file_content = dl_read_entire_stream( &file_alloc, stream, header, header_size, &file_size );
+		if( file_content == 0x0 )
+			return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+		if( consumed_bytes )
+			*consumed_bytes = file_size;
+		return dl_util_load_from_buffer( dl_ctx, type, file_content, file_size, filetype, out_instance, out_type, allocated_mem, alloc_func, free_func, alloc_ctx );
+	}
+
+	if( ( filetype & DL_UTIL_FILE_TYPE_TEXT ) == 0 )
+		return DL_ERROR_UTIL_FILE_TYPE_MISMATCH;
+
+	// ... pack text while it is read, the text is never all in memory at once ...
+	dl_util_stream_read_ctx read_ctx = { stream, header, header_size, 0 };
+	unsigned char* load_instance = 0x0;
+	size_t         load_size = 0;
+	dl_error_t error = dl_txt_pack_stream( dl_ctx, dl_util_stream_read, &read_ctx, alloc_func, realloc_func, free_func, alloc_ctx, &load_instance, &load_size );
+	if( consumed_bytes )
+		*consumed_bytes = read_ctx.consumed;
+	if( error != DL_ERROR_OK )
+		return error;
+
+	if( type == 0 ) // autodetect type
+	{
+		error = dl_instance_get_info( load_instance, load_size, &info );
+		if(error != DL_ERROR_OK) { free_func( load_instance, alloc_ctx ); return error; }
+		type = info.root_type;
+	}
+
+	error = dl_instance_load_inplace( dl_ctx, type, load_instance, load_size, out_instance, 0x0 );
+	*allocated_mem = load_instance;
+
+	if( out_type != 0x0 )
+		*out_type = type;
+
+	return error;
 }
 
 dl_error_t dl_util_store_to_file( dl_ctx_t     dl_ctx,    dl_typeid_t         type,
@@ -203,12 +431,27 @@ dl_error_t dl_util_store_to_file( dl_ctx_t     dl_ctx,    dl_typeid_t         ty
 	if( out_file != 0x0 )
 	{
 		error = dl_util_store_to_stream( dl_ctx, type, out_file, filetype, endian, instance_size, instance, alloc_func, free_func, alloc_ctx );
-		fclose( out_file );
+		// ... buffered data is written on close, that can fail as well ...
+		if( fclose( out_file ) != 0 && error == DL_ERROR_OK )
+			error = DL_ERROR_UTIL_FILE_WRITE_FAILED;
 	}
 
 	return error;
 }
 
+struct dl_util_stream_write_ctx
+{
+	FILE* stream;
+	bool  failed; // set when a write failed, nothing more is written after that.
+};
+
+static void dl_util_stream_write( const char* data, size_t data_size, void* write_ctx )
+{
+	dl_util_stream_write_ctx* ctx = (dl_util_stream_write_ctx*)write_ctx;
+	if( !ctx->failed && data_size > 0 && fwrite( data, data_size, 1, ctx->stream ) != 1 )
+		ctx->failed = true;
+}
+
 dl_error_t dl_util_store_to_stream( dl_ctx_t        dl_ctx,    dl_typeid_t         type,
 									FILE*           stream,    dl_util_file_type_t filetype,
 									dl_endian_t     endian,    size_t              instance_size,
@@ -218,25 +461,17 @@ dl_error_t dl_util_store_to_stream( dl_ctx_t        dl_ctx,    dl_typeid_t
 	if( filetype == DL_UTIL_FILE_TYPE_AUTO )
 		return DL_ERROR_INVALID_PARAMETER;
 
-	size_t packed_size = 0;
-
-	// calculate pack-size
-	dl_error_t error = dl_instance_store( dl_ctx, type, instance, 0x0, 0, &packed_size );
+	// pack data
+	size_t         packed_size     = 0;
+	unsigned char* packed_instance = 0x0;
+	dl_error_t error = dl_instance_store_alloc( dl_ctx, type, instance, alloc_func, 0x0, free_func, alloc_ctx, &packed_instance, &packed_size );
 
 	if( error != DL_ERROR_OK)
 		return error;
-	
+
 	dl_realloc_func realloc_func = 0;
 	dl_patch_alloc_funcs( alloc_func, realloc_func, free_func );
 
-	// alloc memory
-	unsigned char* packed_instance = (unsigned char*)alloc_func( packed_size, alloc_ctx );
-
-	// pack data
-	error = dl_instance_store( dl_ctx, type, instance, packed_instance, packed_size, 0x0 );
-
-	if( error != DL_ERROR_OK ) { free_func( packed_instance, alloc_ctx ); return error; }
-
 	size_t         out_size = 0;
 	unsigned char* out_data = 0x0;
 
@@ -273,24 +508,20 @@ dl_error_t dl_util_store_to_stream( dl_ctx_t        dl_ctx,    dl_typeid_t
 		break;
 		case DL_UTIL_FILE_TYPE_TEXT:
 		{
-			// calculate pack-size
-		    error = dl_txt_unpack_calc_size( dl_ctx, type, packed_instance, packed_size, &out_size );
-			if( error != DL_ERROR_OK ) { free_func( packed_instance, alloc_ctx ); return error; }
-
-			// alloc data
-			out_data = (unsigned char*)alloc_func( out_size, alloc_ctx );
-			// pack data
-			error = dl_txt_unpack( dl_ctx, type, packed_instance, packed_size, (char*)out_data, out_size, 0x0 );
+			// unpack straight to stream
+			dl_util_stream_write_ctx write_ctx = { stream, false };
+			error = dl_txt_unpack_stream( dl_ctx, type, packed_instance, packed_size, dl_util_stream_write, &write_ctx, 0x0 );
 			free_func( packed_instance, alloc_ctx );
-
-			if( error != DL_ERROR_OK ) { free_func( out_data, alloc_ctx ); return error; }
+			if( error == DL_ERROR_OK && write_ctx.failed )
+				error = DL_ERROR_UTIL_FILE_WRITE_FAILED;
+			return error;
 		}
-		break;
 		default:
 			return DL_ERROR_INTERNAL_ERROR;
 	}
 
-	fwrite( out_data, out_size, 1, stream );
+	if( fwrite( out_data, out_size, 1, stream ) != 1 )
+		error = DL_ERROR_UTIL_FILE_WRITE_FAILED;
 	free_func( out_data, alloc_ctx );
 
 	return error;
@@ -0,0 +1,605 @@
+#include "dl_types.h"
+#include "dl_hash_table.h"
+#include "dl_patch_ptr.h"
+
+/**
+ * A struct of a specific type at a specific offset in the packed instance, used to only validate data pointed to
+ * by more than one pointer once. The same offset might be pointed to as different types so both need to be a part
+ * of the key.
+ */
+struct dl_validate_visit
+{
+	uintptr_t           offset;
+	const dl_type_desc* type;
+};
+
+static inline uint32_t dl_hash_table_key_hash( const dl_validate_visit& v ) { return dl_hash_table_key_hash( v.offset ^ ( (uintptr_t)v.type << 7 ) ); }
+static inline bool     dl_hash_table_key_equal( const dl_validate_visit& v1, const dl_validate_visit& v2 ) { return v1.offset == v2.offset && v1.type == v2.type; }
+
+/**
+ * count structs of type, stride bytes apart, starting at offset that is still to be validated.
+ */
+struct dl_validate_work
+{
+	uintptr_t           offset;
+	uint32_t            count;
+	uint32_t            stride;
+	const dl_type_desc* type;
+};
+
+struct dl_validate_ctx
+{
+	explicit dl_validate_ctx( dl_allocator alloc )
+		: ptr_bits( ptr_bits_storage )
+		, allocator( alloc )
+		, visited( alloc )
+		, work( alloc )
+	{}
+
+	~dl_validate_ctx()
+	{
+		if( ptr_bits != ptr_bits_storage )
+			dl_free( &allocator, ptr_bits );
+	}
+
+	dl_ctx_t       ctx;
+	const uint8_t* base;          ///< start of packed instance, all offsets in the instance are relative to this.
+	uintptr_t      data_start;    ///< offset to first byte of instance-data.
+	uintptr_t      data_end;      ///< offset to last byte of instance-data + 1.
+	bool           uses_chain;    ///< all pointers are listed in the patch-chain or patch-table.
+	bool           chain_in_ptrs; ///< pointers are stored as offset + distance to next pointer to patch, DL_INSTANCE_VERSION_CHAIN.
+	bool           relative;      ///< pointers are stored as distance from the pointer itself.
+	bool           collect;       ///< record all found pointers in ptr_bits, used by dl_instance_make_relative().
+
+	/**
+	 * Two bits per pointer-sized slot in the instance, interleaved per 64 slots. The first word tell if the slot is
+	 * part of the patch-chain or patch-table and the second if a non-null pointer has been found in that slot while validating.
+	 * A bitmap instead of a hash-table keeps the chain-checks at close to the cost of reading the data.
+	 */
+	uint64_t*      ptr_bits;
+	uint64_t       ptr_bits_storage[64];
+	size_t         chain_count;
+	size_t         chain_found;
+	dl_allocator   allocator;
+
+	CHashTableStatic<dl_validate_visit, bool, 128> visited;
+	CArrayStatic<dl_validate_work, 64>             work;
+};
+
+static inline bool dl_internal_validate_range( dl_validate_ctx* vctx, uintptr_t offset, uint64_t size, uint32_t alignment )
+{
+	return offset >= vctx->data_start &&
+		   offset <= vctx->data_end &&
+		   size <= (uint64_t)( vctx->data_end - offset ) &&
+		   offset % alignment == 0;
+}
+
+static inline size_t dl_internal_validate_ptr_bits_words( dl_validate_ctx* vctx )
+{
+	return ( ( vctx->data_end / sizeof(uintptr_t) ) / 64 + 1 ) * 2;
+}
+
+static dl_error_t dl_internal_validate_alloc_ptr_bits( dl_validate_ctx* vctx )
+{
+	size_t bit_words = dl_internal_validate_ptr_bits_words( vctx );
+	if( bit_words > DL_ARRAY_LENGTH( vctx->ptr_bits_storage ) )
+	{
+		vctx->ptr_bits = (uint64_t*)dl_alloc( &vctx->allocator, bit_words * sizeof(uint64_t) );
+		if( vctx->ptr_bits == 0x0 )
+		{
+			vctx->ptr_bits = vctx->ptr_bits_storage;
+			return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+		}
+	}
+	memset( vctx->ptr_bits, 0x0, bit_words * sizeof(uint64_t) );
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_internal_validate_chain( dl_validate_ctx* vctx, uintptr_t first_pointer_to_patch )
+{
+	uintptr_t offset_shift = sizeof(uintptr_t) * 4;
+	uintptr_t pos          = 0;
+	uintptr_t next         = first_pointer_to_patch; // 0 is the patch terminator
+	while( next != 0 )
+	{
+		pos += next;
+		if( !dl_internal_validate_range( vctx, pos, sizeof(uintptr_t), sizeof(uintptr_t) ) )
+		{
+			dl_log_error( vctx->ctx, "patch-chain entry at offset %lu is outside of instance or not aligned", (unsigned long)pos );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+
+		uintptr_t offsets;
+		memcpy( &offsets, vctx->base + pos, sizeof(uintptr_t) );
+		next = offsets >> offset_shift;
+
+		// as next is always > 0 each entry is at a new offset and the chain can't loop.
+		uintptr_t slot = pos / sizeof(uintptr_t);
+		vctx->ptr_bits[ ( slot / 64 ) * 2 ] |= (uint64_t)1 << ( slot % 64 );
+		++vctx->chain_count;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_internal_validate_patch_table( dl_validate_ctx* vctx, const uint8_t* patch_table, const uint8_t* patch_end )
+{
+	uintptr_t pos = 0;
+	for( const uint8_t* iter = patch_table; iter != patch_end; )
+	{
+		iter = dl_internal_patch_table_read( iter, patch_end, &pos );
+		if( iter == 0x0 )
+		{
+			dl_log_error( vctx->ctx, "patch-table is truncated or has an entry with a distance of 0" );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+
+		if( !dl_internal_validate_range( vctx, pos, sizeof(uintptr_t), sizeof(uintptr_t) ) )
+		{
+			dl_log_error( vctx->ctx, "patch-table entry at offset %lu is outside of instance or not aligned", (unsigned long)pos );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+
+		// as positions are always increasing each entry is at a new offset.
+		uintptr_t slot = pos / sizeof(uintptr_t);
+		vctx->ptr_bits[ ( slot / 64 ) * 2 ] |= (uint64_t)1 << ( slot % 64 );
+		++vctx->chain_count;
+	}
+	return DL_ERROR_OK;
+}
+
+/**
+ * Read the pointer stored at pos and return the offset it points to in out_offset, 0 for null.
+ */
+static dl_error_t dl_internal_validate_ptr_field( dl_validate_ctx* vctx, uintptr_t pos, uintptr_t* out_offset )
+{
+	uintptr_t offset_shift = sizeof(uintptr_t) * 4;
+	uintptr_t offset_mask  = ( (uintptr_t)1 << offset_shift ) - 1;
+
+	uintptr_t raw;
+	memcpy( &raw, vctx->base + pos, sizeof(uintptr_t) );
+
+	if( vctx->relative )
+		*out_offset = raw == 0 ? 0 : pos + raw;
+	else
+		*out_offset = vctx->chain_in_ptrs ? raw & offset_mask : raw;
+
+	if( *out_offset == 0 )
+	{
+		// null-pointers are never part of the chain, a null-pointer with a next-offset is broken.
+		if( raw != 0 )
+		{
+			dl_log_error( vctx->ctx, "null-pointer at offset %lu has a patch-chain offset", (unsigned long)pos );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+		return DL_ERROR_OK;
+	}
+
+	if( !vctx->uses_chain && !vctx->collect )
+		return DL_ERROR_OK;
+
+	uintptr_t slot = pos / sizeof(uintptr_t);
+	uint64_t  bit  = (uint64_t)1 << ( slot % 64 );
+	uint64_t* bits = vctx->ptr_bits + ( slot / 64 ) * 2;
+	if( pos % sizeof(uintptr_t) != 0 || ( vctx->uses_chain && ( bits[0] & bit ) == 0 ) )
+	{
+		dl_log_error( vctx->ctx, "pointer at offset %lu is not part of the patch-chain or not aligned", (unsigned long)pos );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+
+	if( vctx->collect && *out_offset == pos )
+	{
+		// would be stored as 0 and be read back as null.
+		dl_log_error( vctx->ctx, "pointer at offset %lu points to itself and can't be stored as a relative pointer", (unsigned long)pos );
+		return DL_ERROR_UNSUPPORTED_OPERATION;
+	}
+
+	if( ( bits[1] & bit ) == 0 )
+	{
+		bits[1] |= bit;
+		++vctx->chain_found;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_internal_validate_str( dl_validate_ctx* vctx, uintptr_t pos )
+{
+	uintptr_t offset;
+	dl_error_t err = dl_internal_validate_ptr_field( vctx, pos, &offset );
+	if( DL_ERROR_OK != err || offset == 0 )
+		return err;
+
+	if( !dl_internal_validate_range( vctx, offset, 1, 1 ) ||
+		memchr( vctx->base + offset, '\0', vctx->data_end - offset ) == 0x0 )
+	{
+		dl_log_error( vctx->ctx, "string at offset %lu is outside of instance or not terminated", (unsigned long)offset );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_internal_validate_ptr( dl_validate_ctx* vctx, const dl_type_desc* sub_type, uintptr_t pos )
+{
+	uintptr_t offset;
+	dl_error_t err = dl_internal_validate_ptr_field( vctx, pos, &offset );
+	if( DL_ERROR_OK != err || offset == 0 )
+		return err;
+
+	if( !dl_internal_validate_range( vctx, offset, sub_type->size[DL_PTR_SIZE_HOST], sub_type->alignment[DL_PTR_SIZE_HOST] ) )
+	{
+		dl_log_error( vctx->ctx, "pointer at offset %lu points outside of instance or is not aligned", (unsigned long)pos );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+
+	dl_validate_visit visit = { offset, sub_type };
+	if( vctx->visited.Find( visit ) )
+		return DL_ERROR_OK;
+	if( !vctx->visited.Insert( visit, true ) )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	dl_validate_work work = { offset, 1, 0, sub_type };
+	vctx->work.Add( work );
+	return DL_ERROR_OK;
+}
+
+/**
+ * Returns true if instances of type contain anything that need to be validated, i.e. pointers or unions.
+ */
+static bool dl_internal_validate_needed( dl_ctx_t ctx, const dl_type_desc* type )
+{
+	if( type->flags & ( DL_TYPE_FLAG_HAS_SUBDATA | DL_TYPE_FLAG_IS_UNION ) )
+		return true;
+
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_desc* member = dl_get_type_member( ctx, type, member_index );
+		if( member->StorageType() != DL_TYPE_STORAGE_STRUCT )
+			continue;
+		const dl_type_desc* sub_type = dl_internal_find_type( ctx, member->type_id );
+		if( sub_type == 0x0 || dl_internal_validate_needed( ctx, sub_type ) )
+			return true;
+	}
+	return false;
+}
+
+static dl_error_t dl_internal_validate_array( dl_validate_ctx* vctx, dl_type_storage_t storage_type, const dl_type_desc* sub_type, uintptr_t pos )
+{
+	uintptr_t offset;
+	dl_error_t err = dl_internal_validate_ptr_field( vctx, pos, &offset );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	uint32_t count;
+	memcpy( &count, vctx->base + pos + sizeof(uintptr_t), sizeof(uint32_t) );
+	if( count == 0 )
+		return DL_ERROR_OK;
+
+	if( offset == 0 )
+	{
+		dl_log_error( vctx->ctx, "array at offset %lu has %u elements but no data", (unsigned long)pos, count );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+
+	uint32_t elem_size;
+	uint32_t elem_align;
+	switch( storage_type )
+	{
+		case DL_TYPE_STORAGE_STRUCT:
+			elem_size  = dl_internal_align_up( sub_type->size[DL_PTR_SIZE_HOST], sub_type->alignment[DL_PTR_SIZE_HOST] );
+			elem_align = sub_type->alignment[DL_PTR_SIZE_HOST];
+			break;
+		case DL_TYPE_STORAGE_STR:
+		case DL_TYPE_STORAGE_PTR:
+			elem_size  = sizeof(uintptr_t);
+			elem_align = sizeof(uintptr_t);
+			break;
+		default:
+			elem_size  = (uint32_t)dl_pod_size( storage_type );
+			elem_align = elem_size;
+			break;
+	}
+
+	if( !dl_internal_validate_range( vctx, offset, (uint64_t)count * elem_size, elem_align ) )
+	{
+		dl_log_error( vctx->ctx, "array at offset %lu with %u elements is outside of instance or not aligned", (unsigned long)pos, count );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+
+	switch( storage_type )
+	{
+		case DL_TYPE_STORAGE_STRUCT:
+			if( dl_internal_validate_needed( vctx->ctx, sub_type ) )
+			{
+				dl_validate_work work = { offset, count, elem_size, sub_type };
+				vctx->work.Add( work );
+			}
+			break;
+		case DL_TYPE_STORAGE_STR:
+			for( uint32_t i = 0; i < count; ++i )
+				if( DL_ERROR_OK != ( err = dl_internal_validate_str( vctx, offset + i * elem_size ) ) )
+					return err;
+			break;
+		case DL_TYPE_STORAGE_PTR:
+			for( uint32_t i = 0; i < count; ++i )
+				if( DL_ERROR_OK != ( err = dl_internal_validate_ptr( vctx, sub_type, offset + i * elem_size ) ) )
+					return err;
+			break;
+		default:
+			break;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_internal_validate_struct( dl_validate_ctx* vctx, const dl_type_desc* type, uintptr_t pos );
+
+static dl_error_t dl_internal_validate_member( dl_validate_ctx* vctx, const dl_member_desc* member, uintptr_t pos )
+{
+	dl_type_atom_t    atom_type    = member->AtomType();
+	dl_type_storage_t storage_type = member->StorageType();
+
+	const dl_type_desc* sub_type = 0x0;
+	if( storage_type == DL_TYPE_STORAGE_STRUCT || storage_type == DL_TYPE_STORAGE_PTR )
+	{
+		sub_type = dl_internal_find_type( vctx->ctx, member->type_id );
+		if( sub_type == 0x0 )
+		{
+			dl_log_error( vctx->ctx, "could not find subtype for member %s", dl_internal_member_name( vctx->ctx, member ) );
+			return DL_ERROR_TYPE_NOT_FOUND;
+		}
+	}
+
+	dl_error_t err = DL_ERROR_OK;
+	switch( atom_type )
+	{
+		case DL_TYPE_ATOM_POD:
+			switch( storage_type )
+			{
+				case DL_TYPE_STORAGE_STRUCT: return dl_internal_validate_struct( vctx, sub_type, pos );
+				case DL_TYPE_STORAGE_STR:    return dl_internal_validate_str( vctx, pos );
+				case DL_TYPE_STORAGE_PTR:    return dl_internal_validate_ptr( vctx, sub_type, pos );
+				default:
+					return DL_ERROR_OK;
+			}
+
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+		{
+			uint32_t count = member->inline_array_cnt();
+			switch( storage_type )
+			{
+				case DL_TYPE_STORAGE_STRUCT:
+				{
+					if( !dl_internal_validate_needed( vctx->ctx, sub_type ) )
+						return DL_ERROR_OK;
+					uint32_t stride = member->size[DL_PTR_SIZE_HOST] / count;
+					for( uint32_t i = 0; i < count && DL_ERROR_OK == err; ++i )
+						err = dl_internal_validate_struct( vctx, sub_type, pos + i * stride );
+					return err;
+				}
+				case DL_TYPE_STORAGE_STR:
+					for( uint32_t i = 0; i < count && DL_ERROR_OK == err; ++i )
+						err = dl_internal_validate_str( vctx, pos + i * sizeof(uintptr_t) );
+					return err;
+				case DL_TYPE_STORAGE_PTR:
+					for( uint32_t i = 0; i < count && DL_ERROR_OK == err; ++i )
+						err = dl_internal_validate_ptr( vctx, sub_type, pos + i * sizeof(uintptr_t) );
+					return err;
+				default:
+					return DL_ERROR_OK;
+			}
+		}
+
+		case DL_TYPE_ATOM_ARRAY:
+			return dl_internal_validate_array( vctx, storage_type, sub_type, pos );
+
+		case DL_TYPE_ATOM_BITFIELD:
+			return DL_ERROR_OK;
+
+		default:
+			DL_ASSERT( false && "Invalid ATOM-type!" );
+			return DL_ERROR_INTERNAL_ERROR;
+	}
+}
+
+/**
+ * Validate a struct via its plan, only visiting the members that contain pointers or unions.
+ */
+static dl_error_t dl_internal_validate_plan( dl_validate_ctx* vctx, const dl_type_plan* plan, uintptr_t pos )
+{
+	dl_ctx_t          ctx = vctx->ctx;
+	const dl_plan_op* ops = ctx->plan_ops + plan->op_start;
+	dl_error_t        err = DL_ERROR_OK;
+	for( uint32_t op_index = plan->copy_count; op_index < plan->op_count && DL_ERROR_OK == err; ++op_index )
+	{
+		const dl_plan_op*   op       = &ops[op_index];
+		const dl_type_desc* sub_type = op->sub_type == UINT32_MAX ? 0x0 : ctx->type_descs + op->sub_type;
+		uintptr_t           op_pos   = pos + op->offset;
+		switch( op->kind )
+		{
+			case DL_PLAN_OP_STR:
+				for( uint32_t i = 0; i < op->count && DL_ERROR_OK == err; ++i )
+					err = dl_internal_validate_str( vctx, op_pos + i * sizeof(uintptr_t) );
+				break;
+			case DL_PLAN_OP_PTR:
+				for( uint32_t i = 0; i < op->count && DL_ERROR_OK == err; ++i )
+					err = dl_internal_validate_ptr( vctx, sub_type, op_pos + i * sizeof(uintptr_t) );
+				break;
+			case DL_PLAN_OP_STRUCT:
+				for( uint32_t i = 0; i < op->count && DL_ERROR_OK == err; ++i )
+					err = dl_internal_validate_struct( vctx, sub_type, op_pos + i * op->size );
+				break;
+			case DL_PLAN_OP_ARRAY:
+				err = dl_internal_validate_array( vctx, (dl_type_storage_t)op->storage, sub_type, op_pos );
+				break;
+			default:
+				DL_ASSERT( false && "Invalid plan-op!" );
+				return DL_ERROR_INTERNAL_ERROR;
+		}
+	}
+	return err;
+}
+
+static dl_error_t dl_internal_validate_struct( dl_validate_ctx* vctx, const dl_type_desc* type, uintptr_t pos )
+{
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		uint32_t union_type;
+		memcpy( &union_type, vctx->base + pos + dl_internal_union_type_offset( vctx->ctx, type, DL_PTR_SIZE_HOST ), sizeof(uint32_t) );
+		uint32_t member_index = union_type - dl_internal_typeid_of( vctx->ctx, type ) - 1;
+		if( member_index >= type->member_count )
+		{
+			dl_log_error( vctx->ctx, "union %s at offset %lu has invalid type-tag 0x%08X", dl_internal_type_name( vctx->ctx, type ), (unsigned long)pos, union_type );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+		const dl_member_desc* member = dl_get_type_member( vctx->ctx, type, member_index );
+		return dl_internal_validate_member( vctx, member, pos + member->offset[DL_PTR_SIZE_HOST] );
+	}
+
+	const dl_type_plan* plan = dl_internal_type_plan( vctx->ctx, type );
+	if( plan != 0x0 )
+		return dl_internal_validate_plan( vctx, plan, pos );
+
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_desc* member = dl_get_type_member( vctx->ctx, type, member_index );
+		dl_error_t err = dl_internal_validate_member( vctx, member, pos + member->offset[DL_PTR_SIZE_HOST] );
+		if( DL_ERROR_OK != err )
+			return err;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_internal_validate_instance( dl_ctx_t             dl_ctx,          dl_typeid_t type_id,
+												 const unsigned char* packed_instance, size_t      packed_instance_size,
+												 dl_validate_ctx*     vctx_ptr )
+{
+	dl_validate_ctx& vctx = *vctx_ptr;
+	const dl_data_header* header = (const dl_data_header*)packed_instance;
+
+	if( packed_instance_size < sizeof(dl_data_header) ) return DL_ERROR_MALFORMED_DATA;
+	if( header->id == DL_INSTANCE_ID_SWAPED )           return DL_ERROR_ENDIAN_MISMATCH;
+	if( header->id != DL_INSTANCE_ID )                  return DL_ERROR_MALFORMED_DATA;
+	if( header->version != DL_INSTANCE_VERSION &&
+		header->version != DL_INSTANCE_VERSION_CHAIN )  return DL_ERROR_VERSION_MISMATCH;
+	if( header->root_instance_type != type_id )         return DL_ERROR_TYPE_MISMATCH;
+
+	const dl_type_desc* root_type = dl_internal_find_type( dl_ctx, header->root_instance_type );
+	if( root_type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	if( ( header->is_64_bit_ptr != 0 ) != ( sizeof(void*) == 8 ) )
+	{
+		dl_log_error( dl_ctx, "packed instance is not stored with the pointer-size of the current platform" );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+
+	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+	if( dl_internal_packed_instance_size( header, header_offset ) > packed_instance_size ||
+		header->instance_size < root_type->size[DL_PTR_SIZE_HOST] )
+	{
+		dl_log_error( dl_ctx, "packed instance is smaller than the size stored in its header" );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+
+	vctx.ctx           = dl_ctx;
+	vctx.base          = packed_instance;
+	vctx.data_start    = header_offset;
+	vctx.data_end      = header_offset + header->instance_size;
+	vctx.relative      = header->using_relative_ptrs != 0;
+	vctx.uses_chain    = !header->not_using_ptr_chain_patching && !vctx.relative;
+	vctx.chain_in_ptrs = vctx.uses_chain && header->version == DL_INSTANCE_VERSION_CHAIN;
+	vctx.chain_count   = 0;
+	vctx.chain_found   = 0;
+
+	dl_error_t err = DL_ERROR_OK;
+	if( vctx.uses_chain || vctx.collect )
+		if( DL_ERROR_OK != ( err = dl_internal_validate_alloc_ptr_bits( &vctx ) ) )
+			return err;
+
+	if( vctx.chain_in_ptrs )
+	{
+		if( DL_ERROR_OK != ( err = dl_internal_validate_chain( &vctx, header->first_pointer_to_patch ) ) )
+			return err;
+	}
+	else if( vctx.uses_chain )
+	{
+		const uint8_t* patch_table = packed_instance + vctx.data_end;
+		if( DL_ERROR_OK != ( err = dl_internal_validate_patch_table( &vctx, patch_table, patch_table + header->patch_table_size ) ) )
+			return err;
+	}
+
+	// the root instance might be pointed to from within the instance.
+	dl_validate_visit root = { header_offset, root_type };
+	if( !vctx.visited.Insert( root, true ) )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	dl_validate_work root_work = { header_offset, 1, 0, root_type };
+	vctx.work.Add( root_work );
+
+	// work is kept in an explicit list instead of recursing to not overflow the stack on long linked lists.
+	while( vctx.work.Len() > 0 )
+	{
+		dl_validate_work work = vctx.work[vctx.work.Len() - 1];
+		vctx.work.m_nElements--;
+		for( uint32_t i = 0; i < work.count; ++i )
+			if( DL_ERROR_OK != ( err = dl_internal_validate_struct( &vctx, work.type, work.offset + i * work.stride ) ) )
+				return err;
+	}
+
+	if( vctx.uses_chain && vctx.chain_found != vctx.chain_count )
+	{
+		dl_log_error( dl_ctx, "patch-chain or patch-table contains %lu entries that are not pointers in the instance", (unsigned long)( vctx.chain_count - vctx.chain_found ) );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_instance_validate( dl_ctx_t dl_ctx, dl_typeid_t type_id, const unsigned char* packed_instance, size_t packed_instance_size )
+{
+	dl_validate_ctx vctx( dl_ctx->alloc );
+	vctx.collect = false;
+	return dl_internal_validate_instance( dl_ctx, type_id, packed_instance, packed_instance_size, &vctx );
+}
+
+dl_error_t dl_instance_make_relative( dl_ctx_t dl_ctx, dl_typeid_t type_id, unsigned char* packed_instance, size_t packed_instance_size )
+{
+	// finding all pointers in the instance is the same walk as validating it, so validate and record all found
+	// pointers in ptr_bits before anything is written.
+	dl_validate_ctx vctx( dl_ctx->alloc );
+	vctx.collect = true;
+	dl_error_t err = dl_internal_validate_instance( dl_ctx, type_id, packed_instance, packed_instance_size, &vctx );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	dl_data_header* header = (dl_data_header*)packed_instance;
+	if( header->using_relative_ptrs )
+		return DL_ERROR_OK;
+
+	// ... libraries only reading pointer-chain instances would ignore using_relative_ptrs and load the offsets as
+	// pointers, only instances of the current version, unknown to them, can be made relative ...
+	if( header->version != DL_INSTANCE_VERSION )
+	{
+		dl_log_error( dl_ctx, "only instances of the current version can be made relative, load and store the instance again first" );
+		return DL_ERROR_VERSION_MISMATCH;
+	}
+
+	size_t bit_words = dl_internal_validate_ptr_bits_words( &vctx );
+	for( size_t word = 1; word < bit_words; word += 2 )
+	{
+		uint64_t found = vctx.ptr_bits[word];
+		for( uintptr_t bit = 0; found != 0; ++bit, found >>= 1 )
+		{
+			if( ( found & 1 ) == 0 )
+				continue;
+
+			uintptr_t pos = ( ( word / 2 ) * 64 + bit ) * sizeof(uintptr_t);
+			uintptr_t ptr;
+			memcpy( &ptr, packed_instance + pos, sizeof(uintptr_t) );
+			ptr -= pos;
+			memcpy( packed_instance + pos, &ptr, sizeof(uintptr_t) );
+		}
+	}
+
+	header->using_relative_ptrs          = 1;
+	header->not_using_ptr_chain_patching = 1;
+	// ... the patch-table is left in place and unused, to keep the size of the packed instance ...
+	return DL_ERROR_OK;
+}
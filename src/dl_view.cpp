@@ -0,0 +1,183 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_types.h"
+
+#include <dl/dl_view.h>
+
+/**
+ * Resolve an offset stored in a packed instance to the data it points to, size bytes need to fit in the instance.
+ * Returns DL_ERROR_MALFORMED_DATA if it does not, *out is set to 0x0 for null-offsets.
+ */
+static dl_error_t dl_view_resolve( const dl_view_t* view, uintptr_t offset, size_t size, const void** out )
+{
+	if( offset == 0 )
+	{
+		*out = 0x0;
+		return DL_ERROR_OK;
+	}
+	if( offset < sizeof( dl_data_header ) || offset > view->packed_size || size > view->packed_size - offset )
+		return DL_ERROR_MALFORMED_DATA;
+	*out = view->packed_instance + offset;
+	return DL_ERROR_OK;
+}
+
+/**
+ * Size of one element of the given storage in an array, i.e. the stride between elements.
+ */
+static size_t dl_view_elem_size( dl_ctx_t dl_ctx, dl_type_storage_t storage, dl_typeid_t type_id )
+{
+	if( storage != DL_TYPE_STORAGE_STRUCT )
+		return dl_pod_size( storage );
+
+	const dl_type_desc* type = dl_internal_find_type( dl_ctx, type_id );
+	return type == 0x0 ? 0 : dl_internal_align_up( type->size[DL_PTR_SIZE_HOST], type->alignment[DL_PTR_SIZE_HOST] );
+}
+
+/**
+ * Make out a view of a single value of storage stored at data, strings and pointers are resolved.
+ */
+static dl_error_t dl_view_value( dl_ctx_t dl_ctx, const dl_view_t* view, dl_type_storage_t storage, dl_typeid_t type_id, const uint8_t* data, dl_view_t* out )
+{
+	out->packed_instance = view->packed_instance;
+	out->packed_size     = view->packed_size;
+	out->type_id         = type_id;
+	out->atom            = DL_TYPE_ATOM_POD;
+	out->storage         = storage;
+	out->count           = 1;
+
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STR:
+			return dl_view_resolve( view, *(const uintptr_t*)data, 1, &out->data );
+		case DL_TYPE_STORAGE_PTR:
+		{
+			const dl_type_desc* sub_type = dl_internal_find_type( dl_ctx, type_id );
+			if( sub_type == 0x0 )
+				return DL_ERROR_TYPE_NOT_FOUND;
+			return dl_view_resolve( view, *(const uintptr_t*)data, sub_type->size[DL_PTR_SIZE_HOST], &out->data );
+		}
+		default:
+			out->data = data;
+			return DL_ERROR_OK;
+	}
+}
+
+dl_error_t DL_DLL_EXPORT dl_view_instance( dl_ctx_t             dl_ctx,          dl_typeid_t type,
+                                           const unsigned char* packed_instance, size_t      packed_instance_size,
+                                           dl_view_t*           out_view )
+{
+	const dl_data_header* header = (const dl_data_header*)packed_instance;
+
+	if( packed_instance_size < sizeof(dl_data_header) ) return DL_ERROR_MALFORMED_DATA;
+	if( header->id == DL_INSTANCE_ID_SWAPED )           return DL_ERROR_ENDIAN_MISMATCH;
+	if( header->id != DL_INSTANCE_ID )                  return DL_ERROR_MALFORMED_DATA;
+	if( header->version != DL_INSTANCE_VERSION &&
+		header->version != DL_INSTANCE_VERSION_CHAIN )  return DL_ERROR_VERSION_MISMATCH;
+	if( header->root_instance_type != type )            return DL_ERROR_TYPE_MISMATCH;
+	if( header->is_64_bit_ptr != ( sizeof(void*) == 8 ? 1 : 0 ) ) return DL_ERROR_MALFORMED_DATA;
+
+	if( header->using_relative_ptrs )
+	{
+		dl_log_error( dl_ctx, "can't view an instance with relative pointers, use the generated _rel_-accessors instead" );
+		return DL_ERROR_UNSUPPORTED_OPERATION;
+	}
+	if( header->version == DL_INSTANCE_VERSION_CHAIN && !header->not_using_ptr_chain_patching )
+	{
+		dl_log_error( dl_ctx, "can't view an instance stored with a pointer-chain, convert it to the current version first" );
+		return DL_ERROR_UNSUPPORTED_OPERATION;
+	}
+
+	const dl_type_desc* root_type = dl_internal_find_type( dl_ctx, type );
+	if( root_type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+	if( dl_internal_packed_instance_size( header, header_offset ) > packed_instance_size ||
+		root_type->size[DL_PTR_SIZE_HOST] > header->instance_size )
+		return DL_ERROR_MALFORMED_DATA;
+
+	out_view->packed_instance = packed_instance;
+	out_view->packed_size     = header_offset + header->instance_size;
+	out_view->data            = packed_instance + header_offset;
+	out_view->type_id         = type;
+	out_view->atom            = DL_TYPE_ATOM_POD;
+	out_view->storage         = DL_TYPE_STORAGE_STRUCT;
+	out_view->count           = 1;
+	return DL_ERROR_OK;
+}
+
+dl_error_t DL_DLL_EXPORT dl_view_member( dl_ctx_t dl_ctx, const dl_view_t* view, unsigned int member_index, dl_view_t* out_view )
+{
+	if( view->atom != DL_TYPE_ATOM_POD || view->data == 0x0 ||
+		( view->storage != DL_TYPE_STORAGE_STRUCT && view->storage != DL_TYPE_STORAGE_PTR ) )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	const dl_type_desc* type = dl_internal_find_type( dl_ctx, view->type_id );
+	if( type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+	if( member_index >= type->member_count )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	const uint8_t* struct_data = (const uint8_t*)view->data;
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		size_t   type_offset = dl_internal_union_type_offset( dl_ctx, type, DL_PTR_SIZE_HOST );
+		uint32_t union_type  = *(const uint32_t*)( struct_data + type_offset );
+		if( union_type != dl_internal_typeid_of( dl_ctx, type ) + member_index + 1 )
+			return DL_ERROR_INVALID_PARAMETER;
+	}
+
+	const dl_member_desc* member = dl_get_type_member( dl_ctx, type, member_index );
+	const uint8_t* member_data = struct_data + member->offset[DL_PTR_SIZE_HOST];
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			return dl_view_value( dl_ctx, view, member->StorageType(), member->type_id, member_data, out_view );
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			out_view->data  = member_data;
+			out_view->count = member->inline_array_cnt();
+			break;
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			out_view->count = *(const uint32_t*)( member_data + sizeof( uintptr_t ) );
+			size_t elem_size = dl_view_elem_size( dl_ctx, member->StorageType(), member->type_id );
+			if( elem_size == 0 )
+				return DL_ERROR_TYPE_NOT_FOUND;
+			if( out_view->count > view->packed_size / elem_size )
+				return DL_ERROR_MALFORMED_DATA;
+			dl_error_t err = dl_view_resolve( view, *(const uintptr_t*)member_data, elem_size * out_view->count, &out_view->data );
+			if( err != DL_ERROR_OK )
+				return err;
+			if( out_view->data == 0x0 )
+				out_view->count = 0;
+		}
+		break;
+		case DL_TYPE_ATOM_BITFIELD:
+			return DL_ERROR_UNSUPPORTED_OPERATION;
+		default:
+			DL_ASSERT( false );
+			return DL_ERROR_INTERNAL_ERROR;
+	}
+
+	out_view->packed_instance = view->packed_instance;
+	out_view->packed_size     = view->packed_size;
+	out_view->type_id         = member->type_id;
+	out_view->atom            = member->AtomType();
+	out_view->storage         = member->StorageType();
+	return DL_ERROR_OK;
+}
+
+dl_error_t DL_DLL_EXPORT dl_view_array_elem( dl_ctx_t dl_ctx, const dl_view_t* view, unsigned int index, dl_view_t* out_view )
+{
+	if( view->atom != DL_TYPE_ATOM_ARRAY && view->atom != DL_TYPE_ATOM_INLINE_ARRAY )
+		return DL_ERROR_INVALID_PARAMETER;
+	if( index >= view->count )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	size_t elem_size = dl_view_elem_size( dl_ctx, view->storage, view->type_id );
+	if( elem_size == 0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	return dl_view_value( dl_ctx, view, view->storage, view->type_id, (const uint8_t*)view->data + elem_size * index, out_view );
+}
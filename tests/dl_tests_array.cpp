@@ -141,6 +141,46 @@ TYPED_TEST(DLBase, array_struct)
 	EXPECT_EQ(original.Array[3].Int2, loaded[0].Array[3].Int2);
 }
 
+TYPED_TEST(DLBase, array_pod_big_swap)
+{
+	// big enough to be swapped in vector-sized blocks with a tail that is not.
+	uint16_t u16[67];
+	uint64_t u64[67];
+	Pods2    pods[37];
+	for( uint32_t i = 0; i < 67; ++i )
+	{
+		u16[i] = (uint16_t)( i * 0x0102 + 1 );
+		u64[i] = (uint64_t)i * 0x0102030405060708ULL + 1;
+	}
+	for( uint32_t i = 0; i < 37; ++i )
+	{
+		pods[i].Int1 = i * 0x01020304;
+		pods[i].Int2 = ~pods[i].Int1;
+	}
+
+	u16Array original16 = { { u16, DL_ARRAY_LENGTH(u16) } };
+	u16Array loaded16[128];
+	this->do_the_round_about( u16Array::TYPE_ID, &original16, loaded16, sizeof(loaded16) );
+	EXPECT_EQ(original16.arr.count, loaded16[0].arr.count);
+	EXPECT_ARRAY_EQ(original16.arr.count, original16.arr.data, loaded16[0].arr.data);
+
+	u64Array original64 = { { u64, DL_ARRAY_LENGTH(u64) } };
+	u64Array loaded64[64];
+	this->do_the_round_about( u64Array::TYPE_ID, &original64, loaded64, sizeof(loaded64) );
+	EXPECT_EQ(original64.arr.count, loaded64[0].arr.count);
+	EXPECT_ARRAY_EQ(original64.arr.count, original64.arr.data, loaded64[0].arr.data);
+
+	StructArray1 original_pods = { { pods, DL_ARRAY_LENGTH(pods) } };
+	StructArray1 loaded_pods[64];
+	this->do_the_round_about( StructArray1::TYPE_ID, &original_pods, loaded_pods, sizeof(loaded_pods) );
+	EXPECT_EQ(original_pods.Array.count, loaded_pods[0].Array.count);
+	for( uint32_t i = 0; i < original_pods.Array.count; ++i )
+	{
+		EXPECT_EQ(original_pods.Array[i].Int1, loaded_pods[0].Array[i].Int1);
+		EXPECT_EQ(original_pods.Array[i].Int2, loaded_pods[0].Array[i].Int2);
+	}
+}
+
 TYPED_TEST(DLBase, array_enum)
 {
 	TestEnum2 array_data[8] = { TESTENUM2_VALUE1, TESTENUM2_VALUE2, TESTENUM2_VALUE3, TESTENUM2_VALUE4, TESTENUM2_VALUE4, TESTENUM2_VALUE3, TESTENUM2_VALUE2, TESTENUM2_VALUE1 } ;
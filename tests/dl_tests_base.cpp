@@ -91,6 +91,31 @@ void inplace_load_test::do_it( dl_ctx_t       dl_ctx,       dl_typeid_t type,
 	free(inplace_buffer);
 }
 
+void store_alloc_test::do_it( dl_ctx_t       dl_ctx,       dl_typeid_t type,
+							  unsigned char* store_buffer, size_t      store_size,
+							  unsigned char** out_buffer,   size_t*     out_size )
+{
+	// load a copy of the stored instance to store again
+	unsigned char *inplace_buffer = (unsigned char*)malloc(store_size);
+	memcpy( inplace_buffer, store_buffer, store_size );
+
+	void* loaded_instance = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( dl_ctx, type, inplace_buffer, store_size, &loaded_instance, 0x0 ));
+
+	// store in one pass, should be the same as dl_instance_store
+	unsigned char* stored = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_store_alloc( dl_ctx, type, loaded_instance, 0x0, 0x0, 0x0, 0x0, &stored, out_size ) );
+	EXPECT_EQ( store_size, *out_size );
+	EXPECT_EQ( 0, memcmp( store_buffer, stored, store_size ) );
+
+	*out_buffer = (unsigned char*)malloc(*out_size + 1);
+	memset(*out_buffer, 0xFE, *out_size + 1);
+	memcpy(*out_buffer, stored, *out_size);
+
+	free(stored);
+	free(inplace_buffer);
+}
+
 void convert_test_do_it( dl_ctx_t       dl_ctx,        dl_typeid_t type,
 						 unsigned char* store_buffer,  size_t      store_size,
 						 unsigned char** out_buffer,    size_t*     out_size,
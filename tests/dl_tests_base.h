@@ -28,6 +28,13 @@ struct inplace_load_test
 					   unsigned char** out_buffer,   size_t*     out_size );
 };
 
+struct store_alloc_test
+{
+	static void do_it( dl_ctx_t       dl_ctx,       dl_typeid_t type,
+					   unsigned char* store_buffer, size_t      store_size,
+					   unsigned char** out_buffer,   size_t*     out_size );
+};
+
 void convert_test_do_it( dl_ctx_t       dl_ctx,        dl_typeid_t type,
 						 unsigned char* store_buffer,  size_t      store_size,
 						 unsigned char** out_buffer,    size_t*     out_size,
@@ -84,6 +91,7 @@ struct DLBase : public DL
 			EXPECT_DL_ERR_OK( dl_instance_store( dl_ctx, type, pack_me, store_buffer, store_size, 0x0 ) );
 			EXPECT_INSTANCE_INFO( store_buffer, store_size, sizeof(void*), DL_ENDIAN_HOST, type );
 			EXPECT_EQ( 0xFE, store_buffer[store_size] ); // no overwrite on the calculated size plox!
+			EXPECT_DL_ERR_OK( dl_instance_validate( dl_ctx, type, store_buffer, store_size ) );
 
 			unsigned char *out_buffer = 0x0;
 			size_t out_size;
@@ -95,6 +103,7 @@ struct DLBase : public DL
 			
 			// out instance should have correct format
 			EXPECT_INSTANCE_INFO( out_buffer, out_size, sizeof(void*), DL_ENDIAN_HOST, type );
+			EXPECT_DL_ERR_OK( dl_instance_validate( dl_ctx, type, out_buffer, out_size ) );
 
 			size_t consumed = 0;
 			EXPECT_DL_ERR_OK( dl_instance_load( dl_ctx, type, unpack_me, unpack_me_size, out_buffer, out_size, &consumed ) );
@@ -110,6 +119,7 @@ struct DLBase : public DL
 typedef ::testing::Types<
 	 pack_text_test
 	,inplace_load_test
+	,store_alloc_test
 	,convert_test<4, DL_ENDIAN_LITTLE>
 	,convert_test<8, DL_ENDIAN_LITTLE>
 	,convert_test<4, DL_ENDIAN_BIG>
@@ -11,10 +11,13 @@
 #include <dl/dl.h>
 #include <dl/dl_txt.h>
 #include <dl/dl_convert.h>
+#include <dl/dl_typelib.h>
 
 #include "dl_test_common.h"
 
 #include <float.h>
+#include <thread>
+#include <vector>
 
 #include "dl_tests_base.h"
 
@@ -370,6 +373,378 @@ TEST_F( DL, lots_of_members )
 	EXPECT_EQ(0, memcmp(loaded, &t1, sizeof(t1)));
 }
 
+TEST_F( DL, store_without_string_merge )
+{
+	static const unsigned char typelib[] = {
+		#include "generated/unittest.bin.h"
+	};
+
+	const char* strings[] = { "cow", "bells", "cow", "are", "cow", "bells" };
+	StringArray arr;
+	arr.Strings.data  = strings;
+	arr.Strings.count = DL_ARRAY_LENGTH(strings);
+
+	dl_ctx_t no_merge_ctx;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	p.disable_string_merge = 1;
+	EXPECT_DL_ERR_OK( dl_context_create( &no_merge_ctx, &p ) );
+	EXPECT_DL_ERR_OK( dl_context_load_type_library( no_merge_ctx, typelib, sizeof(typelib) ) );
+
+	unsigned char merged[256];
+	unsigned char not_merged[256];
+	size_t merged_size;
+	size_t not_merged_size;
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx,    StringArray::TYPE_ID, &arr, merged,     sizeof(merged),     &merged_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_store( no_merge_ctx, StringArray::TYPE_ID, &arr, not_merged, sizeof(not_merged), &not_merged_size ) );
+
+	// "cow" twice and "bells" once more without merging.
+	EXPECT_EQ( merged_size + 2 * sizeof("cow") + sizeof("bells"), not_merged_size );
+
+	StringArray* loaded;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( no_merge_ctx, StringArray::TYPE_ID, not_merged, not_merged_size, (void**)(void*)&loaded, 0x0 ) );
+	EXPECT_EQ( arr.Strings.count, loaded->Strings.count );
+	for( uint32_t i = 0; i < arr.Strings.count; ++i )
+		EXPECT_STREQ( strings[i], loaded->Strings[i] );
+
+	EXPECT_DL_ERR_OK( dl_context_destroy( no_merge_ctx ) );
+}
+
+TEST_F( DL, store_string_merge_out_of_memory )
+{
+	// ... more unique strings than fit in the stack-storage of the table used to merge strings, with all larger
+	// allocations failing once the typelib is loaded ...
+	static const unsigned char typelib[] = {
+		#include "generated/unittest.bin.h"
+	};
+
+	char storage[100][8];
+	const char* strings[DL_ARRAY_LENGTH(storage)];
+	for( uint32_t i = 0; i < DL_ARRAY_LENGTH(storage); ++i )
+	{
+		snprintf( storage[i], sizeof(storage[i]), "s%u", i );
+		strings[i] = storage[i];
+	}
+	StringArray arr;
+	arr.Strings.data  = strings;
+	arr.Strings.count = DL_ARRAY_LENGTH(strings);
+
+	bool fail_large = false;
+	dl_ctx_t small_ctx;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	p.alloc_func   = []( size_t size, void* ctx ) -> void* { return *(bool*)ctx && size > 4096 ? 0x0 : malloc( size ); };
+	p.realloc_func = []( void* ptr, size_t size, size_t, void* ctx ) -> void* { return *(bool*)ctx && size > 4096 ? 0x0 : realloc( ptr, size ); };
+	p.free_func    = []( void* ptr, void* ) { free( ptr ); };
+	p.alloc_ctx    = &fail_large;
+	EXPECT_DL_ERR_OK( dl_context_create( &small_ctx, &p ) );
+	EXPECT_DL_ERR_OK( dl_context_load_type_library( small_ctx, typelib, sizeof(typelib) ) );
+
+	unsigned char packed[2048];
+	fail_large = true;
+	EXPECT_DL_ERR_EQ( DL_ERROR_OUT_OF_LIBRARY_MEMORY, dl_instance_store( small_ctx, StringArray::TYPE_ID, &arr, packed, sizeof(packed), 0x0 ) );
+	fail_large = false;
+
+	size_t packed_size;
+	EXPECT_DL_ERR_OK( dl_instance_store( small_ctx, StringArray::TYPE_ID, &arr, packed, sizeof(packed), &packed_size ) );
+	StringArray* loaded;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( small_ctx, StringArray::TYPE_ID, packed, packed_size, (void**)(void*)&loaded, 0x0 ) );
+	EXPECT_EQ( arr.Strings.count, loaded->Strings.count );
+	for( uint32_t i = 0; i < arr.Strings.count; ++i )
+		EXPECT_STREQ( strings[i], loaded->Strings[i] );
+
+	EXPECT_DL_ERR_OK( dl_context_destroy( small_ctx ) );
+}
+
+struct store_alloc_test_allocator
+{
+	int allocs;
+	int reallocs;
+	int frees;
+};
+
+TEST_F( DL, store_alloc_with_user_allocator )
+{
+	const char* strings[] = { "cow", "bells", "are", "cool", "cow" };
+	StringArray arr;
+	arr.Strings.data  = strings;
+	arr.Strings.count = DL_ARRAY_LENGTH(strings);
+
+	store_alloc_test_allocator allocator = { 0, 0, 0 };
+	dl_alloc_func   alloc_func   = []( size_t size, void* ctx ) -> void* { ++( (store_alloc_test_allocator*)ctx )->allocs; return malloc( size ); };
+	dl_realloc_func realloc_func = []( void* ptr, size_t size, size_t, void* ctx ) -> void* { ++( (store_alloc_test_allocator*)ctx )->reallocs; return realloc( ptr, size ); };
+	dl_free_func    free_func    = []( void* ptr, void* ctx ) { ++( (store_alloc_test_allocator*)ctx )->frees; free( ptr ); };
+
+	unsigned char expect[256];
+	size_t expect_size;
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx, StringArray::TYPE_ID, &arr, expect, sizeof(expect), &expect_size ) );
+
+	unsigned char* stored = 0x0;
+	size_t stored_size = 0;
+	EXPECT_DL_ERR_OK( dl_instance_store_alloc( this->Ctx, StringArray::TYPE_ID, &arr, alloc_func, realloc_func, free_func, &allocator, &stored, &stored_size ) );
+	ASSERT_EQ( expect_size, stored_size );
+	EXPECT_EQ( 0, memcmp( expect, stored, expect_size ) );
+	EXPECT_EQ( 0, allocator.allocs );
+	EXPECT_LT( 0, allocator.reallocs );
+	free_func( stored, &allocator );
+
+	unsigned char* not_stored = 0x0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_NOT_FOUND, dl_instance_store_alloc( this->Ctx, (dl_typeid_t)0x12345678, &arr, alloc_func, realloc_func, free_func, &allocator, &not_stored, 0x0 ) );
+	EXPECT_EQ( 0x0, not_stored );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_instance_store_alloc( this->Ctx, StringArray::TYPE_ID, &arr, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 ) );
+
+	// ... growing the stored instance fails ...
+	dl_realloc_func failing_realloc_func = []( void*, size_t, size_t, void* ) -> void* { return 0x0; };
+	EXPECT_DL_ERR_EQ( DL_ERROR_OUT_OF_LIBRARY_MEMORY, dl_instance_store_alloc( this->Ctx, StringArray::TYPE_ID, &arr, alloc_func, failing_realloc_func, free_func, &allocator, &not_stored, 0x0 ) );
+	EXPECT_EQ( 0x0, not_stored );
+}
+
+TEST_F( DL, frozen_context_from_many_threads )
+{
+	EXPECT_DL_ERR_OK( dl_context_freeze( this->Ctx ) );
+
+	// ... no more typelibs can be loaded ...
+	const char typelib[] = "{ \"module\" : \"frozen\", \"types\" : { \"frozen_type\" : { \"members\" : [ { \"name\" : \"m\", \"type\" : \"uint32\" } ] } } }";
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_context_load_txt_type_library( this->Ctx, typelib, sizeof(typelib) - 1 ) );
+
+	dl_ctx_t ctx = this->Ctx;
+	int failures[4] = { 0, 0, 0, 0 };
+	std::thread threads[4];
+	for( int t = 0; t < 4; ++t )
+	{
+		threads[t] = std::thread( [ctx, &failures, t]()
+		{
+			const char* strings[] = { "cow", "bells", "are", "cool", "cow" };
+			StringArray arr;
+			arr.Strings.data  = strings;
+			arr.Strings.count = DL_ARRAY_LENGTH(strings);
+
+			for( int i = 0; i < 256; ++i )
+			{
+				unsigned char packed[256];
+				char          txt[512];
+				unsigned char repacked[256];
+				size_t packed_size;
+				size_t repacked_size;
+				StringArray* loaded;
+				if( dl_instance_store( ctx, StringArray::TYPE_ID, &arr, packed, sizeof(packed), &packed_size ) != DL_ERROR_OK ||
+					dl_txt_unpack( ctx, StringArray::TYPE_ID, packed, packed_size, txt, sizeof(txt), 0x0 ) != DL_ERROR_OK ||
+					dl_txt_pack( ctx, txt, repacked, sizeof(repacked), &repacked_size ) != DL_ERROR_OK ||
+					dl_instance_load_inplace( ctx, StringArray::TYPE_ID, repacked, repacked_size, (void**)(void*)&loaded, 0x0 ) != DL_ERROR_OK ||
+					loaded->Strings.count != arr.Strings.count ||
+					strcmp( loaded->Strings[3], "cool" ) != 0 )
+					++failures[t];
+			}
+		} );
+	}
+
+	for( int t = 0; t < 4; ++t )
+	{
+		threads[t].join();
+		EXPECT_EQ( 0, failures[t] );
+	}
+}
+
+/**
+ * Rewrite packed, a stored PtrChain where only the root has a Next, to an instance with a pointer-chain (instance
+ * version 2) as stored by older versions of DL.
+ */
+static void dl_test_ptr_chain_to_version_2( unsigned char* packed, size_t* packed_size )
+{
+	// ... root.Next is the only pointer and the last in the chain, it already holds its offset with 0 as the distance
+	// to the next one ...
+	const size_t header_size = 24; // sizeof(dl_data_header)
+	uint32_t version = 2;
+	uint32_t first_pointer_to_patch = (uint32_t)( header_size + offsetof( PtrChain, Next ) );
+	uint32_t patch_table_size;
+	memcpy( &patch_table_size, packed + 20, sizeof(uint32_t) );
+	memcpy( packed + 4,  &version, sizeof(uint32_t) );
+	memcpy( packed + 20, &first_pointer_to_patch, sizeof(uint32_t) );
+	*packed_size -= patch_table_size;
+}
+
+TEST_F( DL, txt_unpack_ptr_chain_instance )
+{
+	// instances with a pointer-chain are smaller than the current version of the same data, unpacking one to text
+	// must not store the current version back into the buffer.
+	PtrChain c2 = { 2, 0x0 };
+	PtrChain c1 = { 1, &c2 };
+
+	unsigned char packed[256];
+	size_t packed_size;
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx, PtrChain::TYPE_ID, &c1, packed, sizeof(packed), &packed_size ) );
+	dl_test_ptr_chain_to_version_2( packed, &packed_size );
+
+	unsigned char copy[256];
+	memcpy( copy, packed, packed_size );
+
+	size_t txt_size;
+	EXPECT_DL_ERR_OK( dl_txt_unpack_calc_size( this->Ctx, PtrChain::TYPE_ID, packed, packed_size, &txt_size ) );
+	char* txt = (char*)malloc( txt_size );
+	EXPECT_DL_ERR_OK( dl_txt_unpack( this->Ctx, PtrChain::TYPE_ID, packed, packed_size, txt, txt_size, 0x0 ) );
+	EXPECT_EQ( 0, memcmp( copy, packed, packed_size ) );
+
+	unsigned char repacked[256];
+	PtrChain loaded[4];
+	EXPECT_DL_ERR_OK( dl_txt_pack( this->Ctx, txt, repacked, sizeof(repacked), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_instance_load( this->Ctx, PtrChain::TYPE_ID, loaded, sizeof(loaded), repacked, sizeof(repacked), 0x0 ) );
+	EXPECT_EQ( 1u, loaded[0].Int );
+	ASSERT_NE( (PtrChain*)0x0, loaded[0].Next );
+	EXPECT_EQ( 2u, loaded[0].Next->Int );
+	EXPECT_EQ( (PtrChain*)0x0, loaded[0].Next->Next );
+	free( txt );
+}
+
+TEST_F( DL, relative_ptrs_load_without_patching )
+{
+	PtrChain c3 = { 3, 0x0 };
+	PtrChain c2 = { 2, &c3 };
+	PtrChain c1 = { 1, &c2 };
+
+	unsigned char packed[256];
+	unsigned char copy[256];
+	size_t packed_size;
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx, PtrChain::TYPE_ID, &c1, packed, sizeof(packed), &packed_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_make_relative( this->Ctx, PtrChain::TYPE_ID, packed, packed_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_validate( this->Ctx, PtrChain::TYPE_ID, packed, packed_size ) );
+	memcpy( copy, packed, packed_size );
+
+	// ... loading a relative instance do not touch the data ...
+	PtrChain* loaded;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( this->Ctx, PtrChain::TYPE_ID, packed, packed_size, (void**)(void*)&loaded, 0x0 ) );
+	EXPECT_EQ( 0, memcmp( copy, packed, packed_size ) );
+
+	EXPECT_EQ( 1u, loaded->Int );
+	const PtrChain* next = PtrChain_rel_Next( loaded );
+	ASSERT_NE( (const PtrChain*)0x0, next );
+	EXPECT_EQ( 2u, next->Int );
+	next = PtrChain_rel_Next( next );
+	ASSERT_NE( (const PtrChain*)0x0, next );
+	EXPECT_EQ( 3u, next->Int );
+	EXPECT_EQ( (const PtrChain*)0x0, PtrChain_rel_Next( next ) );
+
+	// ... and the relative instance can be copied anywhere ...
+	PtrChain moved[16];
+	EXPECT_DL_ERR_OK( dl_instance_load( this->Ctx, PtrChain::TYPE_ID, moved, sizeof(moved), packed, packed_size, 0x0 ) );
+	EXPECT_EQ( 3u, PtrChain_rel_Next( PtrChain_rel_Next( moved ) )->Int );
+
+	// ... making it relative again is a no-op ...
+	EXPECT_DL_ERR_OK( dl_instance_make_relative( this->Ctx, PtrChain::TYPE_ID, packed, packed_size ) );
+	EXPECT_EQ( 0, memcmp( copy, packed, packed_size ) );
+
+	char txt[256];
+	unsigned char converted[256];
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_txt_unpack( this->Ctx, PtrChain::TYPE_ID, packed, packed_size, txt, sizeof(txt), 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_convert( this->Ctx, PtrChain::TYPE_ID, packed, packed_size, converted, sizeof(converted), DL_ENDIAN_HOST, sizeof(void*), 0x0 ) );
+}
+
+TEST_F( DL, relative_ptrs_not_made_from_ptr_chain_instance )
+{
+	// ... older libraries loading a pointer-chain instance would not know that its pointers are relative ...
+	PtrChain c2 = { 2, 0x0 };
+	PtrChain c1 = { 1, &c2 };
+
+	unsigned char packed[256];
+	unsigned char copy[256];
+	size_t packed_size;
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx, PtrChain::TYPE_ID, &c1, packed, sizeof(packed), &packed_size ) );
+	dl_test_ptr_chain_to_version_2( packed, &packed_size );
+	memcpy( copy, packed, packed_size );
+	EXPECT_DL_ERR_EQ( DL_ERROR_VERSION_MISMATCH, dl_instance_make_relative( this->Ctx, PtrChain::TYPE_ID, packed, packed_size ) );
+	EXPECT_EQ( 0, memcmp( copy, packed, packed_size ) );
+
+	// ... but can be once stored again in the current version ...
+	PtrChain loaded_chain[4];
+	unsigned char restored[256];
+	size_t restored_size;
+	EXPECT_DL_ERR_OK( dl_instance_load( this->Ctx, PtrChain::TYPE_ID, loaded_chain, sizeof(loaded_chain), packed, packed_size, 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx, PtrChain::TYPE_ID, loaded_chain, restored, sizeof(restored), &restored_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_make_relative( this->Ctx, PtrChain::TYPE_ID, restored, restored_size ) );
+
+	PtrChain* loaded;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( this->Ctx, PtrChain::TYPE_ID, restored, restored_size, (void**)(void*)&loaded, 0x0 ) );
+	EXPECT_EQ( 2u, PtrChain_rel_Next( loaded )->Int );
+}
+
+TEST_F( DL, relative_ptrs_arrays_and_strings )
+{
+	const char* strings[] = { "cow", "bells", "are", "cool" };
+	StringArray arr;
+	arr.Strings.data  = strings;
+	arr.Strings.count = DL_ARRAY_LENGTH(strings);
+
+	unsigned char packed[256];
+	size_t packed_size;
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx, StringArray::TYPE_ID, &arr, packed, sizeof(packed), &packed_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_make_relative( this->Ctx, StringArray::TYPE_ID, packed, packed_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_validate( this->Ctx, StringArray::TYPE_ID, packed, packed_size ) );
+
+	StringArray* loaded;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( this->Ctx, StringArray::TYPE_ID, packed, packed_size, (void**)(void*)&loaded, 0x0 ) );
+	EXPECT_EQ( arr.Strings.count, loaded->Strings.count );
+	for( uint32_t i = 0; i < arr.Strings.count; ++i )
+		EXPECT_STREQ( strings[i], StringArray_rel_Strings( loaded, i ) );
+
+	uint32_t u32[] = { 1, 2, 3, 4, 5 };
+	PodArray1 pods;
+	pods.u32_arr.data  = u32;
+	pods.u32_arr.count = DL_ARRAY_LENGTH(u32);
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx, PodArray1::TYPE_ID, &pods, packed, sizeof(packed), &packed_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_make_relative( this->Ctx, PodArray1::TYPE_ID, packed, packed_size ) );
+
+	PodArray1* loaded_pods;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( this->Ctx, PodArray1::TYPE_ID, packed, packed_size, (void**)(void*)&loaded_pods, 0x0 ) );
+	EXPECT_EQ( pods.u32_arr.count, loaded_pods->u32_arr.count );
+	EXPECT_EQ( 0, memcmp( u32, PodArray1_rel_u32_arr( loaded_pods ), sizeof(u32) ) );
+}
+
+static void dl_test_serial_dispatch( dl_job_func job, void* job_ctx, unsigned int job_count, void* dispatch_ctx )
+{
+	// ... run jobs backwards, they should not depend on being run in order ...
+	for( unsigned int i = job_count; i > 0; --i )
+		job( i - 1, job_ctx );
+	*(unsigned int*)dispatch_ctx += job_count;
+}
+
+TEST_F( DL, load_inplace_parallel )
+{
+	// ... enough pointers for the patch-table to be split in more than 4 jobs ...
+	std::vector<const char*> strings( 100000 );
+	for( size_t i = 0; i < strings.size(); ++i )
+		strings[i] = i % 2 ? "cow" : "bells";
+	StringArray arr;
+	arr.Strings.data  = &strings[0];
+	arr.Strings.count = (uint32_t)strings.size();
+
+	size_t packed_size;
+	EXPECT_DL_ERR_OK( dl_instance_calc_size( this->Ctx, StringArray::TYPE_ID, &arr, &packed_size ) );
+	std::vector<unsigned char> stored( packed_size );
+	EXPECT_DL_ERR_OK( dl_instance_store( this->Ctx, StringArray::TYPE_ID, &arr, &stored[0], stored.size(), 0x0 ) );
+
+	std::vector<unsigned char> packed = stored;
+	StringArray* loaded;
+	size_t consumed;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace_parallel( this->Ctx, StringArray::TYPE_ID, &packed[0], packed.size(), 4, 0x0, 0x0, (void**)(void*)&loaded, &consumed ) );
+	EXPECT_EQ( packed_size, consumed );
+	ASSERT_EQ( arr.Strings.count, loaded->Strings.count );
+	for( uint32_t i = 0; i < arr.Strings.count; ++i )
+		EXPECT_STREQ( strings[i], loaded->Strings[i] );
+
+	// ... jobs are run by the dispatch-function if one is passed, once to find where the parts start and once to patch ...
+	packed = stored;
+	unsigned int dispatched = 0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace_parallel( this->Ctx, StringArray::TYPE_ID, &packed[0], packed.size(), 4, dl_test_serial_dispatch, &dispatched, (void**)(void*)&loaded, 0x0 ) );
+	EXPECT_EQ( 8u, dispatched );
+	ASSERT_EQ( arr.Strings.count, loaded->Strings.count );
+	for( uint32_t i = 0; i < arr.Strings.count; ++i )
+		EXPECT_STREQ( strings[i], loaded->Strings[i] );
+
+	// ... a distance of 0 in the middle of the patch-table, at the end of the packed instance ...
+	packed = stored;
+	packed[packed.size() - arr.Strings.count / 2] = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_load_inplace_parallel( this->Ctx, StringArray::TYPE_ID, &packed[0], packed.size(), 4, 0x0, 0x0, (void**)(void*)&loaded, 0x0 ) );
+}
+
 int main(int argc, char **argv)
 {
 	::testing::InitGoogleTest(&argc, argv);
@@ -48,6 +48,7 @@ TEST_F(DLError, type_mismatch_returned)
 	Pods p;
 	// dl.h
 	EXPECT_DL_ERR_TYPE_MISMATCH( dl_instance_load( Ctx, Pods::TYPE_ID, &p, sizeof(Pods), packed, DL_ARRAY_LENGTH(packed), 0x0 ) );
+	EXPECT_DL_ERR_TYPE_MISMATCH( dl_instance_validate( Ctx, Pods::TYPE_ID, packed, DL_ARRAY_LENGTH(packed) ) );
 
 	// dl_convert.h
 	EXPECT_DL_ERR_TYPE_MISMATCH( dl_convert( Ctx, Pods::TYPE_ID, packed, DL_ARRAY_LENGTH(packed), bus_buffer, DL_ARRAY_LENGTH(bus_buffer), other_endian,   sizeof(void*), 0x0 ) );
@@ -65,6 +66,51 @@ TEST_F(DLError, type_mismatch_returned)
 #undef EXPECT_DL_ERR_TYPE_MISMATCH
 }
 
+TEST_F(DLError, validate_finds_malformed_data)
+{
+	const size_t header_size = 24; // sizeof(dl_data_header), all instances here are aligned to <= 8.
+	unsigned char packed[1024];
+	size_t packed_size;
+
+	// unterminated strings
+	Strings strs = { "apa", "banan" };
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, Strings::TYPE_ID, &strs, packed, sizeof(packed), &packed_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_validate( Ctx, Strings::TYPE_ID, packed, packed_size ) );
+	for( size_t i = header_size + sizeof(Strings); i < packed_size; ++i )
+		if( packed[i] == '\0' )
+			packed[i] = 'x';
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, Strings::TYPE_ID, packed, packed_size ) );
+
+	// pointer outside of instance
+	PtrChain last  = { 2, 0x0 };
+	PtrChain first = { 1, &last };
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, PtrChain::TYPE_ID, &first, packed, sizeof(packed), &packed_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_validate( Ctx, PtrChain::TYPE_ID, packed, packed_size ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, PtrChain::TYPE_ID, packed, packed_size - sizeof(PtrChain) ) );
+	unsigned char* next_ptr = packed + header_size + offsetof( PtrChain, Next );
+	next_ptr[0] = 0xFF;
+	next_ptr[1] = 0xFF;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, PtrChain::TYPE_ID, packed, packed_size ) );
+
+	// patch-table not matching the pointers in the instance, first.Next is the only entry and last in the buffer.
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, PtrChain::TYPE_ID, &first, packed, sizeof(packed), &packed_size ) );
+	EXPECT_EQ( header_size + offsetof( PtrChain, Next ), (size_t)packed[packed_size - 1] );
+	packed[packed_size - 1] = (unsigned char)header_size;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, PtrChain::TYPE_ID, packed, packed_size ) );
+	packed[packed_size - 1] = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, PtrChain::TYPE_ID, packed, packed_size ) );
+
+	// invalid union type
+	test_union_simple u;
+	u.type = test_union_simple_type_item1;
+	u.value.item1 = 1337;
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, test_union_simple::TYPE_ID, &u, packed, sizeof(packed), &packed_size ) );
+	EXPECT_DL_ERR_OK( dl_instance_validate( Ctx, test_union_simple::TYPE_ID, packed, packed_size ) );
+	uint32_t bad_type = 0xFFFFFFFF;
+	memcpy( packed + header_size + offsetof( test_union_simple, type ), &bad_type, sizeof(bad_type) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, test_union_simple::TYPE_ID, packed, packed_size ) );
+}
+
 TEST_F(DLError, typelib_version_mismatch_returned)
 {
 	static const unsigned char typelib[] =
@@ -113,11 +159,11 @@ TEST_F(DLError, version_mismatch_returned)
 	conv.instance = packed;
 	unsigned int* instance_version;
 	instance_version = conv.instance_version + 1;
-	EXPECT_EQ(2u, *instance_version);
+	EXPECT_EQ(3u, *instance_version);
 	*instance_version = 0xFFFFFFFF;
 	conv.instance = swaped;
 	instance_version = conv.instance_version + 1;
-	EXPECT_EQ(0x02000000u, *instance_version);
+	EXPECT_EQ(0x03000000u, *instance_version);
 	*instance_version = 0xFFFFFFFF;
 
 	// test all functions in...
@@ -126,6 +172,7 @@ TEST_F(DLError, version_mismatch_returned)
 		Pods p;
 		// dl.h
 		EXPECT_DL_ERR_VERSION_MISMATCH( dl_instance_load( Ctx, unused::TYPE_ID, &p, sizeof(Pods), packed, DL_ARRAY_LENGTH(packed), 0x0 ) );
+		EXPECT_DL_ERR_VERSION_MISMATCH( dl_instance_validate( Ctx, unused::TYPE_ID, packed, DL_ARRAY_LENGTH(packed) ) );
 
 		// dl_convert.h
 		EXPECT_DL_ERR_VERSION_MISMATCH( dl_convert( Ctx, unused::TYPE_ID, packed, DL_ARRAY_LENGTH(packed), bus_buffer, DL_ARRAY_LENGTH(bus_buffer), other_endian,   sizeof(void*), 0x0 ) );
@@ -226,6 +226,31 @@ TYPED_TEST(DLBase, ptr_chain_long)
 	}
 }
 
+TYPED_TEST(DLBase, ptr_chain_larger_than_64k)
+{
+	// offsets in a 32-bit instance of this size did not fit in the pointers together with the patch-chain.
+	const size_t count = 10000;
+	PtrChain* ptrs = (PtrChain*)malloc(count * sizeof(PtrChain));
+	for (size_t i = 0; i < count - 1; ++i)
+		ptrs[i] = { (uint32_t) i, &ptrs[i + 1] };
+	ptrs[count - 1] = { (uint32_t)(count - 1), &ptrs[0] };
+
+	size_t loaded_size = this->calculate_unpack_size(PtrChain::TYPE_ID, ptrs);
+	PtrChain* loaded = (PtrChain*)malloc(loaded_size);
+
+	this->do_the_round_about(PtrChain::TYPE_ID, ptrs, loaded, loaded_size);
+
+	for (size_t i = 0; i < count - 1; ++i)
+	{
+		EXPECT_EQ(loaded[i].Next, &loaded[i + 1]);
+		EXPECT_EQ(loaded[i].Int, i);
+	}
+	EXPECT_EQ(loaded[count - 1].Next, &loaded[0]);
+
+	free(loaded);
+	free(ptrs);
+}
+
 TYPED_TEST( DLBase, ptr_inline_array )
 {
 	WithInlineArray wi  = { { 1, 2, 3 } };
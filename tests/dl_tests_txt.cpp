@@ -854,6 +854,28 @@ TEST_F( DLText, multi_line_comments )
 	EXPECT_DL_ERR_OK( dl_txt_pack( Ctx, test_text, out_text_data, DL_ARRAY_LENGTH(out_text_data), 0x0 ) );
 }
 
+TEST_F( DLText, long_whitespace_comments_and_strings )
+{
+	// ... runs longer than the simd-width used to scan them, with escapes and terminators at every position ...
+	const char* test_text =
+		"{                                                                    \n"
+		"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\r\n"
+		"  // a single line comment that is a lot longer than thirty two chars\n"
+		"  /* a multi line comment * with stars ** that is\n"
+		"     also a lot longer than thirty two chars **/\n"
+		"  \"Strings\" : {\n"
+		"    \"Str1\" : \"0123456789abcdef0123456789abcdef0123456789abcdef\\\"01234\\\\\",\n"
+		"    \"Str2\" : 'abcdefghijklmnopqrstuvwxyzabcdef\"ghijklmnop\\'qrstuvwxyz'"
+		"                                                                    \n"
+		"  }\n"
+		"}                                                                    \n";
+
+	uint64_t unpack_buffer[128];
+	Strings* strs = dl_txt_test_pack_text<Strings>( Ctx, test_text, unpack_buffer, sizeof(unpack_buffer) );
+	EXPECT_STREQ( "0123456789abcdef0123456789abcdef0123456789abcdef\"01234\\", strs->Str1 );
+	EXPECT_STREQ( "abcdefghijklmnopqrstuvwxyzabcdef\"ghijklmnop'qrstuvwxyz", strs->Str2 );
+}
+
 TEST_F( DLText, leading_decimal_point )
 {
     uint64_t unpack_buffer[128];
@@ -902,6 +924,63 @@ TEST_F( DLText, float_nan_neg )
     EXPECT_TRUE(isnan(pods->f64) == 1);
 }
 
+TEST_F( DLText, float_unpack_shortest_roundtrip )
+{
+	const float  f32[] = { 0.1f, 1.0f / 3.0f, 16777216.0f, 1e-45f, 3.4028235e38f, -2.5e-3f, 0.0f, 1e20f };
+	const double f64[] = { 0.1, 1.0 / 3.0, 123456789012345678.0, 5e-324, 1.7976931348623157e308, -2.5e-3, 0.0, 1e-7 };
+	for( uint32_t i = 0; i < DL_ARRAY_LENGTH(f32); ++i )
+	{
+		Pods pods;
+		memset( &pods, 0x0, sizeof(pods) );
+		pods.i64 = INT64_MIN;
+		pods.u64 = UINT64_MAX;
+		pods.f32 = f32[i];
+		pods.f64 = f64[i];
+
+		unsigned char packed[256];
+		char txt[1024];
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, Pods::TYPE_ID, &pods, packed, sizeof(packed), 0x0 ) );
+		EXPECT_DL_ERR_OK( dl_txt_unpack( Ctx, Pods::TYPE_ID, packed, sizeof(packed), txt, sizeof(txt), 0x0 ) );
+
+		uint64_t unpack_buffer[128];
+		Pods* loaded = dl_txt_test_pack_text<Pods>( Ctx, txt, unpack_buffer, sizeof(unpack_buffer) );
+		EXPECT_EQ( 0, memcmp( &pods.f32, &loaded->f32, sizeof(float) ) )  << txt;
+		EXPECT_EQ( 0, memcmp( &pods.f64, &loaded->f64, sizeof(double) ) ) << txt;
+		EXPECT_EQ( INT64_MIN,  loaded->i64 );
+		EXPECT_EQ( UINT64_MAX, loaded->u64 );
+
+		// no more digits than needed.
+		if( i == 0 )
+		{
+			EXPECT_NE( (const char*)0x0, strstr( txt, "\"f32\" : 0.1" ) ) << txt;
+			EXPECT_NE( (const char*)0x0, strstr( txt, "\"f64\" : 0.1" ) ) << txt;
+			EXPECT_EQ( (const char*)0x0, strstr( txt, "0.100" ) ) << txt;
+		}
+	}
+}
+
+TEST_F( DLText, float_parse_correctly_rounded )
+{
+	// values close to halfway between two floats, subnormals and values that need more than the fast-path.
+	uint64_t unpack_buffer[128];
+	PodsDefaults* pods;
+	pods = dl_txt_test_pack_text<PodsDefaults>(Ctx, STRINGIFY( { PodsDefaults : { f32 : 1.00000005960464477539062500001, f64 : 9007199254740993 } } ), unpack_buffer, sizeof(unpack_buffer));
+	EXPECT_EQ( 1.00000005960464477539062500001f, pods->f32 );
+	EXPECT_EQ( 9007199254740993.0,               pods->f64 );
+
+	pods = dl_txt_test_pack_text<PodsDefaults>(Ctx, STRINGIFY( { PodsDefaults : { f32 : 1.4012984643e-45, f64 : 2.4703282292062328e-324 } } ), unpack_buffer, sizeof(unpack_buffer));
+	EXPECT_EQ( 1.4012984643e-45f,       pods->f32 );
+	EXPECT_EQ( 2.4703282292062328e-324, pods->f64 );
+
+	pods = dl_txt_test_pack_text<PodsDefaults>(Ctx, STRINGIFY( { PodsDefaults : { f32 : -3.4028234664e38, f64 : 1.7976931348623157e308 } } ), unpack_buffer, sizeof(unpack_buffer));
+	EXPECT_EQ( -3.4028234664e38f,       pods->f32 );
+	EXPECT_EQ( 1.7976931348623157e308,  pods->f64 );
+
+	pods = dl_txt_test_pack_text<PodsDefaults>(Ctx, STRINGIFY( { PodsDefaults : { f32 : 0.14285715, f64 : 8.589973e-9 } } ), unpack_buffer, sizeof(unpack_buffer));
+	EXPECT_EQ( 0.14285715f, pods->f32 );
+	EXPECT_EQ( 8.589973e-9, pods->f64 );
+}
+
 TEST_F( DLText, intXX_min )
 {
 	const char* test_str[] = {
@@ -1323,6 +1402,339 @@ TEST_F( DLText, missing_struct_end_in_struct_array )
 	EXPECT_DL_ERR_EQ( DL_ERROR_TXT_PARSE_ERROR, dl_txt_pack( Ctx, test_text, out_text_data, DL_ARRAY_LENGTH(out_text_data), 0x0 ) );
 }
 
+TEST_F( DLText, array_of_structs_with_subdata )
+{
+	// elements that write subdata are packed in one pass and relocated when the array is closed, check that
+	// strings, nested arrays and ptrs written by the elements ends up where they should.
+	// loaded inplace from a 128-aligned buffer since dl_instance_load() places the instance right at the buffer start
+	// and would move the 128-aligned subdata of A128BitAlignedType off its alignment.
+	unsigned char DL_ALIGN(128) packed[2048];
+	const char* test_text = STRINGIFY( { array_subdata : { arr : [
+		{ str : "a",       aligned : [ { Int : 1 } ],             strs : [ "x", "yy" ], ptr : "p"  },
+		{ str : "bcdefgh", aligned : [],                          strs : [ "zzz" ],     ptr : null },
+		{ str : "",        aligned : [ { Int : 2 }, { Int : 3 } ], strs : [],            ptr : "p"  },
+	], __subdata : { "p" : { Int1 : 7, Int2 : 8 } } } } );
+
+	EXPECT_DL_ERR_OK( dl_txt_pack( Ctx, test_text, packed, sizeof(packed), 0x0 ) );
+	array_subdata* loaded = 0x0;
+	ASSERT_DL_ERR_OK( dl_instance_load_inplace( Ctx, array_subdata::TYPE_ID, packed, sizeof(packed), (void**)&loaded, 0x0 ) );
+
+	ASSERT_EQ( 3u, loaded->arr.count );
+	EXPECT_STREQ( "a",       loaded->arr[0].str );
+	EXPECT_STREQ( "bcdefgh", loaded->arr[1].str );
+	EXPECT_STREQ( "",        loaded->arr[2].str );
+
+	ASSERT_EQ( 1u, loaded->arr[0].aligned.count );
+	ASSERT_EQ( 0u, loaded->arr[1].aligned.count );
+	ASSERT_EQ( 2u, loaded->arr[2].aligned.count );
+	EXPECT_EQ( 1u, loaded->arr[0].aligned[0].Int );
+	EXPECT_EQ( 2u, loaded->arr[2].aligned[0].Int );
+	EXPECT_EQ( 3u, loaded->arr[2].aligned[1].Int );
+	EXPECT_EQ( 0u, (uintptr_t)loaded->arr[0].aligned.data % 128 );
+	EXPECT_EQ( 0u, (uintptr_t)loaded->arr[2].aligned.data % 128 );
+
+	ASSERT_EQ( 2u, loaded->arr[0].strs.count );
+	ASSERT_EQ( 1u, loaded->arr[1].strs.count );
+	ASSERT_EQ( 0u, loaded->arr[2].strs.count );
+	EXPECT_STREQ( "x",   loaded->arr[0].strs[0] );
+	EXPECT_STREQ( "yy",  loaded->arr[0].strs[1] );
+	EXPECT_STREQ( "zzz", loaded->arr[1].strs[0] );
+
+	EXPECT_EQ( loaded->arr[0].ptr, loaded->arr[2].ptr );
+	EXPECT_EQ( 0x0, loaded->arr[1].ptr );
+	EXPECT_EQ( 7u, loaded->arr[0].ptr->Int1 );
+	EXPECT_EQ( 8u, loaded->arr[0].ptr->Int2 );
+}
+
+TEST_F( DLText, ptr_array_with_null_between )
+{
+	uint64_t unpack_buffer[128];
+	const char* test_text = STRINGIFY( { ptrArray : { arr : [ "a", null, "a" ],
+		__subdata : { "a" : { i8 : 1, i16 : 2, i32 : 3, i64 : 4, u8 : 5, u16 : 6, u32 : 7, u64 : 8, f32 : 9, f64 : 10 } } } } );
+
+	ptrArray* loaded = dl_txt_test_pack_text<ptrArray>( Ctx, test_text, unpack_buffer, sizeof(unpack_buffer) );
+	ASSERT_EQ( 3u, loaded->arr.count );
+	EXPECT_EQ( loaded->arr[0], loaded->arr[2] );
+	EXPECT_EQ( 0x0, loaded->arr[1] );
+	EXPECT_EQ( 10.0, loaded->arr[0]->f64 );
+}
+
+TEST_F( DLText, pack_ex_from_slice )
+{
+	// ... text followed by more data and no terminator, should pack the same as the terminated text ...
+	const char* test_text = STRINGIFY( { Pods2 : { Int1 : 1337, Int2 : 7331 } } );
+	size_t test_text_len = strlen( test_text );
+
+	char slice[256];
+	memset( slice, '9', sizeof(slice) );
+	memcpy( slice, test_text, test_text_len );
+
+	unsigned char expect[256];
+	unsigned char packed[256];
+	size_t expect_size = 0;
+	size_t packed_size = 0;
+	EXPECT_DL_ERR_OK( dl_txt_pack( Ctx, test_text, expect, sizeof(expect), &expect_size ) );
+	EXPECT_DL_ERR_OK( dl_txt_pack_ex( Ctx, slice, test_text_len, 0x0, 0, &packed_size ) );
+	EXPECT_EQ( expect_size, packed_size );
+	EXPECT_DL_ERR_OK( dl_txt_pack_ex( Ctx, slice, test_text_len, packed, sizeof(packed), &packed_size ) );
+	ASSERT_EQ( expect_size, packed_size );
+	EXPECT_EQ( 0, memcmp( expect, packed, expect_size ) );
+
+	// ... the "9"-s after the text is not part of the instance, with them Int2 is 73319 ...
+	Pods2 loaded;
+	EXPECT_DL_ERR_OK( dl_instance_load( Ctx, Pods2::TYPE_ID, &loaded, sizeof(loaded), packed, packed_size, 0x0 ) );
+	EXPECT_EQ( 7331u, loaded.Int2 );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TXT_PARSE_ERROR, dl_txt_pack_ex( Ctx, slice, test_text_len - 2, 0x0, 0, &packed_size ) );
+}
+
+TEST_F( DLText, pack_ex_never_reads_past_end )
+{
+	// ... pack every prefix of the text from a buffer of exactly that size, reading past the end is caught by asan ...
+	const char* test_text =
+		"{ array_subdata : { arr : [\n"
+		"  { str : \"a\\\"b\", aligned : [ { Int : 0b101 } ], strs : [ 'x', \"yy\" ], ptr : \"p\" }, /* comment */\n"
+		"  { str : \"\",     aligned : [],                  strs : [],            ptr : null } // comment\n"
+		"], \"__subdata\" : { \"p\" : { Int1 : max, Int2 : 0x12 } } } }\n";
+	size_t test_text_len = strlen( test_text );
+	size_t valid_len     = (size_t)( strrchr( test_text, '}' ) - test_text ) + 1;
+
+	unsigned char packed[2048];
+	for( size_t len = 0; len <= test_text_len; ++len )
+	{
+		char* txt = (char*)malloc( len > 0 ? len : 1 );
+		memcpy( txt, test_text, len );
+		size_t packed_size = 0;
+		dl_error_t pack_err = dl_txt_pack_ex( Ctx, txt, len, packed, sizeof(packed), &packed_size );
+		if( len >= valid_len )
+			EXPECT_EQ( DL_ERROR_OK, pack_err ) << "packing failed with " << len << " chars";
+		else
+			EXPECT_NE( DL_ERROR_OK, pack_err ) << "packing succeeded with " << len << " chars";
+		free( txt );
+	}
+}
+
+struct dl_txt_test_stream
+{
+	const char* txt;
+	size_t      left;
+	size_t      reads;
+};
+
+static size_t dl_txt_test_stream_read( char* buffer, size_t buffer_size, void* read_ctx )
+{
+	// ... read between 1 and 7 chars at a time to cut tokens, comments and strings at all possible places ...
+	dl_txt_test_stream* stream = (dl_txt_test_stream*)read_ctx;
+	size_t read = 1 + ( stream->reads++ % 7 );
+	if( read > buffer_size ) read = buffer_size;
+	if( read > stream->left )  read = stream->left;
+	memcpy( buffer, stream->txt, read );
+	stream->txt  += read;
+	stream->left -= read;
+	return read;
+}
+
+static void dl_txt_test_pack_stream_same_as_pack( dl_ctx_t dl_ctx, const char* test_text )
+{
+	size_t expect_size = 0;
+	EXPECT_DL_ERR_OK( dl_txt_pack_calc_size( dl_ctx, test_text, &expect_size ) );
+	unsigned char* expect = (unsigned char*)calloc( expect_size, 1 ); // ... padding is not written by dl_txt_pack ...
+	EXPECT_DL_ERR_OK( dl_txt_pack( dl_ctx, test_text, expect, expect_size, 0x0 ) );
+
+	dl_txt_test_stream stream = { test_text, strlen( test_text ), 0 };
+	unsigned char* packed = 0x0;
+	size_t packed_size = 0;
+	EXPECT_DL_ERR_OK( dl_txt_pack_stream( dl_ctx, dl_txt_test_stream_read, &stream, 0x0, 0x0, 0x0, 0x0, &packed, &packed_size ) );
+	ASSERT_EQ( expect_size, packed_size );
+	EXPECT_EQ( 0, memcmp( expect, packed, expect_size ) );
+
+	free( packed );
+	free( expect );
+}
+
+TEST_F( DLText, pack_stream )
+{
+	dl_txt_test_pack_stream_same_as_pack( Ctx,
+		"{ array_subdata : { arr : [\n"
+		"  { str : \"a\\\"b\", aligned : [ { Int : 0b101 } ], strs : [ 'x', \"yy\" ], ptr : \"p\" }, /* comment */\n"
+		"  { str : \"\",     aligned : [],                  strs : [],            ptr : null } // comment\n"
+		"], \"__subdata\" : { \"p\" : { Int1 : max, Int2 : 0x12 } } } }\n" );
+
+	// ... __subdata before the members referencing it ...
+	dl_txt_test_pack_stream_same_as_pack( Ctx, STRINGIFY(
+		{ "PtrChain" : {
+			"__subdata" : {
+				"ptr1" : { "Int" : 2, "Next" : "ptr2" },
+				"ptr2" : { "Int" : 3, "Next" : null }
+			},
+			"Int" : 1,
+			"Next" : "ptr1"
+		} } ) );
+}
+
+TEST_F( DLText, pack_stream_long_strings_and_comments )
+{
+	// ... strings and comments longer than the chunks read from the stream ...
+	const size_t long_len = 200000;
+	char* test_text = (char*)malloc( long_len * 3 + 128 );
+	char* iter = test_text;
+	iter += sprintf( iter, "{ StringArray : { Strings : [ \"" );
+	memset( iter, 'a', long_len ); iter += long_len;
+	iter += sprintf( iter, "\", /* " );
+	memset( iter, 'b', long_len ); iter += long_len;
+	iter += sprintf( iter, " */ \"c\" // " );
+	memset( iter, 'd', long_len ); iter += long_len;
+	sprintf( iter, "\n ] } }" );
+
+	dl_txt_test_pack_stream_same_as_pack( Ctx, test_text );
+	free( test_text );
+}
+
+TEST_F( DLText, pack_stream_out_of_memory )
+{
+	// ... a context failing all allocations larger than 1MB, a string longer than that has to be kept in memory ...
+	static const unsigned char typelib[] =
+	{
+		#include "generated/unittest.bin.h"
+	};
+	dl_ctx_t small_ctx;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	p.alloc_func   = []( size_t size, void* ) -> void* { return size > 1024 * 1024 ? 0x0 : malloc( size ); };
+	p.realloc_func = []( void* ptr, size_t size, size_t, void* ) -> void* { return size > 1024 * 1024 ? 0x0 : realloc( ptr, size ); };
+	p.free_func    = []( void* ptr, void* ) { free( ptr ); };
+	EXPECT_DL_ERR_OK( dl_context_create( &small_ctx, &p ) );
+	EXPECT_DL_ERR_OK( dl_context_load_type_library( small_ctx, typelib, sizeof(typelib) ) );
+
+	const size_t long_len = 2 * 1024 * 1024;
+	char* test_text = (char*)malloc( long_len + 128 );
+	char* iter = test_text;
+	iter += sprintf( iter, "{ StringArray : { Strings : [ \"" );
+	memset( iter, 'a', long_len ); iter += long_len;
+	sprintf( iter, "\" ] } }" );
+
+	dl_txt_test_stream stream = { test_text, strlen( test_text ), 0 };
+	unsigned char* packed = 0x0;
+	size_t packed_size = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_OUT_OF_LIBRARY_MEMORY, dl_txt_pack_stream( small_ctx, dl_txt_test_stream_read, &stream, 0x0, 0x0, 0x0, 0x0, &packed, &packed_size ) );
+	EXPECT_EQ( 0x0, packed );
+
+	free( test_text );
+	EXPECT_DL_ERR_OK( dl_context_destroy( small_ctx ) );
+}
+
+TEST_F( DLText, pack_stream_error )
+{
+	const char* test_text = STRINGIFY( { Pods2 : { Int1 : 1337, Int2 : 7331, Int3 : 1 } } );
+	dl_txt_test_stream stream = { test_text, strlen( test_text ), 0 };
+	unsigned char* packed = 0x0;
+	size_t packed_size = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TXT_INVALID_MEMBER, dl_txt_pack_stream( Ctx, dl_txt_test_stream_read, &stream, 0x0, 0x0, 0x0, 0x0, &packed, &packed_size ) );
+	EXPECT_EQ( 0x0, packed );
+
+	// ... text that ends before the instance is complete ...
+	test_text   = STRINGIFY( { Pods2 : { Int1 : 1337, Int2 : 7331 } } );
+	stream.txt  = test_text;
+	stream.left = strlen( test_text ) - 2;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TXT_PARSE_ERROR, dl_txt_pack_stream( Ctx, dl_txt_test_stream_read, &stream, 0x0, 0x0, 0x0, 0x0, &packed, &packed_size ) );
+	EXPECT_EQ( 0x0, packed );
+
+	// ... the packed instance can't be allocated ...
+	dl_alloc_func   alloc_func   = []( size_t, void* ) -> void* { return 0x0; };
+	dl_realloc_func realloc_func = []( void*, size_t, size_t, void* ) -> void* { return 0x0; };
+	dl_free_func    free_func    = []( void* ptr, void* ) { free( ptr ); };
+	stream.txt  = test_text;
+	stream.left = strlen( test_text );
+	EXPECT_DL_ERR_EQ( DL_ERROR_OUT_OF_LIBRARY_MEMORY, dl_txt_pack_stream( Ctx, dl_txt_test_stream_read, &stream, alloc_func, realloc_func, free_func, 0x0, &packed, &packed_size ) );
+	EXPECT_EQ( 0x0, packed );
+}
+
+struct dl_txt_test_write_stream
+{
+	char*  txt;
+	size_t size;
+	size_t writes;
+};
+
+static void dl_txt_test_stream_write( const char* data, size_t data_size, void* write_ctx )
+{
+	dl_txt_test_write_stream* stream = (dl_txt_test_write_stream*)write_ctx;
+	stream->txt = (char*)realloc( stream->txt, stream->size + data_size );
+	memcpy( stream->txt + stream->size, data, data_size );
+	stream->size += data_size;
+	++stream->writes;
+}
+
+static void dl_txt_test_unpack_stream_same_as_unpack( dl_ctx_t dl_ctx, dl_typeid_t type, const char* test_text, size_t min_writes )
+{
+	size_t packed_size = 0;
+	EXPECT_DL_ERR_OK( dl_txt_pack_calc_size( dl_ctx, test_text, &packed_size ) );
+	unsigned char* packed = (unsigned char*)malloc( packed_size );
+	EXPECT_DL_ERR_OK( dl_txt_pack( dl_ctx, test_text, packed, packed_size, 0x0 ) );
+
+	size_t expect_size = 0;
+	EXPECT_DL_ERR_OK( dl_txt_unpack_calc_size( dl_ctx, type, packed, packed_size, &expect_size ) );
+	char* expect = (char*)malloc( expect_size );
+	EXPECT_DL_ERR_OK( dl_txt_unpack( dl_ctx, type, packed, packed_size, expect, expect_size, 0x0 ) );
+
+	dl_txt_test_write_stream stream = { 0x0, 0, 0 };
+	size_t produced = 0;
+	EXPECT_DL_ERR_OK( dl_txt_unpack_stream( dl_ctx, type, packed, packed_size, dl_txt_test_stream_write, &stream, &produced ) );
+	EXPECT_EQ( expect_size, produced );
+	ASSERT_EQ( expect_size, stream.size );
+	EXPECT_EQ( 0, memcmp( expect, stream.txt, expect_size ) );
+	EXPECT_LE( min_writes, stream.writes );
+
+	// ... and from a loaded instance ...
+	void* loaded = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( dl_ctx, type, packed, packed_size, &loaded, 0x0 ) );
+	size_t loaded_expect_size = 0;
+	EXPECT_DL_ERR_OK( dl_txt_unpack_loaded_calc_size( dl_ctx, type, loaded, &loaded_expect_size ) );
+	stream.size = 0;
+	EXPECT_DL_ERR_OK( dl_txt_unpack_loaded_stream( dl_ctx, type, loaded, dl_txt_test_stream_write, &stream, &produced ) );
+	EXPECT_EQ( loaded_expect_size, produced );
+	EXPECT_EQ( loaded_expect_size, stream.size );
+
+	free( stream.txt );
+	free( expect );
+	free( packed );
+}
+
+TEST_F( DLText, unpack_stream )
+{
+	dl_txt_test_unpack_stream_same_as_unpack( Ctx, PtrChain::TYPE_ID, STRINGIFY(
+		{ "PtrChain" : {
+			"Int" : 1,
+			"Next" : "ptr1",
+			"__subdata" : {
+				"ptr1" : { "Int" : 2, "Next" : "ptr2" },
+				"ptr2" : { "Int" : 3, "Next" : null }
+			}
+		} } ), 1 );
+
+	// ... text larger than the chunks passed to the write func ...
+	const uint32_t num_strings = 4096;
+	char* test_text = (char*)malloc( num_strings * 16 + 64 );
+	char* iter = test_text;
+	iter += sprintf( iter, "{ StringArray : { Strings : [ " );
+	for( uint32_t i = 0; i < num_strings; ++i )
+		iter += sprintf( iter, "\"str\\t%u\", ", i );
+	sprintf( iter, "] } }" );
+
+	dl_txt_test_unpack_stream_same_as_unpack( Ctx, StringArray::TYPE_ID, test_text, 10 );
+	free( test_text );
+}
+
+TEST_F( DLText, unpack_stream_error )
+{
+	unsigned char packed[256];
+	EXPECT_DL_ERR_OK( dl_txt_pack( Ctx, STRINGIFY( { Pods2 : { Int1 : 1337, Int2 : 7331 } } ), packed, sizeof(packed), 0x0 ) );
+
+	dl_txt_test_write_stream stream = { 0x0, 0, 0 };
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH, dl_txt_unpack_stream( Ctx, Pods::TYPE_ID, packed, sizeof(packed), dl_txt_test_stream_write, &stream, 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_txt_unpack_stream( Ctx, Pods2::TYPE_ID, packed, sizeof(packed), 0x0, 0x0, 0x0 ) );
+	EXPECT_EQ( 0u, stream.writes );
+}
+
 TEST_F( DLText, hex_ints )
 {
     unsigned char unpack_buffer[1024];
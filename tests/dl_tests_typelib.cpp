@@ -343,7 +343,7 @@ TEST_F( DLTypeLibUnpackTxt, round_about )
 	});
 
 	// ... pack from text ...
-	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, testlib1, sizeof(testlib1)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, testlib1, strlen(testlib1) ) );
 
 	size_t txt_size = 0;
 	char testlib_txt_buffer[2048];
@@ -435,6 +435,97 @@ TEST_F( DLTypeLib, enum_in_2_tlds )
 	free(tl2);
 }
 
+TEST_F( DLTypeLib, load_inplace )
+{
+	const char typelib1[] = STRINGIFY({ "module" : "tl1", "enums" : { "e1" : { "values" : { "e1_v1" : 1, "e1_v2" : 2 } } }, "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "e1" }, { "name" : "s", "type" : "string", "default" : "cow" } ] } } });
+	const char typelib2[] = STRINGIFY({ "module" : "tl2", "enums" : { "e2" : { "values" : { "e2_v1" : 3, "e2_v2" : 4 } } }, "types" : { "tl2_type" : { "members" : [ { "name" : "m2", "type" : "e2" } ] } } });
+
+	size_t tl1_size;
+	size_t tl2_size;
+	uint8_t* tl1 = test_pack_txt_type_lib( typelib1, sizeof(typelib1)-1, &tl1_size );
+	uint8_t* tl2 = test_pack_txt_type_lib( typelib2, sizeof(typelib2)-1, &tl2_size );
+	uint8_t* tl1_copy = (uint8_t*)malloc( tl1_size );
+	memcpy( tl1_copy, tl1, tl1_size );
+
+	EXPECT_DL_ERR_OK( dl_context_load_type_library_inplace( ctx, tl1, tl1_size ) );
+
+	uint8_t outbuf[256];
+	const char test1[] = STRINGIFY( { "tl1_type" : { "m1" : "e1_v2" } } );
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, test1, outbuf, sizeof(outbuf), 0x0 ) );
+
+	// ... same typelib should be written back ...
+	size_t written_size = 0;
+	EXPECT_DL_ERR_OK( dl_context_write_type_library( ctx, 0x0, 0, &written_size ) );
+	EXPECT_EQ( tl1_size, written_size );
+
+	// ... loading another typelib copies the first one to the ctx ...
+	EXPECT_DL_ERR_OK( dl_context_load_type_library_inplace( ctx, tl2, tl2_size ) );
+	EXPECT_EQ( 0, memcmp( tl1, tl1_copy, tl1_size ) );
+	memset( tl1, 0xFE, tl1_size );
+
+	const char test2[] = STRINGIFY( { "tl2_type" : { "m2" : "e2_v1" } } );
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, test1, outbuf, sizeof(outbuf), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, test2, outbuf, sizeof(outbuf), 0x0 ) );
+
+	free(tl1);
+	free(tl1_copy);
+	free(tl2);
+}
+
+TEST_F( DLTypeLib, load_inplace_out_of_memory )
+{
+	const char typelib1[] = STRINGIFY({ "module" : "tl1", "enums" : { "e1" : { "values" : { "e1_v1" : 1, "e1_v2" : 2 } } }, "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "e1" } ] } } });
+	const char typelib2[] = STRINGIFY({ "module" : "tl2", "enums" : { "e2" : { "values" : { "e2_v1" : 3, "e2_v2" : 4 } } }, "types" : { "tl2_type" : { "members" : [ { "name" : "m2", "type" : "e2" } ] } } });
+
+	size_t tl1_size;
+	size_t tl2_size;
+	uint8_t* tl1 = test_pack_txt_type_lib( typelib1, sizeof(typelib1)-1, &tl1_size );
+	uint8_t* tl2 = test_pack_txt_type_lib( typelib2, sizeof(typelib2)-1, &tl2_size );
+
+	bool fail_alloc = false;
+	dl_ctx_t oom_ctx;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	p.alloc_func   = []( size_t size, void* ctx ) -> void* { return *(bool*)ctx ? 0x0 : malloc( size ); };
+	p.realloc_func = []( void* ptr, size_t size, size_t, void* ctx ) -> void* { return *(bool*)ctx ? 0x0 : realloc( ptr, size ); };
+	p.free_func    = []( void* ptr, void* ) { free( ptr ); };
+	p.alloc_ctx    = &fail_alloc;
+	p.error_msg_func = test_log_error;
+	EXPECT_DL_ERR_OK( dl_context_create( &oom_ctx, &p ) );
+	EXPECT_DL_ERR_OK( dl_context_load_type_library_inplace( oom_ctx, tl1, tl1_size ) );
+
+	// ... the first typelib can't be copied to the ctx, it should still be borrowed and usable ...
+	fail_alloc = true;
+	EXPECT_DL_ERR_EQ( DL_ERROR_OUT_OF_LIBRARY_MEMORY, dl_context_load_type_library_inplace( oom_ctx, tl2, tl2_size ) );
+	fail_alloc = false;
+
+	uint8_t outbuf[256];
+	const char test1[] = STRINGIFY( { "tl1_type" : { "m1" : "e1_v2" } } );
+	const char test2[] = STRINGIFY( { "tl2_type" : { "m2" : "e2_v1" } } );
+	EXPECT_DL_ERR_OK( dl_txt_pack( oom_ctx, test1, outbuf, sizeof(outbuf), 0x0 ) );
+
+	EXPECT_DL_ERR_OK( dl_context_load_type_library_inplace( oom_ctx, tl2, tl2_size ) );
+	memset( tl1, 0xFE, tl1_size );
+	EXPECT_DL_ERR_OK( dl_txt_pack( oom_ctx, test1, outbuf, sizeof(outbuf), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_txt_pack( oom_ctx, test2, outbuf, sizeof(outbuf), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_context_destroy( oom_ctx ) );
+
+	// ... a misaligned typelib is copied when loaded inplace, failing that should leave the ctx empty ...
+	uint8_t* misaligned = (uint8_t*)malloc( tl2_size + 1 );
+	memcpy( misaligned + 1, tl2, tl2_size );
+	EXPECT_DL_ERR_OK( dl_context_create( &oom_ctx, &p ) );
+	fail_alloc = true;
+	EXPECT_DL_ERR_EQ( DL_ERROR_OUT_OF_LIBRARY_MEMORY, dl_context_load_type_library_inplace( oom_ctx, misaligned + 1, tl2_size ) );
+	fail_alloc = false;
+	EXPECT_DL_ERR_OK( dl_context_load_type_library_inplace( oom_ctx, misaligned + 1, tl2_size ) );
+	EXPECT_DL_ERR_OK( dl_txt_pack( oom_ctx, test2, outbuf, sizeof(outbuf), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_context_destroy( oom_ctx ) );
+
+	free(misaligned);
+	free(tl1);
+	free(tl2);
+}
+
 // test read-errors for enum
 
 // invalid type
@@ -251,10 +251,191 @@ TEST_F( DLUtil, auto_detect_text_file_format )
 	free( allocated_mem );
 }
 
+TEST_F( DLUtil, auto_detect_file_format_from_stream )
+{
+	dl_util_file_type_t file_types[] = { DL_UTIL_FILE_TYPE_BINARY, DL_UTIL_FILE_TYPE_TEXT };
+	for( size_t i = 0; i < DL_ARRAY_LENGTH( file_types ); ++i )
+	{
+		EXPECT_DL_ERR_OK( dl_util_store_to_file( Ctx, Pods::TYPE_ID, TEMP_FILE_NAME, file_types[i], DL_ENDIAN_HOST, sizeof(void*), &p, 0x0, 0x0, 0x0 ) );
+
+		FILE* stream = fopen( TEMP_FILE_NAME, "rb" );
+		ASSERT_NE( (FILE*)0x0, stream );
+		fseek( stream, 0, SEEK_END );
+		size_t file_size = (size_t)ftell( stream );
+		fseek( stream, 0, SEEK_SET );
+
+		union { Pods* p2; void* vp; } conv;
+		conv.p2 = 0x0;
+		dl_typeid_t stored_type;
+		void* allocated_mem;
+		size_t consumed_bytes = 0;
+		EXPECT_DL_ERR_OK( dl_util_load_from_stream( Ctx,
+													0, // check autodetection of type
+													stream,
+													DL_UTIL_FILE_TYPE_AUTO,
+													&conv.vp,
+													&stored_type,
+													&allocated_mem,
+													&consumed_bytes,
+													0x0,
+													0x0,
+													0x0,
+													0x0 ) );
+		fclose( stream );
+
+		dl_typeid_t expect = Pods::TYPE_ID;
+		EXPECT_EQ( expect, stored_type );
+		EXPECT_EQ( file_size, consumed_bytes );
+		check_loaded( conv.p2 );
+
+		free( allocated_mem );
+	}
+}
+
+struct dl_util_test_allocator
+{
+	int allocs;
+	int frees;
+};
+
+static void* dl_util_test_alloc( size_t size, void* ctx ) { ++( (dl_util_test_allocator*)ctx )->allocs; return malloc( size ); }
+static void  dl_util_test_free ( void* ptr,   void* ctx ) { ++( (dl_util_test_allocator*)ctx )->frees;  free( ptr ); }
+
+// ... room for "string_" and any uint32 ...
+static const size_t DL_UTIL_TEST_STRING_SIZE = sizeof("string_4294967295");
+
+static void dl_util_test_store_large( dl_ctx_t dl_ctx, const char** strings, char* string_data, uint32_t string_count )
+{
+	for( uint32_t i = 0; i < string_count; ++i )
+	{
+		snprintf( string_data + i * DL_UTIL_TEST_STRING_SIZE, DL_UTIL_TEST_STRING_SIZE, "string_%u", i );
+		strings[i] = string_data + i * DL_UTIL_TEST_STRING_SIZE;
+	}
+
+	StringArray arr;
+	arr.Strings.data  = strings;
+	arr.Strings.count = string_count;
+	EXPECT_DL_ERR_OK( dl_util_store_to_file( dl_ctx, StringArray::TYPE_ID, TEMP_FILE_NAME, DL_UTIL_FILE_TYPE_BINARY, DL_ENDIAN_HOST, sizeof(void*), &arr, 0x0, 0x0, 0x0 ) );
+}
+
+static void dl_util_test_check_large( StringArray* loaded, const char** strings, uint32_t string_count )
+{
+	ASSERT_EQ( string_count, loaded->Strings.count );
+	for( uint32_t i = 0; i < string_count; ++i )
+		EXPECT_STREQ( strings[i], loaded->Strings[i] );
+}
+
+TEST_F( DLUtil, load_large_file_in_one_read )
+{
+	const uint32_t string_count = 16 * 1024;
+	const char** strings     = (const char**)malloc( string_count * sizeof(const char*) );
+	char*        string_data = (char*)malloc( string_count * DL_UTIL_TEST_STRING_SIZE );
+	dl_util_test_store_large( Ctx, strings, string_data, string_count );
+
+	// ... the file is read into one allocation of the right size, loaded inplace ...
+	dl_util_test_allocator allocator = { 0, 0 };
+	union { StringArray* arr; void* vp; } conv;
+	void* allocated_mem;
+	EXPECT_DL_ERR_OK( dl_util_load_from_file( Ctx, StringArray::TYPE_ID, TEMP_FILE_NAME, DL_UTIL_FILE_TYPE_BINARY, &conv.vp, 0x0, &allocated_mem, dl_util_test_alloc, dl_util_test_free, &allocator ) );
+	EXPECT_EQ( 1, allocator.allocs );
+	EXPECT_EQ( 0, allocator.frees );
+	dl_util_test_check_large( conv.arr, strings, string_count );
+	dl_util_test_free( allocated_mem, &allocator );
+
+#if !defined(_MSC_VER)
+	// ... and from a pipe, where the size is not known up front ...
+	char cmd[256];
+	snprintf( cmd, sizeof(cmd), "cat %s", TEMP_FILE_NAME );
+	FILE* pipe = popen( cmd, "r" );
+	ASSERT_NE( (FILE*)0x0, pipe );
+	size_t consumed = 0;
+	EXPECT_DL_ERR_OK( dl_util_load_from_stream( Ctx, StringArray::TYPE_ID, pipe, DL_UTIL_FILE_TYPE_BINARY, &conv.vp, 0x0, &allocated_mem, &consumed, 0x0, 0x0, 0x0, 0x0 ) );
+	pclose( pipe );
+	dl_util_test_check_large( conv.arr, strings, string_count );
+	free( allocated_mem );
+#endif
+
+	free( string_data );
+	free( strings );
+}
+
+TEST_F( DLUtil, load_batch )
+{
+	const uint32_t file_count = 32;
+	char        names[file_count + 1][64];
+	const char* filenames[file_count + 1];
+	for( uint32_t i = 0; i < file_count; ++i )
+	{
+		snprintf( names[i], sizeof(names[i]), "temp_dl_batch_file_%u.packed", i );
+		filenames[i] = names[i];
+		p.u32 = i;
+		EXPECT_DL_ERR_OK( dl_util_store_to_file( Ctx, Pods::TYPE_ID, filenames[i], i % 2 ? DL_UTIL_FILE_TYPE_TEXT : DL_UTIL_FILE_TYPE_BINARY, DL_ENDIAN_HOST, sizeof(void*), &p, 0x0, 0x0, 0x0 ) );
+	}
+	filenames[file_count] = "whobb whobb whoob";
+
+	// ... more than one thread need a frozen context ...
+	dl_util_load_batch_result_t results[file_count + 1];
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_util_load_batch( Ctx, 0, filenames, file_count, DL_UTIL_FILE_TYPE_AUTO, 4, results, 0x0, 0x0, 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_context_freeze( Ctx ) );
+
+	unsigned int thread_counts[] = { 1, 4, 0 };
+	for( size_t t = 0; t < DL_ARRAY_LENGTH( thread_counts ); ++t )
+	{
+		EXPECT_DL_ERR_OK( dl_util_load_batch( Ctx, 0, filenames, file_count, DL_UTIL_FILE_TYPE_AUTO, thread_counts[t], results, 0x0, 0x0, 0x0 ) );
+		for( uint32_t i = 0; i < file_count; ++i )
+		{
+			EXPECT_DL_ERR_OK( results[i].error );
+			EXPECT_EQ( Pods::TYPE_ID, results[i].type );
+			p.u32 = i;
+			check_loaded( (Pods*)results[i].instance );
+			free( results[i].allocated_mem );
+		}
+	}
+
+	// ... a missing file fails only that file ...
+	EXPECT_DL_ERR_EQ( DL_ERROR_UTIL_FILE_NOT_FOUND, dl_util_load_batch( Ctx, Pods::TYPE_ID, filenames, file_count + 1, DL_UTIL_FILE_TYPE_AUTO, 4, results, 0x0, 0x0, 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_UTIL_FILE_NOT_FOUND, results[file_count].error );
+	for( uint32_t i = 0; i < file_count; ++i )
+	{
+		EXPECT_DL_ERR_OK( results[i].error );
+		free( results[i].allocated_mem );
+		remove( filenames[i] );
+	}
+}
+
 TEST_F( DLUtil, dl_util_load_non_existing_file )
 {
 	EXPECT_DL_ERR_EQ( DL_ERROR_UTIL_FILE_NOT_FOUND,
 					  dl_util_load_from_file( Ctx, 0, "whobb whobb whoob", DL_UTIL_FILE_TYPE_AUTO, 0, 0, 0, 0, 0, 0 ) );
 }
 
+TEST_F( DLUtil, dl_util_load_empty_file )
+{
+	FILE* f = fopen( TEMP_FILE_NAME, "wb" );
+	ASSERT_NE( (FILE*)0x0, f );
+	fclose( f );
+
+	Pods* loaded = 0x0;
+	EXPECT_NE( DL_ERROR_OK, dl_util_load_from_file( Ctx, Pods::TYPE_ID, TEMP_FILE_NAME, DL_UTIL_FILE_TYPE_AUTO, (void**)&loaded, 0x0, 0x0, 0x0, 0x0, 0x0 ) );
+}
+
+#if defined(__linux__)
+TEST_F( DLUtil, store_to_full_disk )
+{
+	// ... /dev/full fails all writes with ENOSPC ...
+	dl_util_file_type_t file_types[] = { DL_UTIL_FILE_TYPE_BINARY, DL_UTIL_FILE_TYPE_TEXT };
+	for( size_t i = 0; i < DL_ARRAY_LENGTH( file_types ); ++i )
+	{
+		EXPECT_DL_ERR_EQ( DL_ERROR_UTIL_FILE_WRITE_FAILED, dl_util_store_to_file( Ctx, Pods::TYPE_ID, "/dev/full", file_types[i], DL_ENDIAN_HOST, sizeof(void*), &p, 0x0, 0x0, 0x0 ) );
+
+		// ... unbuffered so that the write itself fails and not the flush on close ...
+		FILE* stream = fopen( "/dev/full", "wb" );
+		ASSERT_NE( (FILE*)0x0, stream );
+		setvbuf( stream, 0x0, _IONBF, 0 );
+		EXPECT_DL_ERR_EQ( DL_ERROR_UTIL_FILE_WRITE_FAILED, dl_util_store_to_stream( Ctx, Pods::TYPE_ID, stream, file_types[i], DL_ENDIAN_HOST, sizeof(void*), &p, 0x0, 0x0, 0x0 ) );
+		fclose( stream );
+	}
+}
+#endif
+
 // store in other endian and load!
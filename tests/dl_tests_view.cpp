@@ -0,0 +1,255 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl_view.h>
+
+#include "dl_test_common.h"
+
+#include <vector>
+
+class DLView : public DL
+{
+public:
+	template<typename T>
+	std::vector<unsigned char> store( const T* instance )
+	{
+		size_t packed_size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_calc_size( Ctx, T::TYPE_ID, instance, &packed_size ) );
+		std::vector<unsigned char> packed( packed_size );
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, instance, &packed[0], packed.size(), 0x0 ) );
+		return packed;
+	}
+};
+
+TEST_F( DLView, ptr_chain )
+{
+	PtrChain chain[3];
+	chain[0].Int = 1337; chain[0].Next = &chain[1];
+	chain[1].Int = 7331; chain[1].Next = &chain[2];
+	chain[2].Int = 1234; chain[2].Next = 0x0;
+
+	std::vector<unsigned char> packed = store( &chain[0] );
+	std::vector<unsigned char> copy   = packed;
+
+	dl_view_t view;
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, PtrChain::TYPE_ID, &packed[0], packed.size(), &view ) );
+	EXPECT_EQ( DL_TYPE_ATOM_POD,       view.atom );
+	EXPECT_EQ( DL_TYPE_STORAGE_STRUCT, view.storage );
+	EXPECT_EQ( (dl_typeid_t)PtrChain::TYPE_ID, view.type_id );
+
+	for( int i = 0; i < 3; ++i )
+	{
+		dl_view_t member;
+		EXPECT_DL_ERR_OK( dl_view_member( Ctx, &view, 0, &member ) );
+		EXPECT_EQ( DL_TYPE_STORAGE_UINT32, member.storage );
+		EXPECT_EQ( chain[i].Int, *(const uint32_t*)member.data );
+
+		EXPECT_DL_ERR_OK( dl_view_member( Ctx, &view, 1, &view ) );
+		EXPECT_EQ( DL_TYPE_STORAGE_PTR, view.storage );
+	}
+	EXPECT_EQ( 0x0, view.data );
+	dl_view_t member;
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_view_member( Ctx, &view, 0, &member ) );
+
+	// ... and the same via the generated view ...
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, PtrChain::TYPE_ID, &packed[0], packed.size(), &view ) );
+	PtrChain_view v = { view.packed_instance, (const PtrChain*)view.data };
+	EXPECT_EQ( 1337u, v.Int() );
+	EXPECT_EQ( 7331u, v.Next().Int() );
+	EXPECT_EQ( 1234u, v.Next().Next().Int() );
+	EXPECT_FALSE( v.Next().Next().Next() );
+
+	// ... nothing is ever written to the packed instance ...
+	EXPECT_EQ( copy, packed );
+}
+
+TEST_F( DLView, arrays )
+{
+	const char* strings[] = { "cow", "bells", 0x0, "bananas" };
+	StringArray str_arr;
+	str_arr.Strings.data  = strings;
+	str_arr.Strings.count = DL_ARRAY_LENGTH( strings );
+
+	std::vector<unsigned char> packed = store( &str_arr );
+
+	dl_view_t view;
+	dl_view_t arr;
+	dl_view_t elem;
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, StringArray::TYPE_ID, &packed[0], packed.size(), &view ) );
+	EXPECT_DL_ERR_OK( dl_view_member( Ctx, &view, 0, &arr ) );
+	EXPECT_EQ( DL_TYPE_ATOM_ARRAY,  arr.atom );
+	EXPECT_EQ( DL_TYPE_STORAGE_STR, arr.storage );
+	ASSERT_EQ( 4u, arr.count );
+	for( unsigned int i = 0; i < arr.count; ++i )
+	{
+		EXPECT_DL_ERR_OK( dl_view_array_elem( Ctx, &arr, i, &elem ) );
+		if( strings[i] )
+			EXPECT_STREQ( strings[i], (const char*)elem.data );
+		else
+			EXPECT_EQ( 0x0, elem.data );
+	}
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_view_array_elem( Ctx, &arr, 4, &elem ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_view_array_elem( Ctx, &view, 0, &elem ) );
+
+	StringArray_view str_view = { view.packed_instance, (const StringArray*)view.data };
+	ASSERT_EQ( 4u, str_view.Strings_count() );
+	EXPECT_STREQ( "cow",     str_view.Strings( 0 ) );
+	EXPECT_STREQ( "bells",   str_view.Strings( 1 ) );
+	EXPECT_EQ   ( 0x0,       str_view.Strings( 2 ) );
+	EXPECT_STREQ( "bananas", str_view.Strings( 3 ) );
+
+	Pods2 pods[3] = { { 1, 2 }, { 3, 4 }, { 5, 6 } };
+	Pods2* pod_ptrs[4] = { &pods[2], 0x0, &pods[0], &pods[2] };
+	ptr_array ptr_arr;
+	ptr_arr.arr.data  = pod_ptrs;
+	ptr_arr.arr.count = DL_ARRAY_LENGTH( pod_ptrs );
+
+	packed = store( &ptr_arr );
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, ptr_array::TYPE_ID, &packed[0], packed.size(), &view ) );
+	EXPECT_DL_ERR_OK( dl_view_member( Ctx, &view, 0, &arr ) );
+	ASSERT_EQ( 4u, arr.count );
+	EXPECT_DL_ERR_OK( dl_view_array_elem( Ctx, &arr, 2, &elem ) );
+	EXPECT_EQ( DL_TYPE_STORAGE_PTR, elem.storage );
+	EXPECT_DL_ERR_OK( dl_view_member( Ctx, &elem, 1, &elem ) );
+	EXPECT_EQ( 2u, *(const uint32_t*)elem.data );
+
+	ptr_array_view ptr_view = { view.packed_instance, (const ptr_array*)view.data };
+	ASSERT_EQ( 4u, ptr_view.arr_count() );
+	EXPECT_EQ( 5u, ptr_view.arr( 0 ).Int1() );
+	EXPECT_FALSE( ptr_view.arr( 1 ) );
+	EXPECT_EQ( 2u, ptr_view.arr( 2 ).Int2() );
+	EXPECT_EQ( ptr_view.arr( 0 ).dl_data, ptr_view.arr( 3 ).dl_data );
+
+	StructArray1 struct_arr;
+	struct_arr.Array.data  = pods;
+	struct_arr.Array.count = DL_ARRAY_LENGTH( pods );
+	packed = store( &struct_arr );
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, StructArray1::TYPE_ID, &packed[0], packed.size(), &view ) );
+	StructArray1_view struct_view = { view.packed_instance, (const StructArray1*)view.data };
+	ASSERT_EQ( 3u, struct_view.Array_count() );
+	for( uint32_t i = 0; i < 3; ++i )
+	{
+		EXPECT_EQ( pods[i].Int1, struct_view.Array( i ).Int1() );
+		EXPECT_EQ( pods[i].Int2, struct_view.Array( i ).Int2() );
+	}
+
+	// ... empty arrays ...
+	struct_arr.Array.data  = 0x0;
+	struct_arr.Array.count = 0;
+	packed = store( &struct_arr );
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, StructArray1::TYPE_ID, &packed[0], packed.size(), &view ) );
+	EXPECT_DL_ERR_OK( dl_view_member( Ctx, &view, 0, &arr ) );
+	EXPECT_EQ( 0u, arr.count );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_view_array_elem( Ctx, &arr, 0, &elem ) );
+}
+
+TEST_F( DLView, inline_arrays )
+{
+	StringInlineArray str_arr = { { "cow", "bells", "bananas" } };
+	std::vector<unsigned char> packed = store( &str_arr );
+
+	dl_view_t view;
+	dl_view_t arr;
+	dl_view_t elem;
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, StringInlineArray::TYPE_ID, &packed[0], packed.size(), &view ) );
+	EXPECT_DL_ERR_OK( dl_view_member( Ctx, &view, 0, &arr ) );
+	EXPECT_EQ( DL_TYPE_ATOM_INLINE_ARRAY, arr.atom );
+	ASSERT_EQ( 3u, arr.count );
+	EXPECT_DL_ERR_OK( dl_view_array_elem( Ctx, &arr, 1, &elem ) );
+	EXPECT_STREQ( "bells", (const char*)elem.data );
+
+	StringInlineArray_view str_view = { view.packed_instance, (const StringInlineArray*)view.data };
+	EXPECT_EQ( 3u, str_view.Strings_count() );
+	EXPECT_STREQ( "cow",     str_view.Strings( 0 ) );
+	EXPECT_STREQ( "bananas", str_view.Strings( 2 ) );
+
+	WithInlineStructArray struct_arr = { { { 1, 2 }, { 3, 4 }, { 5, 6 } } };
+	packed = store( &struct_arr );
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, WithInlineStructArray::TYPE_ID, &packed[0], packed.size(), &view ) );
+	EXPECT_DL_ERR_OK( dl_view_member( Ctx, &view, 0, &arr ) );
+	EXPECT_DL_ERR_OK( dl_view_array_elem( Ctx, &arr, 2, &elem ) );
+	EXPECT_EQ( DL_TYPE_STORAGE_STRUCT, elem.storage );
+	EXPECT_DL_ERR_OK( dl_view_member( Ctx, &elem, 0, &elem ) );
+	EXPECT_EQ( 5u, *(const uint32_t*)elem.data );
+
+	WithInlineStructArray_view struct_view = { view.packed_instance, (const WithInlineStructArray*)view.data };
+	EXPECT_EQ( 4u, struct_view.Array( 1 ).Int2() );
+}
+
+TEST_F( DLView, union_only_view_set_member )
+{
+	test_union_simple u;
+	memset( &u, 0x0, sizeof( u ) );
+	u.type = test_union_simple_type_item2;
+	u.value.item2 = 13.37f;
+	std::vector<unsigned char> packed = store( &u );
+
+	dl_view_t view;
+	dl_view_t member;
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, test_union_simple::TYPE_ID, &packed[0], packed.size(), &view ) );
+	EXPECT_DL_ERR_OK( dl_view_member( Ctx, &view, 1, &member ) );
+	EXPECT_EQ( 13.37f, *(const float*)member.data );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_view_member( Ctx, &view, 0, &member ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_view_member( Ctx, &view, 2, &member ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_view_member( Ctx, &view, 3, &member ) );
+}
+
+TEST_F( DLView, union_typed_view_checks_type )
+{
+	Pods p;
+	memset( &p, 0x0, sizeof( p ) );
+	p.u32 = 1337;
+	test_union_ptr u;
+	memset( &u, 0x0, sizeof( u ) );
+	u.type = test_union_ptr_type_p1;
+	u.value.p1 = &p;
+	std::vector<unsigned char> packed = store( &u );
+
+	dl_view_t view;
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, test_union_ptr::TYPE_ID, &packed[0], packed.size(), &view ) );
+	test_union_ptr_view union_view = { view.packed_instance, (const test_union_ptr*)view.data };
+	EXPECT_EQ( test_union_ptr_type_p1, union_view.type() );
+	ASSERT_TRUE( (bool)union_view.p1() );
+	EXPECT_EQ( 1337u, union_view.p1().u32() );
+
+	// ... members not set are never resolved ...
+	EXPECT_FALSE( (bool)union_view.p2() );
+	EXPECT_FALSE( (bool)union_view.p3() );
+}
+
+TEST_F( DLView, errors )
+{
+	PtrChain chain[2];
+	chain[0].Int = 1; chain[0].Next = &chain[1];
+	chain[1].Int = 2; chain[1].Next = 0x0;
+	std::vector<unsigned char> stored = store( &chain[0] );
+	std::vector<unsigned char> packed = stored;
+
+	dl_view_t view;
+	dl_view_t member;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH,  dl_view_instance( Ctx, Pods::TYPE_ID, &packed[0], packed.size(), &view ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_view_instance( Ctx, PtrChain::TYPE_ID, &packed[0], packed.size() - 1, &view ) );
+
+	// ... bitfields are read from the struct ...
+	TestBits bits;
+	memset( &bits, 0x0, sizeof( bits ) );
+	std::vector<unsigned char> packed_bits = store( &bits );
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, TestBits::TYPE_ID, &packed_bits[0], packed_bits.size(), &view ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_view_member( Ctx, &view, 0, &member ) );
+
+	// ... offsets outside of the instance ...
+	EXPECT_DL_ERR_OK( dl_view_instance( Ctx, PtrChain::TYPE_ID, &packed[0], packed.size(), &view ) );
+	((PtrChain*)view.data)->Next = (PtrChain*)(uintptr_t)( packed.size() - 4 );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_view_member( Ctx, &view, 1, &member ) );
+
+	// ... instances with relative pointers are read via the _rel_-accessors ...
+	packed = stored;
+	EXPECT_DL_ERR_OK( dl_instance_make_relative( Ctx, PtrChain::TYPE_ID, &packed[0], packed.size() ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_view_instance( Ctx, PtrChain::TYPE_ID, &packed[0], packed.size(), &view ) );
+
+	packed = stored;
+	std::swap( packed[0], packed[3] );
+	std::swap( packed[1], packed[2] );
+	EXPECT_DL_ERR_EQ( DL_ERROR_ENDIAN_MISMATCH, dl_view_instance( Ctx, PtrChain::TYPE_ID, &packed[0], packed.size(), &view ) );
+}
@@ -248,7 +248,7 @@ int main( int argc, const char** argv )
 		if( err != DL_ERROR_OK )
 			M_ERROR_AND_QUIT( "DL error writing stream: %s", dl_error_to_string( err ) );
 
-		free( instance );
+		free( allocated_mem );
 	}
 
 	if( in_file_path[0]  != '\0' ) fclose( in_file );